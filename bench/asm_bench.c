@@ -0,0 +1,213 @@
+/*
+ * Checks the assembler against the decoder and measures it. Every opcode
+ * on every prefix page, with two sets of operand bytes, is disassembled in
+ * three syntaxes, assembled back and disassembled again, and the two
+ * listings must agree; where the decoder has several encodings of one
+ * instruction the assembler picks one, so the bytes need not. Then times
+ * building the tables and assembling the source given, normally
+ * sup/sup.asm. Writes the results to stdout as JSON.
+ *
+ *   make bench
+ *
+ * or
+ *
+ *   cc -O2 -I.. -I../host -o asm_bench asm_bench.c ../host/z80asm.c \
+ *       ../host/z80list.c ../z80dasm.c
+ *   ./asm_bench ../sup/sup.asm
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "z80asm.h"
+
+#define IMAGE_SIZE 65536
+#define PAGES 7
+#define VARIANTS 2
+/* where each instruction goes: 8 bytes apart from ORIGIN */
+#define ORIGIN 0x4000
+#define STRIDE 8
+#define TEXT_MAX 64
+#define ASSEMBLIES 1000
+#define INITS 100
+
+typedef struct {
+  uint16_t addr;
+  uint8_t len;
+  char text[TEXT_MAX];
+} Form;
+
+static const uint8_t s_prefixes[PAGES][2] = {
+  { 0, 0 }, { 0xcb, 0 }, { 0xed, 0 }, { 0xdd, 0 }, { 0xfd, 0 },
+  { 0xdd, 0xcb }, { 0xfd, 0xcb }
+};
+static const int s_prefixLen[PAGES] = { 0, 1, 1, 1, 1, 2, 2 };
+/* displacement or first operand byte, then second */
+static const uint8_t s_operands[VARIANTS][2] = { { 0x34, 0x12 }, { 0x85, 0xfe } };
+static const int s_syntaxes[] = {
+  fmt_Zilog, fmt_Lower | fmt_HexDollar, fmt_HexSuffix
+};
+
+static uint8_t s_reference[IMAGE_SIZE];
+static uint8_t s_image[IMAGE_SIZE];
+static Form s_forms[PAGES * 256 * VARIANTS];
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int format(const uint8_t* mem, uint16_t addr, int syntax, char* text,
+    uint8_t* len) {
+  Z80_Line line;
+  z80_disassemble_range(mem + addr, STRIDE, addr, &line, 1, NULL);
+  if (line.status != ds_Ok) return -1;
+  z80_format_syntax(&line.opcode, syntax, text, TEXT_MAX);
+  *len = line.opcode.len;
+  return 0;
+}
+
+/* lays every valid opcode out in s_reference, returning how many */
+static size_t layOut(void) {
+  size_t n = 0;
+  for (int page = 0; page < PAGES; page++) {
+    int pre = s_prefixLen[page];
+    for (int op = 0; op < 256; op++) {
+      for (int v = 0; v < VARIANTS; v++) {
+        uint16_t addr = (uint16_t) (ORIGIN + n * STRIDE);
+        uint8_t* p = s_reference + addr;
+        Z80_OpCode opcode;
+        memset(p, 0, STRIDE);
+        memcpy(p, s_prefixes[page], (size_t) pre);
+        if (pre == 2) {
+          p[2] = s_operands[v][0];
+          p[3] = (uint8_t) op;
+        }
+        else {
+          p[pre] = (uint8_t) op;
+          p[pre + 1] = s_operands[v][0];
+          p[pre + 2] = s_operands[v][1];
+        }
+        if (z80_decode(p, &opcode) == 0) continue;
+        s_forms[n].addr = addr;
+        n++;
+      }
+    }
+  }
+  return n;
+}
+
+/*
+ * Assembles the n forms in syntax and checks each against the reference,
+ * counting those whose bytes match exactly in *same. Returns -1 on a
+ * mismatch.
+ */
+static int roundTrip(Z80_Asm* as, size_t n, int syntax, size_t* same) {
+  size_t cap = n * (TEXT_MAX + 32) + 64;
+  char* source = (char*) malloc(cap);
+  size_t len = 0;
+  *same = 0;
+  if (source == NULL) return -1;
+  for (size_t i = 0; i < n; i++) {
+    Form* form = &s_forms[i];
+    if (format(s_reference, form->addr, syntax, form->text, &form->len) != 0) {
+      free(source);
+      return -1;
+    }
+    len += (size_t) snprintf(source + len, cap - len, "\torg 0x%x\n\t%s\n",
+        form->addr, form->text);
+  }
+  memset(s_image, 0, sizeof(s_image));
+  if (z80_asm_assemble(as, source, len, s_image) != 0) {
+    fprintf(stderr, "asm_bench: line %d: %s\n", as->line, as->error);
+    free(source);
+    return -1;
+  }
+  free(source);
+  for (size_t i = 0; i < n; i++) {
+    const Form* form = &s_forms[i];
+    char text[TEXT_MAX];
+    uint8_t len;
+    if (format(s_image, form->addr, syntax, text, &len) != 0 ||
+        strcmp(text, form->text) != 0) {
+      fprintf(stderr, "asm_bench: %s does not round-trip\n", form->text);
+      return -1;
+    }
+    if (len == form->len &&
+        memcmp(s_image + form->addr, s_reference + form->addr, len) == 0) {
+      (*same)++;
+    }
+  }
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  Z80_Asm* as = (Z80_Asm*) malloc(sizeof(Z80_Asm));
+  size_t forms = layOut();
+  size_t same = 0;
+  char* text = NULL;
+  size_t len = 0, cap = 0, n;
+  double init, assemble;
+  FILE* fp;
+
+  if (argc != 2) {
+    fprintf(stderr, "usage: asm_bench source.asm\n");
+    return 1;
+  }
+  if (as == NULL) {
+    fprintf(stderr, "asm_bench: out of memory\n");
+    return 1;
+  }
+  fp = fopen(argv[1], "rb");
+  if (fp == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+  do {
+    char* more;
+    cap = cap != 0 ? cap * 2 : 65536;
+    more = (char*) realloc(text, cap);
+    if (more == NULL) {
+      fprintf(stderr, "asm_bench: out of memory\n");
+      return 1;
+    }
+    text = more;
+    len += (n = fread(text + len, 1, cap - len, fp));
+  } while (n != 0 && len == cap);
+  fclose(fp);
+
+  init = now();
+  for (int i = 0; i < INITS; i++) {
+    if (i != 0) z80_asm_free(as);
+    if (z80_asm_init(as) != 0) {
+      fprintf(stderr, "asm_bench: out of memory\n");
+      return 1;
+    }
+  }
+  init = (now() - init) / INITS;
+
+  for (size_t i = 0; i < sizeof(s_syntaxes) / sizeof(s_syntaxes[0]); i++) {
+    if (roundTrip(as, forms, s_syntaxes[i], &same) != 0) return 1;
+  }
+
+  assemble = now();
+  for (int i = 0; i < ASSEMBLIES; i++) {
+    if (z80_asm_assemble(as, text, len, s_image) != 0) {
+      fprintf(stderr, "%s:%d: %s\n", argv[1], as->line, as->error);
+      return 1;
+    }
+  }
+  assemble = (now() - assemble) / ASSEMBLIES;
+
+  printf("{\n  \"forms\": %zu,\n  \"syntaxes\": %zu,\n  \"same_bytes\": %zu,\n"
+      "  \"init_us\": %.1f,\n  \"source_bytes\": %zu,\n  \"image_bytes\": %u,\n"
+      "  \"symbols\": %zu,\n  \"assemble_us\": %.1f\n}\n", forms,
+      sizeof(s_syntaxes) / sizeof(s_syntaxes[0]), same, init / 1e3,
+      len, as->high - as->low, as->symbol_count, assemble / 1e3);
+  z80_asm_free(as);
+  free(as);
+  free(text);
+  return 0;
+}
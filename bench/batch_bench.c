@@ -0,0 +1,136 @@
+/*
+ * Runs a batch of independent machines booting the assembled supervisor,
+ * each with a test program that prints its own line with @puts and
+ * computes between lines, first on one thread and then on one per
+ * processor, and checks that every machine printed the same both times.
+ * Writes the results to stdout as JSON.
+ *
+ *   make bench SUP_IMAGE=path/to/sup.bin
+ *
+ * or
+ *
+ *   cc -O2 -I.. -I../host -o batch_bench batch_bench.c ../host/z80batch.c \
+ *       ../host/z80con.c ../host/z80emu.c ../host/z80list.c \
+ *       ../host/z80pool.c ../host/z80svc.c ../z80dasm.c -lpthread
+ *   ./batch_bench sup.bin
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "z80batch.h"
+#include "z80pool.h"
+#include "z80sup.h"
+
+#define MESSAGE 0x8000
+#define MACHINES 512
+#define LINES 20
+#define WORK 2000
+#define BUDGET 100000000
+
+#define SVC_EXIT 0
+#define SVC_PUTS 4
+
+static uint8_t s_sup[Z80_MEM_SIZE];
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* boots each machine with the test program and its own message */
+static void setUp(Z80_Machine* machines) {
+  static const uint8_t program[] = {
+    0x06, LINES,                                 /* LD B,LINES */
+    0xc5,                                        /* PUSH BC */
+    0x21, MESSAGE & 0xff, MESSAGE >> 8,          /* LD HL,MESSAGE */
+    0x3e, SVC_PUTS,                              /* LD A,@puts */
+    0xef,                                        /* RST 0x28 */
+    0x11, WORK & 0xff, WORK >> 8,                /* LD DE,WORK */
+    0x1b,                                        /* DEC DE */
+    0x7a,                                        /* LD A,D */
+    0xb3,                                        /* OR E */
+    0x20, 0xfb,                                  /* JR NZ,$-3 */
+    0xc1,                                        /* POP BC */
+    0x10, 0xee,                                  /* DJNZ $-16 */
+    0x3e, SVC_EXIT,                              /* LD A,@exit */
+    0xef                                         /* RST 0x28 */
+  };
+  for (int i = 0; i < MACHINES; i++) {
+    Z80_Machine* m = &machines[i];
+    char message[64];
+    int n = snprintf(message, sizeof(message), "machine %d reporting\n", i);
+    z80_machine_init(m, s_sup, sizeof(s_sup));
+    z80_machine_load(m, Z80_SUP_USER_PROG, program, sizeof(program));
+    z80_machine_load(m, MESSAGE, (const uint8_t*) message, (size_t) n + 1);
+    m->budget = BUDGET;
+  }
+}
+
+static void tearDown(Z80_Machine* machines) {
+  for (int i = 0; i < MACHINES; i++) z80_machine_free(&machines[i]);
+}
+
+int main(int argc, char** argv) {
+  Z80_Machine* single = (Z80_Machine*) malloc(MACHINES * sizeof(Z80_Machine));
+  Z80_Machine* batch = (Z80_Machine*) malloc(MACHINES * sizeof(Z80_Machine));
+  int threads = z80_pool_default_threads();
+  uint64_t cycles = 0;
+  size_t bytes = 0;
+  double single_ns, batch_ns;
+  FILE* fp;
+
+  if (argc != 2) {
+    fprintf(stderr, "usage: batch_bench sup.bin\n");
+    return 1;
+  }
+  if (single == NULL || batch == NULL) {
+    fprintf(stderr, "batch_bench: out of memory\n");
+    return 1;
+  }
+  fp = fopen(argv[1], "rb");
+  if (fp == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+  if (fread(s_sup, 1, sizeof(s_sup), fp) <= Z80_SUP_USER_PROG) {
+    fprintf(stderr, "batch_bench: %s: too short\n", argv[1]);
+    return 1;
+  }
+  fclose(fp);
+
+  setUp(single);
+  single_ns = now();
+  if (z80_machines_run(single, MACHINES, 1) != 0) return 1;
+  single_ns = now() - single_ns;
+  setUp(batch);
+  batch_ns = now();
+  if (z80_machines_run(batch, MACHINES, threads) != 0) return 1;
+  batch_ns = now() - batch_ns;
+
+  for (int i = 0; i < MACHINES; i++) {
+    const Z80_Machine* a = &single[i];
+    const Z80_Machine* b = &batch[i];
+    if (a->status != bat_Halted || b->status != bat_Halted ||
+        a->cpu.cycles != b->cpu.cycles || a->output.len != b->output.len ||
+        memcmp(a->output.data, b->output.data, a->output.len) != 0) {
+      fprintf(stderr, "batch_bench: machine %d differs\n", i);
+      return 1;
+    }
+    cycles += b->cpu.cycles;
+    bytes += b->output.len;
+  }
+
+  printf("{\n  \"machines\": %d,\n  \"threads\": %d,\n  \"t_states\": %llu,\n"
+      "  \"output_bytes\": %zu,\n  \"single_thread_mhz\": %.1f,\n"
+      "  \"batch_mhz\": %.1f,\n  \"speedup\": %.2f\n}\n", MACHINES, threads,
+      (unsigned long long) cycles, bytes, cycles / single_ns * 1e3,
+      cycles / batch_ns * 1e3, single_ns / batch_ns);
+  tearDown(single);
+  tearDown(batch);
+  free(single);
+  free(batch);
+  return 0;
+}
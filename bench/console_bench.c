@@ -0,0 +1,132 @@
+/*
+ * Compares the T-states a program spends writing a string and then
+ * computing when the string goes out through the polled per-character
+ * @puts and when it is queued with the interrupt-driven @write of
+ * sup/sup.asm, over console lines of several speeds. Writes the results
+ * to stdout as JSON.
+ *
+ *   make bench SUP_IMAGE=path/to/sup.bin
+ *
+ * or
+ *
+ *   cc -O2 -I.. -I../host -o console_bench console_bench.c \
+ *       ../host/z80con.c ../host/z80emu.c
+ *   ./console_bench sup.bin
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "z80con.h"
+#include "z80sup.h"
+
+#define MESSAGE 0x8000
+#define MESSAGE_LEN 200
+#define MAX_CYCLES 100000000
+
+#define SVC_EXIT 0
+#define SVC_PUTS 4
+#define SVC_WRITE 5
+
+typedef struct {
+  unsigned long sent;
+} Sink;
+
+static uint8_t s_sup[Z80_MEM_SIZE];
+static uint8_t s_mem[Z80_MEM_SIZE];
+
+static void sinkWrite(void* ctx, uint8_t c) {
+  (void) c;
+  ((Sink*) ctx)->sent++;
+}
+
+/*
+ * Writes the message at MESSAGE with @puts or @write, counts DE down
+ * from work, then exits. Returns the T-states to the final halt.
+ */
+static uint64_t run(int buffered, unsigned work, uint32_t char_cycles,
+    unsigned long* sent) {
+  static const uint8_t puts_call[] = {
+    0x21, MESSAGE & 0xff, MESSAGE >> 8,          /* LD HL,MESSAGE */
+    0x3e, SVC_PUTS,                              /* LD A,@puts */
+    0xef                                         /* RST 0x28 */
+  };
+  static const uint8_t write_call[] = {
+    0x21, MESSAGE & 0xff, MESSAGE >> 8,          /* LD HL,MESSAGE */
+    0x01, MESSAGE_LEN & 0xff, MESSAGE_LEN >> 8,  /* LD BC,MESSAGE_LEN */
+    0x3e, SVC_WRITE,                             /* LD A,@write */
+    0xef                                         /* RST 0x28 */
+  };
+  const uint8_t tail[] = {
+    0x11, (uint8_t) work, (uint8_t) (work >> 8), /* LD DE,work */
+    0x1b,                                        /* DEC DE */
+    0x7a,                                        /* LD A,D */
+    0xb3,                                        /* OR E */
+    0x20, 0xfb,                                  /* JR NZ,$-3 */
+    0x3e, SVC_EXIT,                              /* LD A,@exit */
+    0xef                                         /* RST 0x28 */
+  };
+  Z80_CPU cpu;
+  Z80_Console con;
+  Sink sink = { 0 };
+  uint8_t* p = s_mem + Z80_SUP_USER_PROG;
+
+  memcpy(s_mem, s_sup, sizeof(s_mem));
+  if (buffered) {
+    memcpy(p, write_call, sizeof(write_call));
+    p += sizeof(write_call);
+  }
+  else {
+    memcpy(p, puts_call, sizeof(puts_call));
+    p += sizeof(puts_call);
+  }
+  memcpy(p, tail, sizeof(tail));
+  memset(s_mem + MESSAGE, '*', MESSAGE_LEN);
+  s_mem[MESSAGE + MESSAGE_LEN] = 0;
+
+  z80_cpu_init(&cpu, s_mem, NULL, NULL, NULL);
+  z80_con_init(&con, &cpu, NULL, sinkWrite, &sink);
+  con.char_cycles = char_cycles;
+  z80_con_run(&con, MAX_CYCLES);
+  *sent = sink.sent;
+  return cpu.cycles;
+}
+
+int main(int argc, char** argv) {
+  /* an infinitely fast line, then 115200 and 9600 baud at 4 MHz */
+  static const uint32_t char_cycles[] = { 0, 347, 4167 };
+  static const unsigned work[] = { 1, 20000 };
+  int first = 1;
+  FILE* fp;
+
+  if (argc != 2) {
+    fprintf(stderr, "usage: console_bench sup.bin\n");
+    return 1;
+  }
+  fp = fopen(argv[1], "rb");
+  if (fp == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+  if (fread(s_sup, 1, sizeof(s_sup), fp) <= Z80_SUP_USER_PROG) {
+    fprintf(stderr, "console_bench: %s: too short\n", argv[1]);
+    return 1;
+  }
+  fclose(fp);
+
+  printf("{\n  \"message_len\": %d,\n  \"results\": [\n", MESSAGE_LEN);
+  for (size_t c = 0; c < sizeof(char_cycles) / sizeof(char_cycles[0]); c++) {
+    for (size_t w = 0; w < sizeof(work) / sizeof(work[0]); w++) {
+      for (int buffered = 0; buffered <= 1; buffered++) {
+        unsigned long sent;
+        uint64_t t = run(buffered, work[w], char_cycles[c], &sent);
+        printf("%s    {\"path\": \"%s\", \"char_cycles\": %u, \"work_loops\": %u, "
+            "\"t_states\": %llu, \"sent\": %lu}", first ? "" : ",\n",
+            buffered ? "write" : "puts", char_cycles[c], work[w],
+            (unsigned long long) t, sent);
+        first = 0;
+      }
+    }
+  }
+  printf("\n  ]\n}\n");
+  return 0;
+}
@@ -0,0 +1,247 @@
+/*
+ * Measures ns and heap allocations per instruction for the decoder's
+ * entry points over every opcode on every prefix page, a random 64 KiB
+ * image and, when its path is given, the assembled supervisor image.
+ * Writes the results to stdout as JSON.
+ *
+ *   make bench SUP_IMAGE=path/to/sup.bin
+ *
+ * or, without allocation counts,
+ *
+ *   cc -O2 -I.. -o dasm_bench dasm_bench.c ../z80dasm.c
+ *   ./dasm_bench [sup.bin]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "z80dasm.h"
+
+#define IMAGE_SIZE 65536
+#define PAGES 7
+#define TARGET_INSNS 4000000
+#define LINE_BATCH 256
+
+typedef struct {
+  const char* name;
+  const uint8_t* mem;
+  size_t len;
+  /* fixed-length records, one instruction each, or 0 for a linear sweep */
+  size_t stride;
+} Input;
+
+typedef long (*Method)(const Input* input);
+
+static uint8_t s_image[IMAGE_SIZE + 4];
+static uint8_t s_opcodes[PAGES * 256][8];
+static uint8_t s_sup[IMAGE_SIZE + 4];
+static volatile unsigned s_sink;
+
+#if defined(BENCH_COUNT_ALLOCS)
+
+/* linked with -Wl,--wrap=malloc,--wrap=calloc,--wrap=realloc */
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t n, size_t size);
+void* __real_realloc(void* p, size_t size);
+
+static unsigned long s_allocs;
+
+void* __wrap_malloc(size_t size) {
+  s_allocs++;
+  return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t n, size_t size) {
+  s_allocs++;
+  return __real_calloc(n, size);
+}
+
+void* __wrap_realloc(void* p, size_t size) {
+  s_allocs++;
+  return __real_realloc(p, size);
+}
+
+#define ALLOCS() s_allocs
+#define COUNTING_ALLOCS 1
+
+#else
+
+#define ALLOCS() 0UL
+#define COUNTING_ALLOCS 0
+
+#endif
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void fillImage(void) {
+  uint32_t seed = 0x2545f491;
+  for (int i = 0; i < IMAGE_SIZE; i++) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    s_image[i] = (uint8_t) seed;
+  }
+}
+
+static void fillOpcodes(void) {
+  static const uint8_t prefixes[PAGES][2] = {
+    { 0, 0 }, { 0xcb, 0 }, { 0xed, 0 }, { 0xdd, 0 }, { 0xfd, 0 },
+    { 0xdd, 0xcb }, { 0xfd, 0xcb }
+  };
+  for (int page = 0; page < PAGES; page++) {
+    for (int op = 0; op < 256; op++) {
+      uint8_t* mem = s_opcodes[page * 256 + op];
+      int n = 0;
+      if (prefixes[page][0] != 0) mem[n++] = prefixes[page][0];
+      if (prefixes[page][1] != 0) mem[n++] = prefixes[page][1];
+      if (page >= 5) mem[n++] = 0x05;
+      mem[n++] = (uint8_t) op;
+      while (n < 8) mem[n++] = 0x34;
+    }
+  }
+}
+
+/* z80_disassemble(), z80_to_string() and z80_free(), as callers use them */
+static long methodDisassemble(const Input* input) {
+  long count = 0;
+  size_t pc = 0;
+  while (pc < input->len) {
+    Z80_OpCode* opcode = z80_disassemble((uint8_t*) input->mem + pc);
+    size_t len = 1;
+    if (opcode != NULL) {
+      s_sink += z80_to_string(opcode)[0];
+      len = opcode->len;
+      z80_free(opcode);
+    }
+    pc += input->stride != 0 ? input->stride : len;
+    count++;
+  }
+  return count;
+}
+
+/* the allocation-free z80_decode() and z80_format() */
+static long methodDecode(const Input* input) {
+  char text[64];
+  long count = 0;
+  size_t pc = 0;
+  while (pc < input->len) {
+    Z80_OpCode opcode;
+    size_t len = z80_decode(input->mem + pc, &opcode);
+    if (len != 0) s_sink += z80_format(&opcode, text, sizeof(text));
+    else len = 1;
+    pc += input->stride != 0 ? input->stride : len;
+    count++;
+  }
+  return count;
+}
+
+/* bounded z80_disassemble_range() sweeps, formatting each line */
+static long methodRange(const Input* input) {
+  Z80_Line lines[LINE_BATCH];
+  char text[64];
+  long count = 0;
+  size_t pc = 0;
+  while (pc < input->len) {
+    size_t consumed;
+    size_t n;
+    if (input->stride != 0) {
+      n = z80_disassemble_range(input->mem + pc, input->stride, 0, lines, 1, NULL);
+      consumed = input->stride;
+    }
+    else {
+      n = z80_disassemble_range(input->mem + pc, input->len - pc, (uint16_t) pc,
+          lines, LINE_BATCH, &consumed);
+    }
+    for (size_t i = 0; i < n; i++) {
+      if (lines[i].status == ds_Ok) {
+        s_sink += z80_format(&lines[i].opcode, text, sizeof(text));
+      }
+    }
+    pc += consumed;
+    count += (long) n;
+  }
+  return count;
+}
+
+static void run(const char* method_name, Method method, const Input* input,
+    int* first) {
+  long insns = 0;
+  long rounds = 0;
+  unsigned long allocs;
+  double start;
+
+  /* one untimed pass to size the run and warm caches */
+  long per_round = method(input);
+  long target_rounds = per_round > 0 ? TARGET_INSNS / per_round + 1 : 1;
+
+  allocs = ALLOCS();
+  start = now();
+  while (rounds < target_rounds) {
+    insns += method(input);
+    rounds++;
+  }
+  double elapsed = now() - start;
+  allocs = ALLOCS() - allocs;
+
+  printf("%s    {\"method\": \"%s\", \"input\": \"%s\", \"bytes\": %zu, "
+      "\"insns\": %ld, \"ns_per_insn\": %.3f, ", *first ? "" : ",\n",
+      method_name, input->name, input->len, insns, elapsed / insns);
+  if (COUNTING_ALLOCS) printf("\"allocs_per_insn\": %.3f}", (double) allocs / insns);
+  else printf("\"allocs_per_insn\": null}");
+  *first = 0;
+}
+
+int main(int argc, char** argv) {
+  static const struct {
+    const char* name;
+    Method method;
+  } methods[] = {
+    { "disassemble", methodDisassemble },
+    { "decode", methodDecode },
+    { "range", methodRange }
+  };
+  Input inputs[3];
+  int ninputs = 0;
+  int first = 1;
+
+  fillOpcodes();
+  fillImage();
+  inputs[ninputs].name = "opcodes";
+  inputs[ninputs].mem = &s_opcodes[0][0];
+  inputs[ninputs].len = sizeof(s_opcodes);
+  inputs[ninputs++].stride = sizeof(s_opcodes[0]);
+  inputs[ninputs].name = "random";
+  inputs[ninputs].mem = s_image;
+  inputs[ninputs].len = IMAGE_SIZE;
+  inputs[ninputs++].stride = 0;
+
+  if (argc > 1) {
+    FILE* fp = fopen(argv[1], "rb");
+    size_t n;
+    if (fp == NULL) {
+      perror(argv[1]);
+      return 1;
+    }
+    n = fread(s_sup, 1, IMAGE_SIZE, fp);
+    fclose(fp);
+    inputs[ninputs].name = "sup";
+    inputs[ninputs].mem = s_sup;
+    inputs[ninputs].len = n;
+    inputs[ninputs++].stride = 0;
+  }
+
+  printf("{\n  \"allocs_counted\": %s,\n  \"results\": [\n",
+      COUNTING_ALLOCS ? "true" : "false");
+  for (int i = 0; i < ninputs; i++) {
+    for (size_t m = 0; m < sizeof(methods) / sizeof(methods[0]); m++) {
+      run(methods[m].name, methods[m].method, &inputs[i], &first);
+    }
+  }
+  printf("\n  ]\n}\n");
+  return 0;
+}
@@ -0,0 +1,100 @@
+/*
+ * Compares the table-driven z80_decode() against the switch-tree
+ * z80_decode_switch() over a random 64 KiB image and over every opcode
+ * on every prefix page.
+ *
+ *   cc -O2 -I.. -o decode_bench decode_bench.c ../z80dasm.c
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "z80dasm.h"
+
+#define IMAGE_SIZE 65536
+#define ROUNDS 50
+
+typedef int (*Decoder)(const uint8_t* mem, Z80_OpCode* opcode);
+
+static uint8_t s_image[IMAGE_SIZE + 4];
+static uint8_t s_opcodes[7 * 256][8];
+static volatile unsigned s_sink;
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void fillImage(void) {
+  uint32_t seed = 0x2545f491;
+  for (int i = 0; i < IMAGE_SIZE; i++) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    s_image[i] = (uint8_t) seed;
+  }
+}
+
+static void fillOpcodes(void) {
+  static const uint8_t prefixes[7][2] = {
+    { 0, 0 }, { 0xcb, 0 }, { 0xed, 0 }, { 0xdd, 0 }, { 0xfd, 0 },
+    { 0xdd, 0xcb }, { 0xfd, 0xcb }
+  };
+  for (int page = 0; page < 7; page++) {
+    for (int op = 0; op < 256; op++) {
+      uint8_t* mem = s_opcodes[page * 256 + op];
+      int n = 0;
+      if (prefixes[page][0] != 0) mem[n++] = prefixes[page][0];
+      if (prefixes[page][1] != 0) mem[n++] = prefixes[page][1];
+      if (page >= 5) mem[n++] = 0x05;
+      mem[n++] = (uint8_t) op;
+      while (n < 8) mem[n++] = 0x34;
+    }
+  }
+}
+
+static double sweepImage(Decoder decode, long* count) {
+  Z80_OpCode opcode;
+  double start = now();
+  *count = 0;
+  for (int round = 0; round < ROUNDS; round++) {
+    int pc = 0;
+    while (pc < IMAGE_SIZE) {
+      int len = decode(s_image + pc, &opcode);
+      pc += len != 0 ? len : 1;
+      s_sink += opcode.operation;
+      (*count)++;
+    }
+  }
+  return now() - start;
+}
+
+static double sweepOpcodes(Decoder decode, long* count) {
+  Z80_OpCode opcode;
+  double start = now();
+  *count = 0;
+  for (int round = 0; round < ROUNDS * 20; round++) {
+    for (int i = 0; i < 7 * 256; i++) {
+      s_sink += decode(s_opcodes[i], &opcode);
+      (*count)++;
+    }
+  }
+  return now() - start;
+}
+
+static void report(const char* input, double (*sweep)(Decoder, long*)) {
+  long count;
+  double t_switch = sweep(z80_decode_switch, &count) / count;
+  double t_table = sweep(z80_decode, &count) / count;
+  printf("%-10s switch %6.2f ns/insn  table %6.2f ns/insn  speedup %.2fx\n",
+      input, t_switch, t_table, t_switch / t_table);
+}
+
+int main(void) {
+  fillImage();
+  fillOpcodes();
+  report("random", sweepImage);
+  report("opcodes", sweepOpcodes);
+  return 0;
+}
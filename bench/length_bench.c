@@ -0,0 +1,101 @@
+/*
+ * Compares z80_length() and the bounded z80_length_avail() against the
+ * full z80_disassemble()/z80_free() path and the allocation-free
+ * z80_decode() over a random 64 KiB image, both sweeping instruction
+ * boundaries and probing every address. On the dev box the probe, where
+ * lookups are independent, runs about 10x the disassemble path but only
+ * 5x z80_decode(); in the sweep each lookup waits on the previous length
+ * and the gain drops to about 2.5x and 1.5x. So the tables reach an order
+ * of magnitude only over the allocating path, and only when probing.
+ *
+ *   cc -O2 -I.. -o length_bench length_bench.c ../z80dasm.c
+ */
+#include <stdio.h>
+#include <time.h>
+
+#include "z80dasm.h"
+
+#define IMAGE_SIZE 65536
+#define ROUNDS 50
+
+static uint8_t s_image[IMAGE_SIZE + 8];
+static volatile unsigned s_sink;
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int lengthDisassemble(const uint8_t* mem) {
+  Z80_OpCode* opcode = z80_disassemble((uint8_t*) mem);
+  int len = 0;
+  if (opcode != NULL) {
+    len = opcode->len;
+    z80_free(opcode);
+  }
+  return len;
+}
+
+static int lengthDecode(const uint8_t* mem) {
+  Z80_OpCode opcode;
+  return z80_decode(mem, &opcode);
+}
+
+static int lengthAvail(const uint8_t* mem) {
+  return z80_length_avail(mem, (size_t) (s_image + IMAGE_SIZE - mem));
+}
+
+static double sweep(int (*length)(const uint8_t*)) {
+  long count = 0;
+  double start = now();
+  for (int round = 0; round < ROUNDS; round++) {
+    int pc = 0;
+    while (pc < IMAGE_SIZE) {
+      int len = length(s_image + pc);
+      pc += len != 0 ? len : 1;
+      count++;
+    }
+    s_sink += pc;
+  }
+  return (now() - start) / count;
+}
+
+/* length at every address: independent lookups, as when stepping */
+static double probe(int (*length)(const uint8_t*)) {
+  long count = 0;
+  unsigned sum = 0;
+  double start = now();
+  for (int round = 0; round < ROUNDS; round++) {
+    for (int pc = 0; pc < IMAGE_SIZE; pc++) {
+      sum += length(s_image + pc);
+      count++;
+    }
+  }
+  s_sink += sum;
+  return (now() - start) / count;
+}
+
+static void report(const char* mode, double (*run)(int (*)(const uint8_t*))) {
+  double t_disassemble = run(lengthDisassemble);
+  double t_decode = run(lengthDecode);
+  double t_length = run(z80_length);
+  double t_avail = run(lengthAvail);
+  printf("%-6s disassemble %6.2f  decode %6.2f  length %6.2f  avail %6.2f"
+      " ns/insn  (%.1fx vs disassemble, %.1fx vs decode)\n", mode,
+      t_disassemble, t_decode, t_length, t_avail, t_disassemble / t_length,
+      t_decode / t_length);
+}
+
+int main(void) {
+  uint32_t seed = 0x2545f491;
+  for (int i = 0; i < IMAGE_SIZE; i++) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    s_image[i] = (uint8_t) seed;
+  }
+  report("sweep", sweep);
+  report("probe", probe);
+  return 0;
+}
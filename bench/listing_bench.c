@@ -0,0 +1,139 @@
+/*
+ * Measures patching a Z80_Listing of a random 64 KiB image against
+ * sweeping the image again, for single-byte pokes and for 16-bit stores
+ * like those updating a vector table, and checks as it goes that the
+ * listing matches a fresh sweep. Writes the results to stdout as JSON.
+ *
+ *   cc -O2 -I.. -I../host -o listing_bench listing_bench.c \
+ *       ../host/z80listing.c ../z80dasm.c
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "z80listing.h"
+
+#define IMAGE_SIZE 65536
+#define PATCHES 20000
+#define CHECK_EVERY 97
+#define SWEEPS 20
+
+static uint8_t s_image[IMAGE_SIZE];
+static Z80_Line s_lines[IMAGE_SIZE];
+static uint32_t s_seed = 0x2545f491;
+
+/* changes seen through notifications */
+static uint64_t s_changes;
+static uint64_t s_changed_lines;
+static int64_t s_line_delta;
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static uint32_t next(void) {
+  s_seed ^= s_seed << 13;
+  s_seed ^= s_seed >> 17;
+  s_seed ^= s_seed << 5;
+  return s_seed;
+}
+
+static void changed(void* ctx, const Z80_ListingChange* change) {
+  (void) ctx;
+  s_changes++;
+  s_changed_lines += change->added;
+  s_line_delta += (int64_t) change->added - (int64_t) change->removed;
+}
+
+static int sameLine(const Z80_Line* a, const Z80_Line* b) {
+  if (a->addr != b->addr || a->status != b->status ||
+      a->opcode.len != b->opcode.len) {
+    return 0;
+  }
+  if (a->status != ds_Ok) return 1;
+  if (a->opcode.operation != b->opcode.operation ||
+      a->opcode.argc != b->opcode.argc) {
+    return 0;
+  }
+  for (int i = 0; i < a->opcode.argc; i++) {
+    const Z80_Arg* x = &a->opcode.args[i];
+    const Z80_Arg* y = &b->opcode.args[i];
+    if (x->flags != y->flags || x->v != y->v ||
+        x->displacement != y->displacement) {
+      return 0;
+    }
+  }
+  return 1;
+}
+
+/* whether listing matches a fresh sweep of the image */
+static int check(const Z80_Listing* listing) {
+  size_t n = z80_disassemble_range(s_image, IMAGE_SIZE, 0, s_lines, IMAGE_SIZE,
+      NULL);
+  const Z80_Line* line = z80_listing_at(listing, 0);
+  if (n != listing->count) return 0;
+  for (size_t i = 0; i < n; i++, line = z80_listing_next(listing, line)) {
+    if (line == NULL || !sameLine(line, &s_lines[i])) {
+      return 0;
+    }
+  }
+  return line == NULL;
+}
+
+/* applies PATCHES stores of width bytes, returning the ns per patch */
+static double patch(Z80_Listing* listing, int width, uint64_t* decoded) {
+  double total = 0;
+  uint64_t before = listing->decoded;
+  for (int i = 0; i < PATCHES; i++) {
+    uint16_t addr = (uint16_t) next();
+    double start;
+    if (addr > IMAGE_SIZE - width) addr = (uint16_t) (IMAGE_SIZE - width);
+    for (int j = 0; j < width; j++) s_image[addr + j] = (uint8_t) next();
+    start = now();
+    z80_listing_patch(listing, addr, (size_t) width);
+    total += now() - start;
+    if (i % CHECK_EVERY == 0 && !check(listing)) return -1;
+  }
+  *decoded = listing->decoded - before;
+  return check(listing) ? total / PATCHES : -1;
+}
+
+int main(void) {
+  Z80_Listing listing;
+  uint64_t poke_decoded, store_decoded;
+  double sweep, poke, store;
+  size_t count;
+
+  for (size_t i = 0; i < IMAGE_SIZE; i++) s_image[i] = (uint8_t) next();
+  sweep = now();
+  for (int i = 0; i < SWEEPS; i++) {
+    if (i != 0) z80_listing_free(&listing);
+    if (z80_listing_init(&listing, s_image, IMAGE_SIZE, 0, changed, NULL) != 0) {
+      fprintf(stderr, "listing_bench: out of memory\n");
+      return 1;
+    }
+  }
+  sweep = (now() - sweep) / SWEEPS;
+  count = listing.count;
+
+  if ((poke = patch(&listing, 1, &poke_decoded)) < 0 ||
+      (store = patch(&listing, 2, &store_decoded)) < 0 ||
+      (int64_t) listing.count - (int64_t) count != s_line_delta) {
+    fprintf(stderr, "listing_bench: listing differs from a fresh sweep\n");
+    return 1;
+  }
+
+  printf("{\n  \"image_bytes\": %d,\n  \"lines\": %zu,\n"
+      "  \"sweep_ns\": %.0f,\n  \"poke_ns\": %.1f,\n"
+      "  \"poke_lines_decoded\": %.2f,\n  \"store_ns\": %.1f,\n"
+      "  \"store_lines_decoded\": %.2f,\n  \"notifications\": %llu,\n"
+      "  \"notified_lines\": %llu,\n  \"speedup\": %.0f\n}\n", IMAGE_SIZE,
+      listing.count, sweep, poke, (double) poke_decoded / PATCHES, store,
+      (double) store_decoded / PATCHES, (unsigned long long) s_changes,
+      (unsigned long long) s_changed_lines, sweep / poke);
+  z80_listing_free(&listing);
+  return 0;
+}
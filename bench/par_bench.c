@@ -0,0 +1,84 @@
+/*
+ * Measures how listing a set of random 64 KiB images scales with the
+ * number of z80_par_list() workers, and checks that every thread count
+ * produces the serial listing byte for byte.
+ *
+ *   cc -O2 -I.. -I../host -o par_bench par_bench.c ../z80dasm.c \
+ *       ../host/z80list.c ../host/z80par.c ../host/z80pool.c -lpthread
+ */
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+
+#include "z80par.h"
+#include "z80pool.h"
+
+#define IMAGES 64
+#define IMAGE_SIZE 65536
+
+static uint8_t s_images[IMAGES][IMAGE_SIZE];
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void fillImages(void) {
+  uint32_t seed = 0x2545f491;
+  for (int i = 0; i < IMAGES; i++) {
+    for (int j = 0; j < IMAGE_SIZE; j++) {
+      seed ^= seed << 13;
+      seed ^= seed >> 17;
+      seed ^= seed << 5;
+      s_images[i][j] = (uint8_t) seed;
+    }
+  }
+}
+
+int main(int argc, char** argv) {
+  static Z80_Region regions[IMAGES * 64];
+  int max_threads = argc > 1 ? atoi(argv[1]) : z80_pool_default_threads();
+  size_t n = 0;
+  Z80_Buf serial;
+  double t_serial = 0;
+
+  fillImages();
+  /* split the images too, so a few slow regions cannot stall a worker */
+  for (int i = 0; i < IMAGES; i++) {
+    n += z80_par_split(s_images[i], IMAGE_SIZE, 0, 16384, regions + n,
+        sizeof(regions) / sizeof(regions[0]) - n);
+  }
+
+  /* warm up the allocator and caches before timing */
+  z80_buf_init(&serial);
+  z80_par_list(regions, n, 1, fmt_Zilog, &serial);
+  z80_buf_free(&serial);
+
+  for (int threads = 1; threads <= max_threads; threads *= 2) {
+    Z80_Buf out;
+    double start, elapsed;
+    z80_buf_init(&out);
+    start = now();
+    if (z80_par_list(regions, n, threads, fmt_Zilog, &out) != 0) {
+      fprintf(stderr, "par_bench: out of memory\n");
+      return 1;
+    }
+    elapsed = now() - start;
+    if (threads == 1) {
+      serial = out;
+      t_serial = elapsed;
+    }
+    else {
+      if (out.len != serial.len || memcmp(out.data, serial.data, out.len) != 0) {
+        fprintf(stderr, "par_bench: %d threads changed the listing\n", threads);
+        return 1;
+      }
+      z80_buf_free(&out);
+    }
+    printf("threads %3d  %8.2f ms  %7.1f MB/s  speedup %.2fx\n", threads,
+        elapsed / 1e6, serial.len / (elapsed / 1e3), t_serial / elapsed);
+  }
+  z80_buf_free(&serial);
+  return 0;
+}
@@ -0,0 +1,172 @@
+/*
+ * Measures the cost of profiling with z80_prof_step() over the programs
+ * trace_bench.c uses: a countdown, a checksum over memory and a call-heavy
+ * loop. Each is run plainly and then profiled, and the profile is checked
+ * against the run: every step and T-state counted, and for the call-heavy
+ * loop every call to the subroutine paired with its return. Writes the
+ * results to stdout as JSON.
+ *
+ *   cc -O2 -I.. -I../host -o prof_bench prof_bench.c ../host/z80emu.c \
+ *       ../host/z80prof.c ../host/z80sym.c ../z80dasm.c
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "z80prof.h"
+
+/* the subroutine s_calls calls, and how often */
+#define SUB 0x13
+#define SUB_CALLS (16 * 256 * 256)
+
+typedef struct {
+  const char* name;
+  const uint8_t* code;
+  size_t len;
+} Program;
+
+static const uint8_t s_countdown[] = {
+  0x31, 0x00, 0x00,       /* LD SP,0 */
+  0x06, 0x28,             /* LD B,40 */
+  0x11, 0x00, 0x00,       /* LD DE,0 */
+  0x1b,                   /* DEC DE */
+  0x7a,                   /* LD A,D */
+  0xb3,                   /* OR E */
+  0x20, 0xfb,             /* JR NZ,$-3 */
+  0x10, 0xf6,             /* DJNZ $-8 */
+  0x76                    /* HALT */
+};
+
+static const uint8_t s_checksum[] = {
+  0x16, 0x20,             /* LD D,32 */
+  0x21, 0x00, 0x00,       /* LD HL,0 */
+  0x7e,                   /* LD A,(HL) */
+  0x81,                   /* ADD A,C */
+  0x4f,                   /* LD C,A */
+  0x23,                   /* INC HL */
+  0x7c,                   /* LD A,H */
+  0xb5,                   /* OR L */
+  0x20, 0xf8,             /* JR NZ,$-6 */
+  0x15,                   /* DEC D */
+  0x20, 0xf5,             /* JR NZ,$-9 */
+  0x76                    /* HALT */
+};
+
+static const uint8_t s_calls[] = {
+  0x31, 0x00, 0x00,       /* LD SP,0 */
+  0x16, 0x10,             /* LD D,16 */
+  0x1e, 0x00,             /* LD E,0 */
+  0xcd, 0x13, 0x00,       /* CALL sub */
+  0x10, 0xfb,             /* DJNZ $-3 */
+  0x1d,                   /* DEC E */
+  0x20, 0xf8,             /* JR NZ,$-6 */
+  0x15,                   /* DEC D */
+  0x20, 0xf5,             /* JR NZ,$-9 */
+  0x76,                   /* HALT */
+  0xc5,                   /* sub: PUSH BC */
+  0xd9,                   /* EXX */
+  0x08,                   /* EX AF,AF' */
+  0x23,                   /* INC HL */
+  0x3c,                   /* INC A */
+  0x08,                   /* EX AF,AF' */
+  0xd9,                   /* EXX */
+  0xdd, 0x23,             /* INC IX */
+  0xc1,                   /* POP BC */
+  0xc9                    /* RET */
+};
+
+static uint8_t s_mem[Z80_MEM_SIZE];
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void load(Z80_CPU* cpu, const Program* program) {
+  memset(s_mem, 0, sizeof(s_mem));
+  memcpy(s_mem, program->code, program->len);
+  z80_cpu_init(cpu, s_mem, NULL, NULL, NULL);
+}
+
+/* runs to the final halt, returning the ns taken and the steps in *steps */
+static double runPlain(const Program* program, uint64_t* steps) {
+  Z80_CPU cpu;
+  double start;
+  load(&cpu, program);
+  *steps = 0;
+  start = now();
+  while (!z80_cpu_stopped(&cpu)) {
+    z80_cpu_step(&cpu);
+    (*steps)++;
+  }
+  return now() - start;
+}
+
+/* as runPlain(), profiling into prof, with the T-states run in *cycles */
+static double runProfiled(const Program* program, Z80_Prof* prof,
+    uint64_t* cycles) {
+  Z80_CPU cpu;
+  double start;
+  load(&cpu, program);
+  z80_prof_init(prof);
+  start = now();
+  while (!z80_cpu_stopped(&cpu)) {
+    z80_prof_step(prof, &cpu);
+    z80_cpu_step(&cpu);
+  }
+  z80_prof_step(prof, &cpu);
+  *cycles = cpu.cycles;
+  return now() - start;
+}
+
+/* whether prof accounts for steps steps and cycles T-states */
+static int checkProfile(const Z80_Prof* prof, const Program* program,
+    uint64_t steps, uint64_t cycles) {
+  uint64_t counted = 0, spent = 0;
+  for (uint32_t addr = 0; addr < Z80_MEM_SIZE; addr++) {
+    counted += prof->count[addr];
+    spent += prof->cycles[addr];
+  }
+  if (counted != steps || spent != cycles || prof->depth != 0) return 0;
+  if (program->code == s_calls) {
+    return prof->calls[SUB] == SUB_CALLS && prof->inclusive[SUB] != 0;
+  }
+  return 1;
+}
+
+int main(void) {
+  static const Program programs[] = {
+    { "countdown", s_countdown, sizeof(s_countdown) },
+    { "checksum", s_checksum, sizeof(s_checksum) },
+    { "calls", s_calls, sizeof(s_calls) }
+  };
+  Z80_Prof* prof = (Z80_Prof*) malloc(sizeof(Z80_Prof));
+
+  if (prof == NULL) {
+    fprintf(stderr, "prof_bench: out of memory\n");
+    return 1;
+  }
+  printf("{\n  \"results\": [\n");
+  for (size_t i = 0; i < sizeof(programs) / sizeof(programs[0]); i++) {
+    const Program* program = &programs[i];
+    uint64_t steps, cycles;
+    double plain = runPlain(program, &steps);
+    double profiled = runProfiled(program, prof, &cycles);
+
+    if (!checkProfile(prof, program, steps, cycles)) {
+      fprintf(stderr, "prof_bench: %s: profile does not match the run\n",
+          program->name);
+      return 1;
+    }
+    printf("    {\"program\": \"%s\", \"steps\": %llu, \"ns_per_step\": %.2f, "
+        "\"profiled_ns_per_step\": %.2f, \"overhead\": %.2f}%s\n",
+        program->name, (unsigned long long) steps, plain / steps,
+        profiled / steps, profiled / plain,
+        i + 1 < sizeof(programs) / sizeof(programs[0]) ? "," : "");
+  }
+  printf("  ]\n}\n");
+  free(prof);
+  return 0;
+}
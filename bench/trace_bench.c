@@ -0,0 +1,186 @@
+/*
+ * Measures the cost of recording a binary trace with z80_trace_step()
+ * and the size of the result, over three small programs: a countdown, a
+ * checksum over memory and a call-heavy loop that swaps register sets.
+ * Each is run plainly, then traced to a temporary file, which is then read
+ * back and disassembled from the mapping. Writes the results to stdout as
+ * JSON.
+ *
+ *   cc -O2 -I.. -I../host -o trace_bench trace_bench.c ../host/z80emu.c \
+ *       ../host/z80trace.c ../z80dasm.c
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "z80dasm.h"
+#include "z80trace.h"
+
+#define RING_BLOCKS 4
+
+typedef struct {
+  const char* name;
+  const uint8_t* code;
+  size_t len;
+} Program;
+
+static const uint8_t s_countdown[] = {
+  0x31, 0x00, 0x00,       /* LD SP,0 */
+  0x06, 0x28,             /* LD B,40 */
+  0x11, 0x00, 0x00,       /* LD DE,0 */
+  0x1b,                   /* DEC DE */
+  0x7a,                   /* LD A,D */
+  0xb3,                   /* OR E */
+  0x20, 0xfb,             /* JR NZ,$-3 */
+  0x10, 0xf6,             /* DJNZ $-8 */
+  0x76                    /* HALT */
+};
+
+static const uint8_t s_checksum[] = {
+  0x16, 0x20,             /* LD D,32 */
+  0x21, 0x00, 0x00,       /* LD HL,0 */
+  0x7e,                   /* LD A,(HL) */
+  0x81,                   /* ADD A,C */
+  0x4f,                   /* LD C,A */
+  0x23,                   /* INC HL */
+  0x7c,                   /* LD A,H */
+  0xb5,                   /* OR L */
+  0x20, 0xf8,             /* JR NZ,$-6 */
+  0x15,                   /* DEC D */
+  0x20, 0xf5,             /* JR NZ,$-9 */
+  0x76                    /* HALT */
+};
+
+static const uint8_t s_calls[] = {
+  0x31, 0x00, 0x00,       /* LD SP,0 */
+  0x16, 0x10,             /* LD D,16 */
+  0x1e, 0x00,             /* LD E,0 */
+  0xcd, 0x13, 0x00,       /* CALL sub */
+  0x10, 0xfb,             /* DJNZ $-3 */
+  0x1d,                   /* DEC E */
+  0x20, 0xf8,             /* JR NZ,$-6 */
+  0x15,                   /* DEC D */
+  0x20, 0xf5,             /* JR NZ,$-9 */
+  0x76,                   /* HALT */
+  0xc5,                   /* sub: PUSH BC */
+  0xd9,                   /* EXX */
+  0x08,                   /* EX AF,AF' */
+  0x23,                   /* INC HL */
+  0x3c,                   /* INC A */
+  0x08,                   /* EX AF,AF' */
+  0xd9,                   /* EXX */
+  0xdd, 0x23,             /* INC IX */
+  0xc1,                   /* POP BC */
+  0xc9                    /* RET */
+};
+
+static uint8_t s_mem[Z80_MEM_SIZE];
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void load(Z80_CPU* cpu, const Program* program) {
+  memset(s_mem, 0, sizeof(s_mem));
+  memcpy(s_mem, program->code, program->len);
+  z80_cpu_init(cpu, s_mem, NULL, NULL, NULL);
+}
+
+/* runs to the final halt, returning the ns taken and the steps in *steps */
+static double runPlain(const Program* program, uint64_t* steps) {
+  Z80_CPU cpu;
+  double start;
+  load(&cpu, program);
+  *steps = 0;
+  start = now();
+  while (!z80_cpu_stopped(&cpu)) {
+    z80_cpu_step(&cpu);
+    (*steps)++;
+  }
+  return now() - start;
+}
+
+static double runTraced(const Program* program, int fd, Z80_Trace* trace) {
+  Z80_CPU cpu;
+  double start;
+  load(&cpu, program);
+  if (z80_trace_init(trace, RING_BLOCKS, fd) != 0) return -1;
+  start = now();
+  while (!z80_cpu_stopped(&cpu)) {
+    z80_trace_step(trace, &cpu);
+    z80_cpu_step(&cpu);
+  }
+  if (z80_trace_finish(trace, &cpu) != 0) return -1;
+  return now() - start;
+}
+
+/* reads the trace at path back, disassembling every instruction */
+static double readBack(const char* path, uint64_t* steps) {
+  Z80_TraceReader reader;
+  Z80_TraceStep step;
+  Z80_Line line;
+  char text[64];
+  size_t total = 0;
+  double start;
+  int rc;
+
+  if (z80_trace_open(&reader, path) != 0) return -1;
+  *steps = 0;
+  start = now();
+  while ((rc = z80_trace_next(&reader, &step)) > 0) {
+    if (step.len != 0 &&
+        z80_disassemble_range(step.bytes, step.len, step.pc, &line, 1, NULL) == 1) {
+      total += z80_format(&line.opcode, text, sizeof(text));
+    }
+    (*steps)++;
+  }
+  start = now() - start;
+  z80_trace_close(&reader);
+  return rc == 0 && total != 0 ? start : -1;
+}
+
+int main(void) {
+  static const Program programs[] = {
+    { "countdown", s_countdown, sizeof(s_countdown) },
+    { "checksum", s_checksum, sizeof(s_checksum) },
+    { "calls", s_calls, sizeof(s_calls) }
+  };
+  char path[] = "/tmp/trace_benchXXXXXX";
+  int fd = mkstemp(path);
+
+  if (fd < 0) {
+    perror("trace_bench: mkstemp");
+    return 1;
+  }
+  printf("{\n  \"results\": [\n");
+  for (size_t i = 0; i < sizeof(programs) / sizeof(programs[0]); i++) {
+    const Program* program = &programs[i];
+    Z80_Trace trace;
+    uint64_t steps, read_steps;
+    double plain = runPlain(program, &steps);
+    double traced, read;
+
+    if (ftruncate(fd, 0) != 0 || lseek(fd, 0, SEEK_SET) != 0 ||
+        (traced = runTraced(program, fd, &trace)) < 0 ||
+        (read = readBack(path, &read_steps)) < 0 || read_steps != steps + 1) {
+      fprintf(stderr, "trace_bench: %s: trace failed\n", program->name);
+      unlink(path);
+      return 1;
+    }
+    printf("    {\"program\": \"%s\", \"steps\": %llu, \"ns_per_step\": %.2f, "
+        "\"traced_ns_per_step\": %.2f, \"bytes_per_step\": %.2f, "
+        "\"read_ns_per_step\": %.2f}%s\n", program->name,
+        (unsigned long long) steps, plain / steps, traced / steps,
+        (double) trace.bytes / steps, read / read_steps,
+        i + 1 < sizeof(programs) / sizeof(programs[0]) ? "," : "");
+    z80_trace_free(&trace);
+  }
+  printf("  ]\n}\n");
+  close(fd);
+  unlink(path);
+  return 0;
+}
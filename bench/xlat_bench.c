@@ -0,0 +1,260 @@
+/*
+ * Compares the interpreter with translated blocks (z80xlat.h) on five
+ * compute-bound programs: a countdown, a checksum over memory, a
+ * call-heavy loop that swaps register sets, a shift-and-add multiply and
+ * a Fletcher-style checksum that is mostly 8-bit arithmetic.
+ * When its path is given, the assembled supervisor is added, printing a
+ * long string with @puts in a loop through a Z80_Console on an infinitely
+ * fast line. Each is run interpreted, then translated, and must end in
+ * the same state. Writes the results to stdout as JSON.
+ *
+ *   make bench SUP_IMAGE=path/to/sup.bin
+ *
+ * or
+ *
+ *   cc -O2 -I.. -I../host -o xlat_bench xlat_bench.c ../host/z80con.c \
+ *       ../host/z80emu.c ../host/z80xlat.c ../z80dasm.c
+ *   ./xlat_bench [sup.bin]
+ */
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "z80con.h"
+#include "z80sup.h"
+#include "z80xlat.h"
+
+#define SLICE_CYCLES 1000000
+#define MAX_CYCLES 1000000000
+
+#define SVC_EXIT 0
+#define SVC_PUTS 4
+#define MESSAGE 0x1000
+#define MESSAGE_LEN 20000
+
+typedef struct {
+  const char* name;
+  const uint8_t* code;
+  size_t len;
+} Program;
+
+typedef struct {
+  Z80_CPU cpu;
+  uint64_t sent;
+  uint64_t hash;
+  double ns;
+} Result;
+
+static const uint8_t s_countdown[] = {
+  0x31, 0x00, 0x00,       /* LD SP,0 */
+  0x06, 0x28,             /* LD B,40 */
+  0x11, 0x00, 0x00,       /* LD DE,0 */
+  0x1b,                   /* DEC DE */
+  0x7a,                   /* LD A,D */
+  0xb3,                   /* OR E */
+  0x20, 0xfb,             /* JR NZ,$-3 */
+  0x10, 0xf6,             /* DJNZ $-8 */
+  0x76                    /* HALT */
+};
+
+static const uint8_t s_checksum[] = {
+  0x16, 0x20,             /* LD D,32 */
+  0x21, 0x00, 0x00,       /* LD HL,0 */
+  0x7e,                   /* LD A,(HL) */
+  0x81,                   /* ADD A,C */
+  0x4f,                   /* LD C,A */
+  0x23,                   /* INC HL */
+  0x7c,                   /* LD A,H */
+  0xb5,                   /* OR L */
+  0x20, 0xf8,             /* JR NZ,$-6 */
+  0x15,                   /* DEC D */
+  0x20, 0xf5,             /* JR NZ,$-9 */
+  0x76                    /* HALT */
+};
+
+static const uint8_t s_calls[] = {
+  0x31, 0x00, 0x00,       /* LD SP,0 */
+  0x16, 0x10,             /* LD D,16 */
+  0x1e, 0x00,             /* LD E,0 */
+  0xcd, 0x13, 0x00,       /* CALL sub */
+  0x10, 0xfb,             /* DJNZ $-3 */
+  0x1d,                   /* DEC E */
+  0x20, 0xf8,             /* JR NZ,$-6 */
+  0x15,                   /* DEC D */
+  0x20, 0xf5,             /* JR NZ,$-9 */
+  0x76,                   /* HALT */
+  0xc5,                   /* sub: PUSH BC */
+  0xd9,                   /* EXX */
+  0x08,                   /* EX AF,AF' */
+  0x23,                   /* INC HL */
+  0x3c,                   /* INC A */
+  0x08,                   /* EX AF,AF' */
+  0xd9,                   /* EXX */
+  0xdd, 0x23,             /* INC IX */
+  0xc1,                   /* POP BC */
+  0xc9                    /* RET */
+};
+
+static const uint8_t s_multiply[] = {
+  0x31, 0x00, 0x00,       /* LD SP,0 */
+  0x01, 0x00, 0x00,       /* LD BC,0 */
+  0x11, 0x34, 0x12,       /* loop: LD DE,0x1234 */
+  0x79,                   /* LD A,C */
+  0xcd, 0x13, 0x00,       /* CALL mul */
+  0x0b,                   /* DEC BC */
+  0x78,                   /* LD A,B */
+  0xb1,                   /* OR C */
+  0x20, 0xf4,             /* JR NZ,loop */
+  0x76,                   /* HALT */
+  0x21, 0x00, 0x00,       /* mul: LD HL,0 */
+  0xc5,                   /* PUSH BC */
+  0x06, 0x08,             /* LD B,8 */
+  0x29,                   /* ADD HL,HL */
+  0x17,                   /* RLA */
+  0x30, 0x01,             /* JR NC,$+3 */
+  0x19,                   /* ADD HL,DE */
+  0x10, 0xf9,             /* DJNZ $-5 */
+  0xc1,                   /* POP BC */
+  0xc9                    /* RET */
+};
+
+static const uint8_t s_fletcher[] = {
+  0x21, 0x00, 0x00,       /* LD HL,0 */
+  0x01, 0x00, 0x00,       /* LD BC,0 */
+  0x1e, 0x00,             /* LD E,0 */
+  0x16, 0x10,             /* LD D,16 */
+  0x7e,                   /* loop: LD A,(HL) */
+  0x81,                   /* ADD A,C */
+  0x4f,                   /* LD C,A */
+  0x80,                   /* ADD A,B */
+  0x47,                   /* LD B,A */
+  0x7b,                   /* LD A,E */
+  0xae,                   /* XOR (HL) */
+  0x5f,                   /* LD E,A */
+  0x2c,                   /* INC L */
+  0x20, 0xf5,             /* JR NZ,loop */
+  0x24,                   /* INC H */
+  0x20, 0xf2,             /* JR NZ,loop */
+  0x15,                   /* DEC D */
+  0x20, 0xef,             /* JR NZ,loop */
+  0x76                    /* HALT */
+};
+
+static const uint8_t s_putsLoop[] = {
+  0x06, 0x20,                                  /* LD B,32 */
+  0xc5,                                        /* PUSH BC */
+  0x21, MESSAGE & 0xff, MESSAGE >> 8,          /* LD HL,MESSAGE */
+  0x3e, SVC_PUTS,                              /* LD A,@puts */
+  0xef,                                        /* RST 0x28 */
+  0xc1,                                        /* POP BC */
+  0x10, 0xf6,                                  /* DJNZ $-8 */
+  0x3e, SVC_EXIT,                              /* LD A,@exit */
+  0xef                                         /* RST 0x28 */
+};
+
+static uint8_t s_mem[Z80_MEM_SIZE];
+static uint8_t s_sup[Z80_MEM_SIZE];
+static Z80_Xlat s_xlat;
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void sinkWrite(void* ctx, uint8_t c) {
+  Result* result = (Result*) ctx;
+  result->sent++;
+  result->hash = (result->hash ^ c) * 0x100000001b3ull;
+}
+
+/* runs program, or @puts on the supervisor if it is NULL, to its halt */
+static void run(const Program* program, int translate, Result* result) {
+  Z80_CPU* cpu = &result->cpu;
+  Z80_Console con;
+  double start;
+
+  memset(result, 0, sizeof(*result));
+  if (program != NULL) {
+    memset(s_mem, 0, sizeof(s_mem));
+    memcpy(s_mem, program->code, program->len);
+  }
+  else {
+    memcpy(s_mem, s_sup, sizeof(s_mem));
+    memcpy(s_mem + Z80_SUP_USER_PROG, s_putsLoop, sizeof(s_putsLoop));
+    for (int i = 0; i < MESSAGE_LEN; i++) {
+      s_mem[MESSAGE + i] = i % 64 == 63 ? '\n' : (uint8_t) ('0' + i % 64);
+    }
+    s_mem[MESSAGE + MESSAGE_LEN] = 0;
+  }
+  z80_cpu_init(cpu, s_mem, NULL, NULL, NULL);
+  z80_con_init(&con, cpu, NULL, sinkWrite, result);
+  if (translate) {
+    z80_xlat_init(&s_xlat, s_mem);
+    z80_xlat_attach(&s_xlat, cpu);
+  }
+  start = now();
+  while (!z80_cpu_stopped(cpu) && cpu->cycles < MAX_CYCLES) {
+    if (program != NULL) z80_cpu_run(cpu, SLICE_CYCLES);
+    else if (z80_con_run(&con, SLICE_CYCLES) == 0) break;
+  }
+  result->ns = now() - start;
+}
+
+int main(int argc, char** argv) {
+  static const Program programs[] = {
+    { "countdown", s_countdown, sizeof(s_countdown) },
+    { "checksum", s_checksum, sizeof(s_checksum) },
+    { "calls", s_calls, sizeof(s_calls) },
+    { "multiply", s_multiply, sizeof(s_multiply) },
+    { "fletcher", s_fletcher, sizeof(s_fletcher) }
+  };
+  size_t count = sizeof(programs) / sizeof(programs[0]);
+
+  if (argc > 1) {
+    FILE* fp = fopen(argv[1], "rb");
+    if (fp == NULL) {
+      perror(argv[1]);
+      return 1;
+    }
+    if (fread(s_sup, 1, sizeof(s_sup), fp) <= Z80_SUP_USER_PROG) {
+      fprintf(stderr, "xlat_bench: %s: too short\n", argv[1]);
+      return 1;
+    }
+    fclose(fp);
+    count++;
+  }
+
+  printf("{\n  \"results\": [\n");
+  for (size_t i = 0; i < count; i++) {
+    const Program* program = i < sizeof(programs) / sizeof(programs[0])
+        ? &programs[i] : NULL;
+    static uint8_t interp_mem[Z80_MEM_SIZE];
+    Result interp, xlat;
+
+    run(program, 0, &interp);
+    memcpy(interp_mem, s_mem, sizeof(s_mem));
+    run(program, 1, &xlat);
+    if (memcmp(&interp.cpu, &xlat.cpu, offsetof(Z80_CPU, run_end)) != 0 ||
+        memcmp(interp_mem, s_mem, sizeof(s_mem)) != 0 ||
+        interp.sent != xlat.sent || interp.hash != xlat.hash) {
+      fprintf(stderr, "xlat_bench: %s: translated run differs\n",
+          program != NULL ? program->name : "sup_puts");
+      return 1;
+    }
+    printf("    {\"program\": \"%s\", \"t_states\": %llu, \"sent\": %llu, "
+        "\"interp_mhz\": %.1f, \"xlat_mhz\": %.1f, \"speedup\": %.2f, "
+        "\"blocks\": %llu, \"block_runs\": %llu, \"interpreted\": %llu}%s\n",
+        program != NULL ? program->name : "sup_puts",
+        (unsigned long long) xlat.cpu.cycles, (unsigned long long) xlat.sent,
+        interp.cpu.cycles / interp.ns * 1e3, xlat.cpu.cycles / xlat.ns * 1e3,
+        interp.ns / xlat.ns, (unsigned long long) s_xlat.translated,
+        (unsigned long long) s_xlat.runs, (unsigned long long) s_xlat.steps,
+        i + 1 < count ? "," : "");
+    z80_xlat_free(&s_xlat);
+  }
+  printf("  ]\n}\n");
+  return 0;
+}
@@ -0,0 +1,179 @@
+/*
+ * Measures building a cross-reference index of a random 64 KiB image and,
+ * when its path is given, the assembled supervisor image, and looking up
+ * the references to every address in it. Checks the index against the
+ * jumps, calls and memory operands a plain sweep finds. Writes the results
+ * to stdout as JSON.
+ *
+ *   make bench SUP_IMAGE=path/to/sup.bin
+ *
+ * or
+ *
+ *   cc -O2 -I.. -I../host -o xref_bench xref_bench.c ../host/z80xref.c \
+ *       ../z80dasm.c
+ *   ./xref_bench [sup.bin]
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "z80xref.h"
+
+#define IMAGE_SIZE 65536
+#define BUILDS 50
+#define QUERY_PASSES 20
+
+static uint8_t s_image[IMAGE_SIZE];
+static uint8_t s_sup[IMAGE_SIZE];
+static Z80_Line s_lines[IMAGE_SIZE];
+static volatile size_t s_sink;
+
+static const char* s_kinds[] = {
+  "call", "jump", "read", "write", "rst", "address"
+};
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+/* whether xrefs holds a reference of kind from from to to */
+static int has(const Z80_Xrefs* xrefs, uint16_t to, uint16_t from, int kind) {
+  size_t n;
+  const Z80_Xref* refs = z80_xref_to(xrefs, to, &n);
+  for (size_t i = 0; i < n; i++) {
+    if (refs[i].from == from && refs[i].kind == kind) return 1;
+  }
+  return 0;
+}
+
+/*
+ * Whether every branch, call, RST and (nn) operand of a sweep over mem is
+ * in xrefs, and nothing else.
+ */
+static int check(const Z80_Xrefs* xrefs, const uint8_t* mem, size_t len) {
+  size_t n = z80_disassemble_range(mem, len, 0, s_lines, IMAGE_SIZE, NULL);
+  size_t expected = 0;
+  for (size_t i = 0; i < n; i++) {
+    const Z80_OpCode* opcode = &s_lines[i].opcode;
+    const Z80_Arg* last;
+    uint16_t from = s_lines[i].addr;
+    int kind = -1;
+    if (s_lines[i].status != ds_Ok || opcode->argc == 0) continue;
+    last = &opcode->args[opcode->argc - 1];
+    switch (opcode->operation) {
+      case op_CALL:
+        kind = xr_Call;
+        break;
+      case op_JP:
+      case op_JR:
+      case op_DJNZ:
+        if ((last->flags & am_Register) == 0) kind = xr_Jump;
+        break;
+      case op_RST:
+        kind = xr_Rst;
+        break;
+      case op_LD:
+        if (opcode->args[0].flags == (am_Immediate | am_Extended | am_Indirect)) {
+          last = &opcode->args[0];
+          kind = xr_Write;
+        }
+        else if (last->flags == (am_Immediate | am_Extended | am_Indirect)) {
+          kind = xr_Read;
+        }
+        else if (last->flags == (am_Immediate | am_Extended)) {
+          kind = xr_Address;
+        }
+        break;
+      default:
+        break;
+    }
+    if (kind < 0) continue;
+    if (!has(xrefs, last->v, from, kind)) return 0;
+    expected++;
+  }
+  return expected == xrefs->count;
+}
+
+static int measure(const char* name, const uint8_t* mem, size_t len, int last) {
+  Z80_Xrefs* xrefs = (Z80_Xrefs*) malloc(sizeof(Z80_Xrefs));
+  size_t by_kind[xr_Address + 1] = { 0 };
+  double build, query;
+  size_t total = 0;
+
+  if (xrefs == NULL) {
+    fprintf(stderr, "xref_bench: out of memory\n");
+    return -1;
+  }
+  build = now();
+  for (int i = 0; i < BUILDS; i++) {
+    if (i != 0) z80_xref_free(xrefs);
+    if (z80_xref_build(xrefs, mem, len, 0) != 0) {
+      fprintf(stderr, "xref_bench: out of memory\n");
+      return -1;
+    }
+  }
+  build = (now() - build) / BUILDS;
+  if (!check(xrefs, mem, len)) {
+    fprintf(stderr, "xref_bench: %s: index does not match a sweep\n", name);
+    return -1;
+  }
+
+  query = now();
+  for (int pass = 0; pass < QUERY_PASSES; pass++) {
+    for (uint32_t addr = 0; addr < IMAGE_SIZE; addr++) {
+      size_t n;
+      const Z80_Xref* refs = z80_xref_to(xrefs, (uint16_t) addr, &n);
+      for (size_t i = 0; i < n; i++) total += refs[i].from;
+    }
+  }
+  query = (now() - query) / QUERY_PASSES / IMAGE_SIZE;
+  s_sink = total;
+  for (size_t i = 0; i < xrefs->count; i++) by_kind[xrefs->refs[i].kind]++;
+
+  printf("    {\"image\": \"%s\", \"bytes\": %zu, \"refs\": %zu, "
+      "\"build_ms\": %.3f, \"query_ns\": %.1f", name, len, xrefs->count,
+      build / 1e6, query);
+  for (int kind = 0; kind <= xr_Address; kind++) {
+    printf(", \"%s\": %zu", s_kinds[kind], by_kind[kind]);
+  }
+  printf("}%s\n", last ? "" : ",");
+  z80_xref_free(xrefs);
+  free(xrefs);
+  return 0;
+}
+
+int main(int argc, char** argv) {
+  uint32_t seed = 0x2545f491;
+  size_t sup_len = 0;
+
+  if (argc > 2) {
+    fprintf(stderr, "usage: xref_bench [sup.bin]\n");
+    return 1;
+  }
+  for (size_t i = 0; i < IMAGE_SIZE; i++) {
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    s_image[i] = (uint8_t) seed;
+  }
+  if (argc == 2) {
+    FILE* fp = fopen(argv[1], "rb");
+    if (fp == NULL) {
+      perror(argv[1]);
+      return 1;
+    }
+    sup_len = fread(s_sup, 1, sizeof(s_sup), fp);
+    fclose(fp);
+  }
+
+  printf("{\n  \"results\": [\n");
+  if (measure("random", s_image, IMAGE_SIZE, sup_len == 0) != 0 ||
+      (sup_len != 0 && measure("sup", s_sup, sup_len, 1) != 0)) {
+    return 1;
+  }
+  printf("  ]\n}\n");
+  return 0;
+}
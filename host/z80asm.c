@@ -0,0 +1,922 @@
+#include <stdarg.h>
+#include <string.h>
+
+#include "z80asm.h"
+
+#define MAX_OPERANDS 2
+#define PAGES 7
+#define LEVELS 6
+#define IMAGE_END 0x10000
+#define INITIAL_SYMBOLS 64
+
+/*
+ * Operand shapes: the class in the high byte and, for registers, flags
+ * and the numbers RST, IM and BIT build into the opcode, the value in
+ * the low. A key combines the operation with the shape of each operand,
+ * so the operand values an encoding leaves out are not part of it.
+ */
+enum {
+  sh_Reg = 1,
+  sh_RegInd,
+  sh_Indexed,
+  sh_Flag,
+  sh_Literal,
+  sh_Value,
+  sh_ValueInd
+};
+
+#define SHAPE(kind, v) ((uint32_t) (kind) << 8 | (uint32_t) (v))
+
+enum {
+  dir_Org,
+  dir_Equ,
+  dir_Defb,
+  dir_Defw,
+  dir_Defs,
+  dir_End
+};
+
+typedef struct {
+  uint32_t shape;
+  int32_t value;
+  int32_t disp;
+} Operand;
+
+typedef struct {
+  const char* p;
+  const char* end;
+} Cursor;
+
+/* the state of one pass over the source */
+typedef struct {
+  Z80_Asm* as;
+  uint8_t* image;
+  int pass;
+  uint32_t pc;
+  /* set when an expression refers to a symbol with no value yet */
+  int unknown;
+} Pass;
+
+/* prefixes of the decoder's pages; DDCB and FDCB take a displacement next */
+static const uint8_t s_prefixes[PAGES][2] = {
+  { 0, 0 }, { 0xcb, 0 }, { 0xed, 0 }, { 0xdd, 0 }, { 0xfd, 0 },
+  { 0xdd, 0xcb }, { 0xfd, 0xcb }
+};
+static const int s_prefixLen[PAGES] = { 0, 1, 1, 1, 1, 2, 2 };
+
+/* indexed by Z80_Operand from reg_A */
+static const char* const s_registers[] = {
+  "a", "b", "c", "d", "e", "h", "l", "af", "bc", "de", "hl", "sp", "ix", "iy",
+  "af'", "i", "r"
+};
+
+/* indexed by Z80_Operand from fl_NZ; C is read as a register first */
+static const char* const s_flags[] = {
+  "nz", "z", "nc", "", "po", "pe", "p", "m"
+};
+
+static const char* const s_directives[] = {
+  "org", "equ", "defb", "db", "defm", "defw", "dw", "defs", "ds", "end"
+};
+static const int s_directiveKinds[] = {
+  dir_Org, dir_Equ, dir_Defb, dir_Defb, dir_Defb, dir_Defw, dir_Defw,
+  dir_Defs, dir_Defs, dir_End
+};
+
+/* binary operators by precedence, loosest first; "<" and ">" stand for shifts */
+static const char* const s_operators[LEVELS] = {
+  "|", "^", "&", "<>", "+-", "*/%"
+};
+
+static int fail(Pass* ps, const char* format, ...) {
+  va_list ap;
+  va_start(ap, format);
+  vsnprintf(ps->as->error, sizeof(ps->as->error), format, ap);
+  va_end(ap);
+  return -1;
+}
+
+static char lower(char c) {
+  return c >= 'A' && c <= 'Z' ? (char) (c + 'a' - 'A') : c;
+}
+
+static int isSpace(char c) {
+  return c == ' ' || c == '\t';
+}
+
+static int isDigit(char c) {
+  return c >= '0' && c <= '9';
+}
+
+static int isNameStart(char c) {
+  return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')
+      || c == '_' || c == '.' || c == '@' || c == '?';
+}
+
+static int isNameChar(char c) {
+  return isNameStart(c) || isDigit(c) || c == '$';
+}
+
+static int digitValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+/* whether the len characters at s are word, ignoring case */
+static int sameWord(const char* s, size_t len, const char* word) {
+  size_t i;
+  for (i = 0; i < len && word[i] != '\0'; i++) {
+    if (lower(s[i]) != lower(word[i])) return 0;
+  }
+  return i == len && word[i] == '\0';
+}
+
+static uint32_t hashName(const char* s, size_t len) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; i++) {
+    h ^= (uint8_t) s[i];
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static uint32_t hashWord(const char* s, size_t len) {
+  uint32_t h = 2166136261u;
+  for (size_t i = 0; i < len; i++) {
+    h ^= (uint8_t) lower(s[i]);
+    h *= 16777619u;
+  }
+  return h;
+}
+
+static void skipSpace(Cursor* c) {
+  while (c->p < c->end && isSpace(*c->p)) c->p++;
+}
+
+static void skipName(Cursor* c) {
+  while (c->p < c->end && isNameChar(*c->p)) c->p++;
+}
+
+/* whether a quote at q, in the text from start, opens a literal */
+static int opensQuote(const char* start, const char* q) {
+  /* the ' of AF' does not */
+  return *q == '"' || (*q == '\'' && (q == start || !isNameChar(q[-1])));
+}
+
+/* ---------------------------------------------------------------------- */
+/* encodings */
+
+static uint64_t keyOf(int operation, int argc, const uint32_t* shapes) {
+  uint64_t key = (uint64_t) 1 << 63 | (uint64_t) operation | (uint64_t) argc << 8;
+  for (int i = 0; i < argc; i++) key |= (uint64_t) shapes[i] << (16 + 16 * i);
+  return key;
+}
+
+/* the slot holding key, or the empty one where it would go */
+static size_t probe(const Z80_Asm* as, uint64_t key) {
+  size_t i = (size_t) ((key * 0x9e3779b97f4a7c15ull) >> 32) & (Z80_ASM_ENCODINGS - 1);
+  while (as->encodings[i].key != 0 && as->encodings[i].key != key) {
+    i = (i + 1) & (Z80_ASM_ENCODINGS - 1);
+  }
+  return i;
+}
+
+static uint32_t shapeOf(const Z80_Arg* arg, Z80_Operation operation) {
+  switch (arg->flags) {
+    case am_Register:
+      return SHAPE(sh_Reg, arg->v);
+    case am_Register | am_Indirect:
+      return SHAPE(sh_RegInd, arg->v);
+    case am_Register | am_Indirect | am_Indexed:
+      return SHAPE(sh_Indexed, arg->v);
+    case am_Flag:
+      return SHAPE(sh_Flag, arg->v);
+    case am_Implicit:
+    case am_Implicit | am_Flag:
+      return SHAPE(sh_Literal, arg->v);
+    case am_Immediate | am_Extended | am_Indirect:
+      return SHAPE(sh_ValueInd, 0);
+    default:
+      /* the decoder gives IN A,(n) and OUT (n),A a plain immediate port */
+      if (operation == op_IN || operation == op_OUT) return SHAPE(sh_ValueInd, 0);
+      return SHAPE(sh_Value, 0);
+  }
+}
+
+/*
+ * Decodes every opcode on every page and records how to encode its form.
+ * Pages go from the unprefixed one out, so where a form has several
+ * encodings (a redundant prefix, the ED copy of LD (nn),HL, the DDCB
+ * forms that also load a register) the shortest, documented one is kept.
+ */
+static void addEncodings(Z80_Asm* as) {
+  for (int page = 0; page < PAGES; page++) {
+    int pre = s_prefixLen[page];
+    for (int op = 0; op < 256; op++) {
+      uint8_t bytes[8] = { 0 };
+      uint32_t shapes[MAX_OPERANDS];
+      Z80_AsmEncoding* e;
+      Z80_OpCode opcode;
+      int indexed = 0;
+      int len;
+      uint64_t key;
+
+      /* a prefix after DD or FD starts another page */
+      if (pre == 1 && (s_prefixes[page][0] == 0xdd || s_prefixes[page][0] == 0xfd) &&
+          (op == 0xcb || op == 0xdd || op == 0xed || op == 0xfd)) {
+        continue;
+      }
+      memcpy(bytes, s_prefixes[page], (size_t) pre);
+      bytes[pre == 2 ? 3 : pre] = (uint8_t) op;
+      len = z80_decode(bytes, &opcode);
+      if (len == 0 || len > (int) sizeof(e->bytes)) continue;
+      for (int i = 0; i < opcode.argc; i++) {
+        shapes[i] = shapeOf(&opcode.args[i], opcode.operation);
+      }
+      key = keyOf(opcode.operation, opcode.argc, shapes);
+      e = &as->encodings[probe(as, key)];
+      if (e->key != 0) continue;
+
+      e->key = key;
+      memcpy(e->bytes, bytes, (size_t) len);
+      e->len = (uint8_t) len;
+      for (int i = 0; i < opcode.argc; i++) {
+        if (shapes[i] >> 8 == sh_Indexed) {
+          e->disp_at = (uint8_t) (pre == 2 ? 2 : pre + 1);
+          indexed = pre != 2;
+        }
+      }
+      for (int i = 0; i < opcode.argc; i++) {
+        if (shapes[i] >> 8 == sh_Value || shapes[i] >> 8 == sh_ValueInd) {
+          e->value_at = (uint8_t) (pre + 1 + indexed);
+          e->value_size = (uint8_t) (len - e->value_at);
+          e->relative = (opcode.args[i].flags & am_Displacement) != 0;
+        }
+      }
+    }
+  }
+}
+
+static void addMnemonics(Z80_Asm* as) {
+  for (int op = 0; op <= op_XOR; op++) {
+    const char* name = z80_mnemonic((Z80_Operation) op);
+    size_t i = hashWord(name, strlen(name)) & (Z80_ASM_MNEMONICS - 1);
+    while (as->mnemonics[i] != 0) i = (i + 1) & (Z80_ASM_MNEMONICS - 1);
+    as->mnemonics[i] = (uint8_t) (op + 1);
+  }
+}
+
+static int findMnemonic(const Z80_Asm* as, const char* s, size_t len) {
+  size_t i = hashWord(s, len) & (Z80_ASM_MNEMONICS - 1);
+  for (; as->mnemonics[i] != 0; i = (i + 1) & (Z80_ASM_MNEMONICS - 1)) {
+    int op = as->mnemonics[i] - 1;
+    if (sameWord(s, len, z80_mnemonic((Z80_Operation) op))) return op;
+  }
+  return -1;
+}
+
+/* ---------------------------------------------------------------------- */
+/* symbols */
+
+static void insertSlot(Z80_Asm* as, size_t index) {
+  const char* name = as->names.data + as->symbols[index].name;
+  size_t mask = as->symbol_cap * 2 - 1;
+  size_t i = hashName(name, strlen(name)) & mask;
+  while (as->slots[i] != 0) i = (i + 1) & mask;
+  as->slots[i] = (uint32_t) index + 1;
+}
+
+static int growSymbols(Z80_Asm* as) {
+  size_t cap = as->symbol_cap != 0 ? as->symbol_cap * 2 : INITIAL_SYMBOLS;
+  Z80_AsmSymbol* symbols = (Z80_AsmSymbol*) realloc(as->symbols,
+      cap * sizeof(Z80_AsmSymbol));
+  uint32_t* slots;
+  if (symbols == NULL) return -1;
+  as->symbols = symbols;
+  slots = (uint32_t*) calloc(cap * 2, sizeof(uint32_t));
+  if (slots == NULL) return -1;
+  free(as->slots);
+  as->slots = slots;
+  as->symbol_cap = cap;
+  for (size_t i = 0; i < as->symbol_count; i++) insertSlot(as, i);
+  return 0;
+}
+
+static long findSymbol(const Z80_Asm* as, const char* s, size_t len) {
+  size_t mask = as->symbol_cap * 2 - 1;
+  size_t i = hashName(s, len) & mask;
+  for (; as->slots[i] != 0; i = (i + 1) & mask) {
+    size_t index = as->slots[i] - 1;
+    const char* name = as->names.data + as->symbols[index].name;
+    if (memcmp(name, s, len) == 0 && name[len] == '\0') return (long) index;
+  }
+  return -1;
+}
+
+static long addSymbol(Z80_Asm* as, const char* s, size_t len) {
+  Z80_AsmSymbol* sym;
+  if (as->symbol_count == as->symbol_cap && growSymbols(as) != 0) return -1;
+  sym = &as->symbols[as->symbol_count];
+  sym->name = (uint32_t) as->names.len;
+  sym->value = 0;
+  sym->known = 0;
+  sym->pass = 0;
+  sym->label = 0;
+  if (z80_buf_append(&as->names, s, len) != 0 ||
+      z80_buf_append(&as->names, "", 1) != 0) {
+    return -1;
+  }
+  insertSlot(as, as->symbol_count);
+  return (long) as->symbol_count++;
+}
+
+static int define(Pass* ps, const char* s, size_t len, int32_t value,
+    int known, int label) {
+  Z80_Asm* as = ps->as;
+  long i = findSymbol(as, s, len);
+  if (i >= 0 && as->symbols[i].pass == ps->pass) {
+    return fail(ps, "'%.*s' is already defined", (int) len, s);
+  }
+  if (i < 0 && (i = addSymbol(as, s, len)) < 0) return fail(ps, "out of memory");
+  as->symbols[i].value = value;
+  as->symbols[i].known = (uint8_t) known;
+  as->symbols[i].pass = (uint8_t) ps->pass;
+  as->symbols[i].label = (uint8_t) label;
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+/* expressions */
+
+static int binary(Pass* ps, Cursor* c, int level, int32_t* value);
+
+static int number(Pass* ps, Cursor* c, int32_t* value) {
+  const char* p = c->p;
+  const char* end;
+  uint32_t v = 0;
+  int base = 10;
+  if (*p == '$') {
+    base = 16;
+    p++;
+  }
+  else if (*p == '0' && p + 1 < c->end && lower(p[1]) == 'x') {
+    base = 16;
+    p += 2;
+  }
+  for (end = p; end < c->end && (isDigit(*end) || isNameStart(*end)); end++) {}
+  c->p = end;
+  if (base == 10 && end > p && lower(end[-1]) == 'h') {
+    base = 16;
+    end--;
+  }
+  if (p == end) return fail(ps, "bad number");
+  for (; p < end; p++) {
+    int d = digitValue(*p);
+    if (d < 0 || d >= base) return fail(ps, "bad number");
+    v = v * (uint32_t) base + (uint32_t) d;
+  }
+  *value = (int32_t) v;
+  return 0;
+}
+
+static int primary(Pass* ps, Cursor* c, int32_t* value) {
+  char ch;
+  skipSpace(c);
+  if (c->p == c->end) return fail(ps, "expression expected");
+  ch = *c->p;
+  if (ch == '(') {
+    c->p++;
+    if (binary(ps, c, 0, value) != 0) return -1;
+    skipSpace(c);
+    if (c->p == c->end || *c->p != ')') return fail(ps, "')' expected");
+    c->p++;
+    return 0;
+  }
+  if (ch == '-' || ch == '+' || ch == '~') {
+    c->p++;
+    if (primary(ps, c, value) != 0) return -1;
+    if (ch == '-') *value = (int32_t) (0u - (uint32_t) *value);
+    else if (ch == '~') *value = ~*value;
+    return 0;
+  }
+  if (ch == '\'') {
+    if (c->end - c->p < 3 || c->p[2] != '\'') return fail(ps, "bad character");
+    *value = (uint8_t) c->p[1];
+    c->p += 3;
+    return 0;
+  }
+  if (ch == '$' && (c->p + 1 == c->end || digitValue(c->p[1]) < 0)) {
+    *value = (int32_t) ps->pc;
+    c->p++;
+    return 0;
+  }
+  if (isDigit(ch) || ch == '$') return number(ps, c, value);
+  if (isNameStart(ch)) {
+    const char* name = c->p;
+    long i;
+    skipName(c);
+    i = findSymbol(ps->as, name, (size_t) (c->p - name));
+    if (i >= 0 && ps->as->symbols[i].known) {
+      *value = ps->as->symbols[i].value;
+      return 0;
+    }
+    if (ps->pass == 2) {
+      return fail(ps, "undefined symbol '%.*s'", (int) (c->p - name), name);
+    }
+    ps->unknown = 1;
+    *value = 0;
+    return 0;
+  }
+  return fail(ps, "unexpected '%c'", ch);
+}
+
+/* the operator at c of the given level, consumed, or 0 */
+static char binaryOperator(Cursor* c, int level) {
+  char ch;
+  skipSpace(c);
+  if (c->p == c->end || strchr(s_operators[level], *c->p) == NULL) return 0;
+  ch = *c->p++;
+  if (ch == '<' || ch == '>') {
+    if (c->p == c->end || *c->p != ch) {
+      c->p--;
+      return 0;
+    }
+    c->p++;
+  }
+  return ch;
+}
+
+static int binary(Pass* ps, Cursor* c, int level, int32_t* value) {
+  if (level == LEVELS) return primary(ps, c, value);
+  if (binary(ps, c, level + 1, value) != 0) return -1;
+  for (;;) {
+    char op = binaryOperator(c, level);
+    uint32_t x = (uint32_t) *value;
+    int32_t rhs;
+    if (op == 0) return 0;
+    if (binary(ps, c, level + 1, &rhs) != 0) return -1;
+    switch (op) {
+      case '|': x |= (uint32_t) rhs; break;
+      case '^': x ^= (uint32_t) rhs; break;
+      case '&': x &= (uint32_t) rhs; break;
+      case '<': x <<= rhs & 31; break;
+      case '>': x = (uint32_t) (*value >> (rhs & 31)); break;
+      case '+': x += (uint32_t) rhs; break;
+      case '-': x -= (uint32_t) rhs; break;
+      case '*': x *= (uint32_t) rhs; break;
+      default:
+        if (rhs == 0) {
+          if (ps->unknown) x = 0;
+          else return fail(ps, "division by zero");
+        }
+        else if (op == '/') x = (uint32_t) (*value / rhs);
+        else x = (uint32_t) (*value % rhs);
+        break;
+    }
+    *value = (int32_t) x;
+  }
+}
+
+/* evaluates the text from s up to e, noting in ps->unknown if it has no value yet */
+static int evaluate(Pass* ps, const char* s, const char* e, int32_t* value) {
+  Cursor c;
+  c.p = s;
+  c.end = e;
+  ps->unknown = 0;
+  if (binary(ps, &c, 0, value) != 0) return -1;
+  skipSpace(&c);
+  if (c.p != c.end) return fail(ps, "unexpected '%c'", *c.p);
+  return 0;
+}
+
+static int inRange(Pass* ps, int32_t value, int32_t min, int32_t max,
+    const char* what) {
+  if (ps->pass == 2 && (value < min || value > max)) {
+    return fail(ps, "%s out of range", what);
+  }
+  return 0;
+}
+
+/* ---------------------------------------------------------------------- */
+/* operands */
+
+/*
+ * Splits off the next comma-separated operand, trimmed, into s and e.
+ * Returns 0 when there are none left.
+ */
+static int nextOperand(Cursor* c, const char** s, const char** e) {
+  const char* start;
+  char quote = 0;
+  int depth = 0;
+  skipSpace(c);
+  if (c->p == c->end) return 0;
+  start = c->p;
+  *s = start;
+  for (; c->p < c->end; c->p++) {
+    char ch = *c->p;
+    if (quote != 0) {
+      if (ch == quote) quote = 0;
+    }
+    else if (opensQuote(start, c->p)) quote = ch;
+    else if (ch == '(') depth++;
+    else if (ch == ')') depth--;
+    else if (ch == ',' && depth == 0) break;
+  }
+  *e = c->p;
+  while (*e > *s && isSpace((*e)[-1])) (*e)--;
+  if (c->p < c->end) {
+    c->p++;
+    /* a trailing comma leaves an empty operand */
+    skipSpace(c);
+    if (c->p == c->end) c->p--;
+  }
+  return 1;
+}
+
+static int registerOf(const char* s, size_t len) {
+  /* most names are symbols, longer than any register */
+  if (len > 3) return -1;
+  for (size_t i = 0; i < sizeof(s_registers) / sizeof(s_registers[0]); i++) {
+    if (sameWord(s, len, s_registers[i])) return reg_A + (int) i;
+  }
+  return -1;
+}
+
+static int flagOf(const char* s, size_t len) {
+  if (len > 2) return -1;
+  for (size_t i = 0; i < sizeof(s_flags) / sizeof(s_flags[0]); i++) {
+    if (s_flags[i][0] != '\0' && sameWord(s, len, s_flags[i])) return fl_NZ + (int) i;
+  }
+  return -1;
+}
+
+/* whether the '(' at s closes at the ')' just before e */
+static int enclosed(const char* s, const char* e) {
+  int depth = 0;
+  if (e - s < 2 || *s != '(' || e[-1] != ')') return 0;
+  for (const char* p = s; p < e - 1; p++) {
+    if (*p == '(') depth++;
+    else if (*p == ')' && --depth == 0) return 0;
+  }
+  return 1;
+}
+
+static int parseOperand(Pass* ps, const char* s, const char* e, Operand* op) {
+  int reg;
+  op->value = 0;
+  op->disp = 0;
+  if (s == e) return fail(ps, "operand expected");
+  if (enclosed(s, e)) {
+    const char* is = s + 1;
+    const char* ie = e - 1;
+    const char* word = is;
+    while (is < ie && isSpace(*is)) is++;
+    while (ie > is && isSpace(ie[-1])) ie--;
+    for (word = is; word < ie && isNameChar(*word); word++) {}
+    reg = registerOf(is, (size_t) (word - is));
+    if (reg >= 0 && word == ie) {
+      op->shape = SHAPE(sh_RegInd, reg);
+      return 0;
+    }
+    if (reg == reg_IX || reg == reg_IY) {
+      while (word < ie && isSpace(*word)) word++;
+      if (word < ie && (*word == '+' || *word == '-')) {
+        op->shape = SHAPE(sh_Indexed, reg);
+        return evaluate(ps, word, ie, &op->disp);
+      }
+    }
+    op->shape = SHAPE(sh_ValueInd, 0);
+    return evaluate(ps, is, ie, &op->value);
+  }
+  if ((reg = registerOf(s, (size_t) (e - s))) >= 0) {
+    op->shape = SHAPE(sh_Reg, reg);
+    return 0;
+  }
+  if ((reg = flagOf(s, (size_t) (e - s))) >= 0) {
+    op->shape = SHAPE(sh_Flag, reg);
+    return 0;
+  }
+  op->shape = SHAPE(sh_Value, 0);
+  return evaluate(ps, s, e, &op->value);
+}
+
+/* ---------------------------------------------------------------------- */
+/* instructions and directives */
+
+static const Z80_AsmEncoding* lookup(const Z80_Asm* as, int operation,
+    const Operand* ops, int argc) {
+  uint32_t shapes[MAX_OPERANDS];
+  const Z80_AsmEncoding* e;
+  for (int i = 0; i < argc; i++) shapes[i] = ops[i].shape;
+  e = &as->encodings[probe(as, keyOf(operation, argc, shapes))];
+  if (e->key != 0) return e;
+  /* RST, IM and BIT-style numbers are part of the opcode */
+  for (int i = 0; i < argc; i++) {
+    if (shapes[i] != SHAPE(sh_Value, 0) || ops[i].value < 0 || ops[i].value > 0xff) {
+      continue;
+    }
+    shapes[i] = SHAPE(sh_Literal, ops[i].value);
+    e = &as->encodings[probe(as, keyOf(operation, argc, shapes))];
+    if (e->key != 0) return e;
+    shapes[i] = SHAPE(sh_Value, 0);
+  }
+  return NULL;
+}
+
+static const Z80_AsmEncoding* findForm(const Z80_Asm* as, int operation,
+    Operand* ops, int argc) {
+  const Z80_AsmEncoding* e = lookup(as, operation, ops, argc);
+  /* C is the carry flag where a condition may stand */
+  if (e == NULL && argc > 0 && ops[0].shape == SHAPE(sh_Reg, reg_C)) {
+    ops[0].shape = SHAPE(sh_Flag, fl_C);
+    e = lookup(as, operation, ops, argc);
+    ops[0].shape = SHAPE(sh_Reg, reg_C);
+  }
+  /* (IX) is (IX+0) except in JP (IX) */
+  for (int i = 0; e == NULL && i < argc; i++) {
+    if (ops[i].shape == SHAPE(sh_RegInd, reg_IX) ||
+        ops[i].shape == SHAPE(sh_RegInd, reg_IY)) {
+      uint32_t shape = ops[i].shape;
+      ops[i].shape = SHAPE(sh_Indexed, shape & 0xff);
+      e = lookup(as, operation, ops, argc);
+      ops[i].shape = shape;
+    }
+  }
+  /* an operation on A may spell A out or leave it out */
+  if (e == NULL && argc == 2 && ops[0].shape == SHAPE(sh_Reg, reg_A)) {
+    e = lookup(as, operation, ops + 1, 1);
+  }
+  if (e == NULL && argc == 1) {
+    Operand with_a[2];
+    with_a[0].shape = SHAPE(sh_Reg, reg_A);
+    with_a[1] = ops[0];
+    e = lookup(as, operation, with_a, 2);
+  }
+  return e;
+}
+
+/* claims n bytes at pc, setting *at to where they go on the second pass */
+static int claim(Pass* ps, size_t n, uint8_t** at) {
+  Z80_Asm* as = ps->as;
+  *at = NULL;
+  if (n > IMAGE_END - ps->pc) return fail(ps, "past the end of memory");
+  if (ps->pass == 2 && n != 0) {
+    *at = ps->image + ps->pc;
+    if (ps->pc < as->low) as->low = ps->pc;
+    if (ps->pc + n > as->high) as->high = ps->pc + (uint32_t) n;
+  }
+  ps->pc += (uint32_t) n;
+  return 0;
+}
+
+static int assembleInsn(Pass* ps, int operation, Cursor* c) {
+  Operand ops[MAX_OPERANDS];
+  const Z80_AsmEncoding* form;
+  const char* s;
+  const char* e;
+  uint8_t bytes[4];
+  uint8_t* at;
+  int32_t value = 0, disp = 0;
+  int argc = 0;
+
+  while (nextOperand(c, &s, &e)) {
+    uint32_t kind;
+    if (argc == MAX_OPERANDS) return fail(ps, "too many operands");
+    if (parseOperand(ps, s, e, &ops[argc]) != 0) return -1;
+    kind = ops[argc].shape >> 8;
+    if (kind == sh_Indexed) disp = ops[argc].disp;
+    if (kind == sh_Value || kind == sh_ValueInd) value = ops[argc].value;
+    argc++;
+  }
+  form = findForm(ps->as, operation, ops, argc);
+  if (form == NULL) {
+    return fail(ps, "%s does not take these operands",
+        z80_mnemonic((Z80_Operation) operation));
+  }
+
+  memcpy(bytes, form->bytes, form->len);
+  if (form->disp_at != 0) {
+    if (inRange(ps, disp, -128, 127, "displacement") != 0) return -1;
+    bytes[form->disp_at] = (uint8_t) disp;
+  }
+  if (form->relative) {
+    /* the target wraps around memory as the CPU's does */
+    int32_t offset = (int16_t) (uint16_t) (value - (int32_t) (ps->pc + form->len));
+    if (inRange(ps, offset, -128, 127, "relative jump") != 0) return -1;
+    bytes[form->value_at] = (uint8_t) offset;
+  }
+  else if (form->value_size == 1) {
+    if (inRange(ps, value, -128, 0xff, "value") != 0) return -1;
+    bytes[form->value_at] = (uint8_t) value;
+  }
+  else if (form->value_size == 2) {
+    if (inRange(ps, value, -32768, 0xffff, "value") != 0) return -1;
+    bytes[form->value_at] = (uint8_t) value;
+    bytes[form->value_at + 1] = (uint8_t) (value >> 8);
+  }
+  if (claim(ps, form->len, &at) != 0) return -1;
+  if (at != NULL) memcpy(at, bytes, form->len);
+  return 0;
+}
+
+static int directiveOf(const char* s, size_t len) {
+  if (len > 4) return -1;
+  for (size_t i = 0; i < sizeof(s_directives) / sizeof(s_directives[0]); i++) {
+    if (sameWord(s, len, s_directives[i])) return s_directiveKinds[i];
+  }
+  return -1;
+}
+
+static int data(Pass* ps, Cursor* c, int width) {
+  const char* s;
+  const char* e;
+  int count = 0;
+  while (nextOperand(c, &s, &e)) {
+    uint8_t* at;
+    int32_t value;
+    count++;
+    if (width == 1 && s < e && *s == '"') {
+      if (e - s < 2 || e[-1] != '"') return fail(ps, "unterminated string");
+      if (claim(ps, (size_t) (e - s - 2), &at) != 0) return -1;
+      if (at != NULL) memcpy(at, s + 1, (size_t) (e - s - 2));
+      continue;
+    }
+    if (s == e) return fail(ps, "operand expected");
+    if (evaluate(ps, s, e, &value) != 0 ||
+        inRange(ps, value, width == 1 ? -128 : -32768, width == 1 ? 0xff : 0xffff,
+            width == 1 ? "byte" : "word") != 0 ||
+        claim(ps, (size_t) width, &at) != 0) {
+      return -1;
+    }
+    if (at != NULL) {
+      at[0] = (uint8_t) value;
+      if (width == 2) at[1] = (uint8_t) (value >> 8);
+    }
+  }
+  return count != 0 ? 0 : fail(ps, "operand expected");
+}
+
+static int space(Pass* ps, Cursor* c) {
+  const char* s;
+  const char* e;
+  int32_t count, fill = 0;
+  uint8_t* at;
+  if (!nextOperand(c, &s, &e)) return fail(ps, "size expected");
+  if (evaluate(ps, s, e, &count) != 0) return -1;
+  if (ps->unknown) return fail(ps, "size depends on a later symbol");
+  if (count < 0 || count > IMAGE_END) return fail(ps, "size out of range");
+  if (nextOperand(c, &s, &e) &&
+      (evaluate(ps, s, e, &fill) != 0 || inRange(ps, fill, -128, 0xff, "fill") != 0)) {
+    return -1;
+  }
+  if (c->p != c->end) return fail(ps, "too many operands");
+  if (claim(ps, (size_t) count, &at) != 0) return -1;
+  if (at != NULL) memset(at, (uint8_t) fill, (size_t) count);
+  return 0;
+}
+
+/* returns 1 at an end directive */
+static int assembleLine(Pass* ps, const char* p, const char* end) {
+  const char* label = NULL;
+  size_t label_len = 0;
+  const char* word;
+  size_t word_len;
+  char quote = 0;
+  int32_t value;
+  int kind;
+  Cursor c;
+
+  for (const char* q = p; q < end; q++) {
+    if (quote != 0) {
+      if (*q == quote) quote = 0;
+    }
+    else if (*q == ';') {
+      end = q;
+      break;
+    }
+    else if (opensQuote(p, q)) quote = *q;
+  }
+  while (end > p && (isSpace(end[-1]) || end[-1] == '\r')) end--;
+  c.p = p;
+  c.end = end;
+
+  /* a label starts in the first column or ends with ':' */
+  if (c.p < end && isNameStart(*c.p)) {
+    label = c.p;
+    skipName(&c);
+    label_len = (size_t) (c.p - label);
+    if (c.p < end && *c.p == ':') c.p++;
+  }
+  skipSpace(&c);
+  word = c.p;
+  skipName(&c);
+  word_len = (size_t) (c.p - word);
+  if (label == NULL && word_len != 0 && c.p < end && *c.p == ':') {
+    label = word;
+    label_len = word_len;
+    c.p++;
+    skipSpace(&c);
+    word = c.p;
+    skipName(&c);
+    word_len = (size_t) (c.p - word);
+  }
+  if (c.p < end && !isSpace(*c.p)) return fail(ps, "unexpected '%c'", *c.p);
+
+  kind = directiveOf(word, word_len);
+  if (kind == dir_Equ) {
+    if (label == NULL) return fail(ps, "equ needs a label");
+    skipSpace(&c);
+    if (evaluate(ps, c.p, end, &value) != 0) return -1;
+    return define(ps, label, label_len, value, !ps->unknown, 0);
+  }
+  if (label != NULL && define(ps, label, label_len, (int32_t) ps->pc, 1, 1) != 0) {
+    return -1;
+  }
+  switch (kind) {
+    case dir_Org:
+      skipSpace(&c);
+      if (evaluate(ps, c.p, end, &value) != 0) return -1;
+      if (ps->unknown) return fail(ps, "org depends on a later symbol");
+      if (value < 0 || value > 0xffff) return fail(ps, "org out of range");
+      ps->pc = (uint32_t) value;
+      return 0;
+    case dir_Defb:
+      return data(ps, &c, 1);
+    case dir_Defw:
+      return data(ps, &c, 2);
+    case dir_Defs:
+      return space(ps, &c);
+    case dir_End:
+      return 1;
+    default:
+      break;
+  }
+  if (word_len == 0) return 0;
+  kind = findMnemonic(ps->as, word, word_len);
+  if (kind < 0) return fail(ps, "unknown instruction '%.*s'", (int) word_len, word);
+  return assembleInsn(ps, kind, &c);
+}
+
+static int runPass(Z80_Asm* as, int pass, const char* text, size_t len,
+    uint8_t* image) {
+  const char* p = text;
+  const char* end = text + len;
+  Pass ps;
+  ps.as = as;
+  ps.image = image;
+  ps.pass = pass;
+  ps.pc = 0;
+  ps.unknown = 0;
+  as->line = 0;
+  while (p < end) {
+    const char* eol = (const char*) memchr(p, '\n', (size_t) (end - p));
+    int rc;
+    if (eol == NULL) eol = end;
+    as->line++;
+    rc = assembleLine(&ps, p, eol);
+    if (rc < 0) return -1;
+    if (rc > 0) break;
+    p = eol < end ? eol + 1 : end;
+  }
+  return 0;
+}
+
+int z80_asm_init(Z80_Asm* as) {
+  memset(as, 0, sizeof(*as));
+  z80_buf_init(&as->names);
+  addEncodings(as);
+  addMnemonics(as);
+  if (growSymbols(as) != 0) {
+    z80_asm_free(as);
+    return -1;
+  }
+  return 0;
+}
+
+void z80_asm_free(Z80_Asm* as) {
+  free(as->symbols);
+  free(as->slots);
+  z80_buf_free(&as->names);
+  as->symbols = NULL;
+  as->slots = NULL;
+  as->symbol_count = 0;
+  as->symbol_cap = 0;
+}
+
+int z80_asm_assemble(Z80_Asm* as, const char* text, size_t len, uint8_t* image) {
+  as->symbol_count = 0;
+  as->names.len = 0;
+  memset(as->slots, 0, as->symbol_cap * 2 * sizeof(uint32_t));
+  as->low = IMAGE_END;
+  as->high = 0;
+  as->error[0] = '\0';
+  if (runPass(as, 1, text, len, image) != 0 ||
+      runPass(as, 2, text, len, image) != 0) {
+    return -1;
+  }
+  if (as->low > as->high) as->low = as->high = 0;
+  as->line = 0;
+  return 0;
+}
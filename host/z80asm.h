@@ -0,0 +1,92 @@
+#ifndef z80asm_h
+#define z80asm_h
+
+#include "z80dasm.h"
+#include "z80list.h"
+
+#define Z80_ASM_ENCODINGS 4096
+#define Z80_ASM_MNEMONICS 256
+#define Z80_ASM_ERROR_MAX 128
+
+/*
+ * One form of an instruction, found by key: its operation and the shape
+ * of each operand (see z80asm.c). bytes holds the encoding with any
+ * displacement or value left zero; they go at disp_at and value_at
+ * (0 if there is none), the value taking value_size bytes, or one byte
+ * relative to the next instruction when relative is set.
+ */
+typedef struct {
+  uint64_t key;
+  uint8_t bytes[4];
+  uint8_t len;
+  uint8_t disp_at;
+  uint8_t value_at;
+  uint8_t value_size;
+  uint8_t relative;
+} Z80_AsmEncoding;
+
+/*
+ * A label or equ: name is an offset into the name pool, and label is set
+ * for a label (an address) and clear for an equ (any value).
+ */
+typedef struct {
+  uint32_t name;
+  int32_t value;
+  uint8_t known;
+  uint8_t pass;
+  uint8_t label;
+} Z80_AsmSymbol;
+
+/*
+ * An assembler. The encoding and mnemonic tables are built once, from
+ * the decoder, by z80_asm_init(), and serve every z80_asm_assemble()
+ * after. After a successful assembly, symbols holds every label and equ
+ * in the order they were defined and the bytes written span low up to
+ * high (exclusive); after a failure, line and error say what went wrong.
+ */
+typedef struct {
+  Z80_AsmEncoding encodings[Z80_ASM_ENCODINGS];
+  uint8_t mnemonics[Z80_ASM_MNEMONICS];
+  Z80_AsmSymbol* symbols;
+  size_t symbol_count;
+  size_t symbol_cap;
+  uint32_t* slots;
+  Z80_Buf names;
+  uint32_t low;
+  uint32_t high;
+  int line;
+  char error[Z80_ASM_ERROR_MAX];
+} Z80_Asm;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/* Returns 0, or -1 if memory is exhausted. */
+int z80_asm_init(Z80_Asm* as);
+
+void z80_asm_free(Z80_Asm* as);
+
+/*
+ * Assembles the len characters of source at text into the 64 KiB image,
+ * in two passes. The source is in the style of sup/sup.asm: a label
+ * starts in the first column or ends with ':', ';' starts a comment, and
+ * the directives are org, equ, defb (db, defm), defw (dw), defs (ds) and
+ * end. Mnemonics and registers are as z80_format() prints them, in either
+ * case; an operation on A may leave A out or spell it out. Expressions
+ * combine numbers (42, 0x2a, $2a, 2ah), 'c', symbols and $, the current
+ * address, with unary - ~ and binary * / % + - << >> & ^ |, in C
+ * precedence. Returns 0, or -1 on an error in the source or if memory is
+ * exhausted.
+ */
+int z80_asm_assemble(Z80_Asm* as, const char* text, size_t len, uint8_t* image);
+
+static inline const char* z80_asm_symbol_name(const Z80_Asm* as, size_t i) {
+  return as->names.data + as->symbols[i].name;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80asm_h */
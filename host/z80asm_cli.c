@@ -0,0 +1,130 @@
+/*
+ * Assembles a source file in the style of sup/sup.asm. The image is
+ * written from the lowest address assembled to just past the highest, so
+ * a source starting at org 0 gives an image z80run boots as it is; -y
+ * writes every label as a "name equ value" line, which z80run and z80dasm
+ * read back with -y. Equ constants are left out, since those tools take
+ * every symbol for an address. With neither, the source is only checked.
+ *
+ *   cc -O2 -I.. -o z80asm z80asm_cli.c z80asm.c z80list.c ../z80dasm.c
+ *   z80asm [-o image.bin] [-y symbols] source.asm
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "z80asm.h"
+
+#define IMAGE_SIZE 65536
+
+static uint8_t s_image[IMAGE_SIZE];
+
+/* reads all of path into a malloc'd buffer */
+static char* readFile(const char* path, size_t* len) {
+  FILE* fp = fopen(path, "rb");
+  char* text = NULL;
+  size_t cap = 0;
+  *len = 0;
+  if (fp == NULL) return NULL;
+  for (;;) {
+    char* more;
+    size_t n;
+    if (*len == cap) {
+      cap = cap != 0 ? cap * 2 : 65536;
+      more = (char*) realloc(text, cap);
+      if (more == NULL) break;
+      text = more;
+    }
+    n = fread(text + *len, 1, cap - *len, fp);
+    *len += n;
+    if (n == 0) {
+      if (ferror(fp)) break;
+      fclose(fp);
+      return text;
+    }
+  }
+  free(text);
+  fclose(fp);
+  return NULL;
+}
+
+static int writeImage(const char* path, const Z80_Asm* as) {
+  FILE* fp = fopen(path, "wb");
+  if (fp == NULL ||
+      fwrite(s_image + as->low, 1, as->high - as->low, fp) != as->high - as->low ||
+      fclose(fp) != 0) {
+    perror(path);
+    return -1;
+  }
+  return 0;
+}
+
+static int writeSymbols(const char* path, const Z80_Asm* as) {
+  FILE* fp = fopen(path, "w");
+  if (fp == NULL) {
+    perror(path);
+    return -1;
+  }
+  for (size_t i = 0; i < as->symbol_count; i++) {
+    if (!as->symbols[i].label) continue;
+    fprintf(fp, "%s equ 0x%04x\n", z80_asm_symbol_name(as, i),
+        (unsigned) (as->symbols[i].value & 0xffff));
+  }
+  if (ferror(fp) || fclose(fp) != 0) {
+    perror(path);
+    return -1;
+  }
+  return 0;
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: z80asm [-o image.bin] [-y symbols] source.asm\n");
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  const char* image_path = NULL;
+  const char* sym_path = NULL;
+  Z80_Asm* as;
+  char* text;
+  size_t len;
+  int rc = 1;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "o:y:")) != -1) {
+    switch (opt) {
+      case 'o':
+        image_path = optarg;
+        break;
+      case 'y':
+        sym_path = optarg;
+        break;
+      default:
+        usage();
+    }
+  }
+  if (optind != argc - 1) usage();
+
+  text = readFile(argv[optind], &len);
+  if (text == NULL) {
+    perror(argv[optind]);
+    return 1;
+  }
+  as = (Z80_Asm*) malloc(sizeof(Z80_Asm));
+  if (as == NULL || z80_asm_init(as) != 0) {
+    fprintf(stderr, "z80asm: out of memory\n");
+    return 1;
+  }
+  if (z80_asm_assemble(as, text, len, s_image) != 0) {
+    fprintf(stderr, "%s:%d: %s\n", argv[optind], as->line, as->error);
+  }
+  else if ((image_path == NULL || writeImage(image_path, as) == 0) &&
+      (sym_path == NULL || writeSymbols(sym_path, as) == 0)) {
+    rc = 0;
+  }
+  z80_asm_free(as);
+  free(as);
+  free(text);
+  return rc;
+}
@@ -0,0 +1,66 @@
+#include <stddef.h>
+#include <string.h>
+
+#include "z80batch.h"
+#include "z80pool.h"
+
+#define SLICE_CYCLES 1000000
+
+static int machineRead(void* ctx, int wait) {
+  Z80_Machine* m = (Z80_Machine*) ctx;
+  (void) wait;
+  return m->input_pos < m->input_len ? m->input[m->input_pos++] : -2;
+}
+
+static void machineWrite(void* ctx, uint8_t c) {
+  Z80_Machine* m = (Z80_Machine*) ctx;
+  char ch = (char) c;
+  if (z80_buf_append(&m->output, &ch, 1) != 0) m->status = bat_NoMemory;
+}
+
+void z80_machine_init(Z80_Machine* m, const uint8_t* image, size_t len) {
+  memset(m, 0, offsetof(Z80_Machine, mem));
+  memset(m->mem, 0, sizeof(m->mem));
+  memcpy(m->mem, image, len < sizeof(m->mem) ? len : sizeof(m->mem));
+  z80_buf_init(&m->output);
+  z80_cpu_init(&m->cpu, m->mem, NULL, NULL, NULL);
+  z80_con_init(&m->con, &m->cpu, machineRead, machineWrite, m);
+  z80_svc_init(&m->svc);
+}
+
+int z80_machine_load(Z80_Machine* m, uint16_t addr, const uint8_t* bytes,
+    size_t len) {
+  if (len > Z80_MEM_SIZE - (size_t) addr) return -1;
+  memcpy(m->mem + addr, bytes, len);
+  return 0;
+}
+
+void z80_machine_free(Z80_Machine* m) {
+  z80_buf_free(&m->output);
+}
+
+int z80_machine_run(Z80_Machine* m) {
+  Z80_CPU* cpu = &m->cpu;
+  uint64_t end = m->budget != 0 ? cpu->cycles + m->budget : 0;
+  while (m->status == bat_Pending) {
+    uint64_t slice = SLICE_CYCLES;
+    if (end != 0) {
+      if (cpu->cycles >= end) {
+        m->status = z80_cpu_stopped(cpu) ? bat_Halted : bat_OutOfCycles;
+        break;
+      }
+      if (end - cpu->cycles < slice) slice = end - cpu->cycles;
+    }
+    if (z80_con_run(&m->con, slice) == 0) m->status = bat_Halted;
+  }
+  return m->status;
+}
+
+static void runJob(void* ctx, size_t job, int worker) {
+  (void) worker;
+  z80_machine_run((Z80_Machine*) ctx + job);
+}
+
+int z80_machines_run(Z80_Machine* machines, size_t n, int threads) {
+  return z80_pool_run(n, threads, runJob, machines);
+}
@@ -0,0 +1,72 @@
+#ifndef z80batch_h
+#define z80batch_h
+
+#include "z80con.h"
+#include "z80list.h"
+#include "z80svc.h"
+
+/* How a machine's run in a batch ended. */
+typedef enum {
+  bat_Pending,
+  bat_Halted,
+  bat_OutOfCycles,
+  bat_NoMemory
+} Z80_BatchStatus;
+
+/*
+ * One machine of a batch: a 64 KiB address space, a CPU with a
+ * Z80_Console on its ports, the input the console reads and the buffer
+ * its output goes to. budget caps the T-states the machine may run (0
+ * for no limit). svc is there to attach with z80_svc_attach() for native
+ * supervisor calls. Machines share nothing, so a batch runs them on
+ * separate threads without locking; the console and CPU point into the
+ * machine, which must not move once initialised.
+ */
+typedef struct {
+  Z80_CPU cpu;
+  Z80_Console con;
+  Z80_Svc svc;
+  const uint8_t* input;
+  size_t input_len;
+  size_t input_pos;
+  uint64_t budget;
+  Z80_Buf output;
+  int status;
+  uint8_t mem[Z80_MEM_SIZE];
+} Z80_Machine;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+ * Clears m, copies the len bytes of image to address 0 and resets the
+ * CPU, as for booting the supervisor.
+ */
+void z80_machine_init(Z80_Machine* m, const uint8_t* image, size_t len);
+
+/* Copies len bytes to addr, e.g. a test program. Returns 0, or -1 if they do not fit. */
+int z80_machine_load(Z80_Machine* m, uint16_t addr, const uint8_t* bytes,
+    size_t len);
+
+/* Frees the output buffer. */
+void z80_machine_free(Z80_Machine* m);
+
+/*
+ * Runs m until the CPU halts with nothing left to wake it or its budget
+ * is spent, and returns its status.
+ */
+int z80_machine_run(Z80_Machine* m);
+
+/*
+ * Runs each of the n machines with z80_machine_run() on a work-stealing
+ * pool of threads workers (see z80pool.h). Returns 0, or -1 if the pool
+ * could not be started.
+ */
+int z80_machines_run(Z80_Machine* machines, size_t n, int threads);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80batch_h */
@@ -0,0 +1,134 @@
+#include <string.h>
+
+#include "z80con.h"
+
+/* true if a byte of input is buffered or could be read without blocking */
+static int inputReady(Z80_Console* con) {
+  if (con->pending >= 0) return 1;
+  if (con->eof || con->read == NULL) return 0;
+  con->pending = con->read(con->ctx, 0);
+  if (con->pending == -2) con->eof = 1;
+  return con->pending >= 0;
+}
+
+static int outputReady(const Z80_Console* con) {
+  return con->cpu->cycles >= con->tx_ready_at;
+}
+
+static uint8_t conIn(void* ctx, uint16_t port) {
+  Z80_Console* con = (Z80_Console*) ctx;
+  uint8_t v;
+  switch (port & 0xff) {
+    case Z80_CON_STATUS:
+      v = (inputReady(con) ? 0 : con_InputReady)
+          | (outputReady(con) ? 0 : con_OutputReady);
+      break;
+    case Z80_CON_IO:
+      v = 0;
+      if (inputReady(con)) {
+        v = (uint8_t) con->pending;
+        con->pending = -1;
+      }
+      break;
+    case Z80_CON_CTRL:
+      v = con->ctrl;
+      break;
+    case Z80_CON_VECTOR:
+      v = con->vector;
+      break;
+    default:
+      return 0xff;
+  }
+  z80_con_update(con);
+  return v;
+}
+
+static void conOut(void* ctx, uint16_t port, uint8_t value) {
+  Z80_Console* con = (Z80_Console*) ctx;
+  switch (port & 0xff) {
+    case Z80_CON_IO:
+      if (con->write != NULL) con->write(con->ctx, value);
+      con->tx_ready_at = con->cpu->cycles + con->char_cycles;
+      break;
+    case Z80_CON_CTRL:
+      con->ctrl = value & (con_RxInt | con_TxInt);
+      break;
+    case Z80_CON_VECTOR:
+      con->vector = value & 0xfe;
+      break;
+    default:
+      return;
+  }
+  z80_con_update(con);
+}
+
+/* a halted CPU executes NOPs until the cycle count reaches until */
+static void idle(Z80_CPU* cpu, uint64_t until) {
+  uint64_t n = (until - cpu->cycles + 3) / 4;
+  cpu->cycles += 4 * n;
+  cpu->r = (uint8_t) (cpu->r + n);
+}
+
+void z80_con_init(Z80_Console* con, Z80_CPU* cpu, Z80_ConReadFn read,
+    Z80_ConWriteFn write, void* ctx) {
+  memset(con, 0, sizeof(*con));
+  con->cpu = cpu;
+  con->read = read;
+  con->write = write;
+  con->ctx = ctx;
+  con->pending = -1;
+  cpu->in = conIn;
+  cpu->out = conOut;
+  cpu->io_ctx = con;
+}
+
+void z80_con_update(Z80_Console* con) {
+  Z80_CPU* cpu = con->cpu;
+  if ((con->ctrl & con_RxInt) != 0 && inputReady(con)) {
+    cpu->irq = 1;
+    cpu->irq_data = con->vector;
+  }
+  else if ((con->ctrl & con_TxInt) != 0 && outputReady(con)) {
+    cpu->irq = 1;
+    cpu->irq_data = (uint8_t) (con->vector + 2);
+  }
+  else {
+    cpu->irq = 0;
+    /* return from a run in progress when the transmitter frees up */
+    if ((con->ctrl & con_TxInt) != 0 && con->tx_ready_at < cpu->run_end) {
+      cpu->run_end = con->tx_ready_at;
+    }
+  }
+}
+
+uint64_t z80_con_run(Z80_Console* con, uint64_t cycles) {
+  Z80_CPU* cpu = con->cpu;
+  uint64_t start = cpu->cycles;
+  uint64_t end = start + cycles;
+  while (cpu->cycles < end) {
+    uint64_t slice = end - cpu->cycles;
+    int tx_due = (con->ctrl & con_TxInt) != 0 && !outputReady(con);
+    /* stop when the transmitter frees up, to raise its interrupt on time */
+    if (tx_due && con->tx_ready_at - cpu->cycles < slice) {
+      slice = con->tx_ready_at - cpu->cycles;
+    }
+    z80_cpu_run(cpu, slice);
+    z80_con_update(con);
+    if (!z80_cpu_stopped(cpu)) continue;
+
+    if (!cpu->iff1) break;
+    if ((con->ctrl & con_TxInt) != 0 && !outputReady(con)) {
+      idle(cpu, con->tx_ready_at);
+    }
+    else if ((con->ctrl & con_RxInt) != 0 && !con->eof && con->read != NULL) {
+      con->pending = con->read(con->ctx, 1);
+      if (con->pending == -2) con->eof = 1;
+    }
+    else {
+      break;
+    }
+    z80_con_update(con);
+    if (z80_cpu_stopped(cpu)) break;
+  }
+  return cpu->cycles - start;
+}
@@ -0,0 +1,74 @@
+#ifndef z80con_h
+#define z80con_h
+
+#include "z80emu.h"
+
+/* The console ports of sup/sup.asm. */
+#define Z80_CON_IO 0x80
+#define Z80_CON_STATUS 0x81
+#define Z80_CON_CTRL 0x82
+#define Z80_CON_VECTOR 0x83
+
+/* Z80_CON_STATUS bits, both active low */
+typedef enum {
+  con_InputReady = 0x01,
+  con_OutputReady = 0x02
+} Z80_ConStatus;
+
+/* Z80_CON_CTRL bits, enabling the interrupt for each condition */
+typedef enum {
+  con_RxInt = 0x01,
+  con_TxInt = 0x02
+} Z80_ConCtrl;
+
+/*
+ * Returns the next input byte, -1 if none has arrived or -2 once input
+ * has ended. With wait set, blocks until a byte arrives or input ends.
+ */
+typedef int (*Z80_ConReadFn)(void* ctx, int wait);
+typedef void (*Z80_ConWriteFn)(void* ctx, uint8_t c);
+
+/*
+ * A serial console. A byte written to Z80_CON_IO keeps the transmitter
+ * busy for char_cycles T-states (0 models an infinitely fast line). With
+ * interrupts enabled in Z80_CON_CTRL, the console holds the CPU's irq
+ * line while input is waiting (placing the Z80_CON_VECTOR byte on the
+ * bus) or the transmitter is free (the vector byte + 2).
+ */
+typedef struct {
+  Z80_CPU* cpu;
+  Z80_ConReadFn read;
+  Z80_ConWriteFn write;
+  void* ctx;
+  uint32_t char_cycles;
+  uint64_t tx_ready_at;
+  int pending;
+  int eof;
+  uint8_t ctrl;
+  uint8_t vector;
+} Z80_Console;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/* Clears con and attaches it as cpu's I/O device. */
+void z80_con_init(Z80_Console* con, Z80_CPU* cpu, Z80_ConReadFn read,
+    Z80_ConWriteFn write, void* ctx);
+
+/* Re-evaluates the irq line; call after running the CPU. */
+void z80_con_update(Z80_Console* con);
+
+/*
+ * Runs the CPU for at least cycles T-states, delivering console
+ * interrupts as they fall due. A CPU halted waiting for the transmitter
+ * or for input idles until it is ready. Stops early if the CPU halts with
+ * nothing left to wake it. Returns the T-states run.
+ */
+uint64_t z80_con_run(Z80_Console* con, uint64_t cycles);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80con_h */
@@ -0,0 +1,256 @@
+#ifndef z80core_h
+#define z80core_h
+
+/*
+ * Internal to the emulator: the flag tables and ALU helpers shared by the
+ * interpreter in z80emu.c and the translated blocks in z80xlat.c, so that
+ * both compute flags the same way. Include after z80emu.h, once per file.
+ */
+
+#define A (cpu->af.b.h)
+#define F (cpu->af.b.l)
+#define B (cpu->bc.b.h)
+#define C (cpu->bc.b.l)
+#define L (cpu->hl.b.l)
+
+/* S, Z, X, Y and P/V (as parity) for each result byte */
+static const uint8_t s_szp[256] = {
+  0x44, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x08, 0x0c, 0x0c, 0x08, 0x0c, 0x08, 0x08, 0x0c,
+  0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x0c, 0x08, 0x08, 0x0c, 0x08, 0x0c, 0x0c, 0x08,
+  0x20, 0x24, 0x24, 0x20, 0x24, 0x20, 0x20, 0x24, 0x2c, 0x28, 0x28, 0x2c, 0x28, 0x2c, 0x2c, 0x28,
+  0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x24, 0x20, 0x28, 0x2c, 0x2c, 0x28, 0x2c, 0x28, 0x28, 0x2c,
+  0x00, 0x04, 0x04, 0x00, 0x04, 0x00, 0x00, 0x04, 0x0c, 0x08, 0x08, 0x0c, 0x08, 0x0c, 0x0c, 0x08,
+  0x04, 0x00, 0x00, 0x04, 0x00, 0x04, 0x04, 0x00, 0x08, 0x0c, 0x0c, 0x08, 0x0c, 0x08, 0x08, 0x0c,
+  0x24, 0x20, 0x20, 0x24, 0x20, 0x24, 0x24, 0x20, 0x28, 0x2c, 0x2c, 0x28, 0x2c, 0x28, 0x28, 0x2c,
+  0x20, 0x24, 0x24, 0x20, 0x24, 0x20, 0x20, 0x24, 0x2c, 0x28, 0x28, 0x2c, 0x28, 0x2c, 0x2c, 0x28,
+  0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x8c, 0x88, 0x88, 0x8c, 0x88, 0x8c, 0x8c, 0x88,
+  0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x88, 0x8c, 0x8c, 0x88, 0x8c, 0x88, 0x88, 0x8c,
+  0xa4, 0xa0, 0xa0, 0xa4, 0xa0, 0xa4, 0xa4, 0xa0, 0xa8, 0xac, 0xac, 0xa8, 0xac, 0xa8, 0xa8, 0xac,
+  0xa0, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa0, 0xa4, 0xac, 0xa8, 0xa8, 0xac, 0xa8, 0xac, 0xac, 0xa8,
+  0x84, 0x80, 0x80, 0x84, 0x80, 0x84, 0x84, 0x80, 0x88, 0x8c, 0x8c, 0x88, 0x8c, 0x88, 0x88, 0x8c,
+  0x80, 0x84, 0x84, 0x80, 0x84, 0x80, 0x80, 0x84, 0x8c, 0x88, 0x88, 0x8c, 0x88, 0x8c, 0x8c, 0x88,
+  0xa0, 0xa4, 0xa4, 0xa0, 0xa4, 0xa0, 0xa0, 0xa4, 0xac, 0xa8, 0xa8, 0xac, 0xa8, 0xac, 0xac, 0xa8,
+  0xa4, 0xa0, 0xa0, 0xa4, 0xa0, 0xa4, 0xa4, 0xa0, 0xa8, 0xac, 0xac, 0xa8, 0xac, 0xa8, 0xa8, 0xac
+};
+
+/* flag tested by each condition code; odd codes want it set */
+static const uint8_t s_condFlag[8] = {
+  zf_Z, zf_Z, zf_C, zf_C, zf_P, zf_P, zf_S, zf_S
+};
+
+static inline uint8_t sz(uint8_t v) {
+  return s_szp[v] & ~zf_P;
+}
+
+static inline uint8_t rd(Z80_CPU* cpu, uint16_t addr) {
+  return cpu->mem[addr];
+}
+
+static inline uint16_t rd16(Z80_CPU* cpu, uint16_t addr) {
+  return rd(cpu, addr) | rd(cpu, (uint16_t) (addr + 1)) << 8;
+}
+
+static inline uint8_t in(Z80_CPU* cpu, uint16_t port) {
+  return cpu->in != NULL ? cpu->in(cpu->io_ctx, port) : 0xff;
+}
+
+static inline void out(Z80_CPU* cpu, uint16_t port, uint8_t v) {
+  if (cpu->out != NULL) cpu->out(cpu->io_ctx, port, v);
+}
+
+static inline int condition(Z80_CPU* cpu, int cc) {
+  return ((F & s_condFlag[cc]) != 0) == (cc & 1);
+}
+
+static inline void add8(Z80_CPU* cpu, uint8_t v, int carry) {
+  unsigned a = A;
+  unsigned r = a + v + carry;
+  F = sz((uint8_t) r) | ((a ^ v ^ r) & zf_H)
+      | (((a ^ ~v) & (a ^ r) & 0x80) >> 5) | ((r >> 8) & zf_C);
+  A = (uint8_t) r;
+}
+
+static inline uint8_t sub8(Z80_CPU* cpu, uint8_t v, int carry) {
+  unsigned a = A;
+  unsigned r = a - v - carry;
+  F = sz((uint8_t) r) | zf_N | ((a ^ v ^ r) & zf_H)
+      | (((a ^ v) & (a ^ r) & 0x80) >> 5) | ((r >> 8) & zf_C);
+  return (uint8_t) r;
+}
+
+static inline void alu(Z80_CPU* cpu, int op, uint8_t v) {
+  switch (op) {
+    case 0:
+      add8(cpu, v, 0);
+      break;
+    case 1:
+      add8(cpu, v, F & zf_C);
+      break;
+    case 2:
+      A = sub8(cpu, v, 0);
+      break;
+    case 3:
+      A = sub8(cpu, v, F & zf_C);
+      break;
+    case 4:
+      A &= v;
+      F = s_szp[A] | zf_H;
+      break;
+    case 5:
+      A ^= v;
+      F = s_szp[A];
+      break;
+    case 6:
+      A |= v;
+      F = s_szp[A];
+      break;
+    default:
+      sub8(cpu, v, 0);
+      F = (F & ~(zf_X | zf_Y)) | (v & (zf_X | zf_Y));
+      break;
+  }
+}
+
+static inline uint8_t inc8(Z80_CPU* cpu, uint8_t v) {
+  uint8_t r = v + 1;
+  F = (F & zf_C) | sz(r) | ((r & 0xf) == 0 ? zf_H : 0) | (r == 0x80 ? zf_P : 0);
+  return r;
+}
+
+static inline uint8_t dec8(Z80_CPU* cpu, uint8_t v) {
+  uint8_t r = v - 1;
+  F = (F & zf_C) | zf_N | sz(r) | ((r & 0xf) == 0xf ? zf_H : 0)
+      | (r == 0x7f ? zf_P : 0);
+  return r;
+}
+
+static inline uint16_t add16(Z80_CPU* cpu, uint16_t a, uint16_t v) {
+  uint32_t r = (uint32_t) a + v;
+  F = (F & (zf_S | zf_Z | zf_P)) | ((r >> 8) & (zf_X | zf_Y))
+      | (((a ^ v ^ r) >> 8) & zf_H) | (r >> 16);
+  return (uint16_t) r;
+}
+
+static inline uint16_t adc16(Z80_CPU* cpu, uint16_t a, uint16_t v) {
+  uint32_t r = (uint32_t) a + v + (F & zf_C);
+  F = ((r >> 8) & (zf_S | zf_X | zf_Y)) | ((r & 0xffff) != 0 ? 0 : zf_Z)
+      | (((a ^ v ^ r) >> 8) & zf_H) | (((a ^ ~v) & (a ^ r) & 0x8000) >> 13)
+      | ((r >> 16) & zf_C);
+  return (uint16_t) r;
+}
+
+static inline uint16_t sbc16(Z80_CPU* cpu, uint16_t a, uint16_t v) {
+  uint32_t r = (uint32_t) a - v - (F & zf_C);
+  F = ((r >> 8) & (zf_S | zf_X | zf_Y)) | ((r & 0xffff) != 0 ? 0 : zf_Z)
+      | (((a ^ v ^ r) >> 8) & zf_H) | (((a ^ v) & (a ^ r) & 0x8000) >> 13)
+      | zf_N | ((r >> 16) & zf_C);
+  return (uint16_t) r;
+}
+
+static inline void daa(Z80_CPU* cpu) {
+  uint8_t a = A;
+  uint8_t correction = 0;
+  uint8_t carry = F & zf_C;
+  uint8_t half;
+  if ((F & zf_H) != 0 || (a & 0xf) > 9) correction = 0x06;
+  if (carry || a > 0x99) {
+    correction |= 0x60;
+    carry = zf_C;
+  }
+  if ((F & zf_N) != 0) {
+    half = (F & zf_H) != 0 && (a & 0xf) < 6 ? zf_H : 0;
+    A = a - correction;
+  }
+  else {
+    half = (a & 0xf) > 9 ? zf_H : 0;
+    A = a + correction;
+  }
+  F = s_szp[A] | (F & zf_N) | half | carry;
+}
+
+/* the CB page rotates and shifts, including the undocumented SLL */
+static inline uint8_t rotate(Z80_CPU* cpu, int op, uint8_t v) {
+  uint8_t r, carry;
+  switch (op) {
+    case 0:
+      carry = v >> 7;
+      r = (uint8_t) (v << 1 | carry);
+      break;
+    case 1:
+      carry = v & 1;
+      r = (uint8_t) (v >> 1 | carry << 7);
+      break;
+    case 2:
+      carry = v >> 7;
+      r = (uint8_t) (v << 1 | (F & zf_C));
+      break;
+    case 3:
+      carry = v & 1;
+      r = (uint8_t) (v >> 1 | (F & zf_C) << 7);
+      break;
+    case 4:
+      carry = v >> 7;
+      r = (uint8_t) (v << 1);
+      break;
+    case 5:
+      carry = v & 1;
+      r = (uint8_t) ((v >> 1) | (v & 0x80));
+      break;
+    case 6:
+      carry = v >> 7;
+      r = (uint8_t) (v << 1 | 1);
+      break;
+    default:
+      carry = v & 1;
+      r = v >> 1;
+      break;
+  }
+  F = s_szp[r] | carry;
+  return r;
+}
+
+/* BIT n; X and Y come from xy, the value or the high byte of the address */
+static inline void bit(Z80_CPU* cpu, int n, uint8_t v, uint8_t xy) {
+  uint8_t r = v & (1 << n);
+  F = (F & zf_C) | zf_H | (s_szp[r] & (zf_S | zf_Z | zf_P)) | (xy & (zf_X | zf_Y));
+}
+
+/* RLCA, RRCA, RLA and RRA, by the opcode's y field; S, Z and P/V are kept */
+static inline void rotateA(Z80_CPU* cpu, int op) {
+  uint8_t carry;
+  switch (op) {
+    case 0:
+      carry = A >> 7;
+      A = (uint8_t) (A << 1 | carry);
+      break;
+    case 1:
+      carry = A & 1;
+      A = (uint8_t) (A >> 1 | carry << 7);
+      break;
+    case 2:
+      carry = A >> 7;
+      A = (uint8_t) (A << 1 | (F & zf_C));
+      break;
+    default:
+      carry = A & 1;
+      A = (uint8_t) (A >> 1 | (F & zf_C) << 7);
+      break;
+  }
+  F = (F & (zf_S | zf_Z | zf_P)) | (A & (zf_X | zf_Y)) | carry;
+}
+
+static inline void cpl(Z80_CPU* cpu) {
+  A = ~A;
+  F = (F & (zf_S | zf_Z | zf_P | zf_C)) | zf_H | zf_N | (A & (zf_X | zf_Y));
+}
+
+static inline void scf(Z80_CPU* cpu) {
+  F = (F & (zf_S | zf_Z | zf_P)) | (A & (zf_X | zf_Y)) | zf_C;
+}
+
+static inline void ccf(Z80_CPU* cpu) {
+  F = ((F & (zf_S | zf_Z | zf_P | zf_C)) | ((F & zf_C) << 4)
+      | (A & (zf_X | zf_Y))) ^ zf_C;
+}
+
+#endif /* z80core_h */
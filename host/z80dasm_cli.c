@@ -0,0 +1,399 @@
+/*
+ * Lists a raw binary or Intel HEX image. The file is mapped rather than
+ * read; HEX records are decoded straight from the mapping into the image.
+ * Listing runs on a pool of workers and goes out through one large buffer.
+ *
+ * A raw image is loaded at org. With -b, it is a set of bank-size banks
+ * that are all listed at org, as for ROM banks paged into one window.
+ * HEX extended address records select 64 KiB banks. -s and -e limit the
+ * listing of every bank to addresses start up to, not including, end.
+ *
+ *   cc -O2 -I.. -o z80dasm z80dasm_cli.c z80list.c z80par.c z80pool.c \
+ *       z80sym.c ../z80dasm.c -lpthread
+ *   z80dasm [-i] [-o org] [-b bank-size] [-s start] [-e end] [-j threads]
+ *       [-y symbols] [-l] [-d | -H] image
+ */
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "z80par.h"
+#include "z80pool.h"
+#include "z80sym.h"
+
+#define BANK_SIZE 0x10000
+#define CHUNK 4096
+#define MAX_REGIONS (BANK_SIZE / CHUNK + 2)
+#define FLUSH_SIZE (1 << 20)
+
+/* addr holds the bank in its upper bits and the CPU address in the lower 16 */
+typedef struct {
+  uint32_t addr;
+  const uint8_t* mem;
+  size_t len;
+} Segment;
+
+typedef struct {
+  Segment* segs;
+  size_t count;
+  size_t cap;
+  uint8_t* data;
+} Image;
+
+typedef struct {
+  int fd;
+  Z80_Buf buf;
+} Writer;
+
+typedef struct {
+  uint32_t low;
+  uint32_t high;
+} Extent;
+
+static int outOfMemory(void) {
+  fprintf(stderr, "z80dasm: out of memory\n");
+  return -1;
+}
+
+static int addSegment(Image* image, uint32_t addr, const uint8_t* mem,
+    size_t len) {
+  if (image->count == image->cap) {
+    size_t cap = image->cap != 0 ? image->cap * 2 : 16;
+    Segment* segs = (Segment*) realloc(image->segs, cap * sizeof(Segment));
+    if (segs == NULL) return outOfMemory();
+    image->segs = segs;
+    image->cap = cap;
+  }
+  image->segs[image->count].addr = addr;
+  image->segs[image->count].mem = mem;
+  image->segs[image->count].len = len;
+  image->count++;
+  return 0;
+}
+
+static int loadRaw(Image* image, const uint8_t* mem, size_t len,
+    uint32_t org, uint32_t bank_size) {
+  uint32_t bank = 0;
+  size_t offset = 0;
+  while (offset < len) {
+    size_t n = bank_size != 0 ? bank_size : BANK_SIZE - org;
+    if (n > len - offset) n = len - offset;
+    if (addSegment(image, bank << 16 | org, mem + offset, n) != 0) return -1;
+    offset += n;
+    bank++;
+    /* an unbanked image continues across the 64 KiB boundary */
+    if (bank_size == 0) org = 0;
+  }
+  return 0;
+}
+
+static int hexDigit(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+static int hexByte(const char* p) {
+  int high = hexDigit(p[0]);
+  int low = hexDigit(p[1]);
+  return high < 0 || low < 0 ? -1 : high << 4 | low;
+}
+
+/*
+ * Walks the records in the len characters at text. Without image, checks
+ * them and sets extent to the span of their data; with it, copies the data
+ * into image->data, which holds that span, and adds a segment per record.
+ */
+static int parseHex(const char* path, const char* text, size_t len,
+    Image* image, Extent* extent) {
+  const char* end = text + len;
+  const char* p = text;
+  uint32_t base = 0;
+  unsigned line = 1;
+
+  if (image == NULL) {
+    extent->low = UINT32_MAX;
+    extent->high = 0;
+  }
+  while (p < end) {
+    int count, type, sum;
+    uint32_t addr;
+    if (*p == '\n' || *p == '\r' || *p == ' ' || *p == '\t') {
+      if (*p++ == '\n') line++;
+      continue;
+    }
+    if (*p != ':' || end - p < 11 || (count = hexByte(p + 1)) < 0 ||
+        end - p < 11 + 2 * count) {
+      fprintf(stderr, "%s:%u: malformed record\n", path, line);
+      return -1;
+    }
+    sum = 0;
+    for (int i = 0; i < count + 5; i++) {
+      int b = hexByte(p + 1 + 2 * i);
+      if (b < 0) {
+        fprintf(stderr, "%s:%u: malformed record\n", path, line);
+        return -1;
+      }
+      sum += b;
+    }
+    if ((sum & 0xff) != 0) {
+      fprintf(stderr, "%s:%u: checksum mismatch\n", path, line);
+      return -1;
+    }
+
+    addr = (uint32_t) (hexByte(p + 3) << 8 | hexByte(p + 5));
+    type = hexByte(p + 7);
+    switch (type) {
+      case 0:
+        addr += base;
+        if (image == NULL) {
+          if (addr < extent->low) extent->low = addr;
+          if (addr + count > extent->high) extent->high = addr + count;
+        }
+        else if (count != 0) {
+          uint8_t* dest = image->data + (addr - extent->low);
+          for (int i = 0; i < count; i++) {
+            dest[i] = (uint8_t) hexByte(p + 9 + 2 * i);
+          }
+          if (addSegment(image, addr, dest, (size_t) count) != 0) return -1;
+        }
+        break;
+      case 1:
+        return 0;
+      case 2:
+        base = (uint32_t) (hexByte(p + 9) << 8 | hexByte(p + 11)) << 4;
+        break;
+      case 4:
+        base = (uint32_t) (hexByte(p + 9) << 8 | hexByte(p + 11)) << 16;
+        break;
+      default:
+        /* start addresses have no bearing on the listing */
+        break;
+    }
+    p += 11 + 2 * count;
+  }
+  return 0;
+}
+
+static int compareSegments(const void* a, const void* b) {
+  uint32_t x = ((const Segment*) a)->addr;
+  uint32_t y = ((const Segment*) b)->addr;
+  return x < y ? -1 : x > y;
+}
+
+static int loadHex(Image* image, const char* path, const char* text,
+    size_t len) {
+  Extent extent;
+  size_t n = 0;
+  if (parseHex(path, text, len, NULL, &extent) != 0) return -1;
+  if (extent.low >= extent.high) return 0;
+  image->data = (uint8_t*) calloc(extent.high - extent.low, 1);
+  if (image->data == NULL) return outOfMemory();
+  if (parseHex(path, text, len, image, &extent) != 0) return -1;
+
+  /* records may come in any order and overlap; coalesce them into runs */
+  qsort(image->segs, image->count, sizeof(Segment), compareSegments);
+  for (size_t i = 0; i < image->count; i++) {
+    Segment* seg = &image->segs[i];
+    if (n != 0) {
+      Segment* last = &image->segs[n - 1];
+      if (seg->addr <= last->addr + last->len) {
+        size_t end = seg->addr - last->addr + seg->len;
+        if (end > last->len) last->len = end;
+        continue;
+      }
+    }
+    image->segs[n++] = *seg;
+  }
+  image->count = n;
+  return 0;
+}
+
+static int flushOut(Writer* out) {
+  size_t done = 0;
+  while (done < out->buf.len) {
+    ssize_t n = write(out->fd, out->buf.data + done, out->buf.len - done);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      perror("z80dasm: write");
+      return -1;
+    }
+    done += (size_t) n;
+  }
+  out->buf.len = 0;
+  return 0;
+}
+
+static int listPiece(Writer* out, const uint8_t* mem, size_t len,
+    uint16_t base_addr, int threads, int syntax, const Z80_Symbols* syms) {
+  Z80_Region regions[MAX_REGIONS];
+  size_t n = z80_par_split(mem, len, base_addr, CHUNK, regions, MAX_REGIONS);
+  if (z80_par_list_sym(regions, n, threads, syntax,
+      syms != NULL ? z80_sym_lookup : NULL, syms, &out->buf) != 0) {
+    return outOfMemory();
+  }
+  return out->buf.len >= FLUSH_SIZE ? flushOut(out) : 0;
+}
+
+static int listImage(Writer* out, const Image* image, uint32_t start,
+    uint32_t end, int threads, int syntax, const Z80_Symbols* syms) {
+  int banked = 0;
+  long bank = -1;
+  for (size_t i = 0; i < image->count; i++) {
+    const Segment* seg = &image->segs[i];
+    if (seg->addr + seg->len > BANK_SIZE) banked = 1;
+  }
+
+  for (size_t i = 0; i < image->count; i++) {
+    const Segment* seg = &image->segs[i];
+    size_t offset = 0;
+    while (offset < seg->len) {
+      uint32_t addr = seg->addr + (uint32_t) offset;
+      uint32_t low = addr & (BANK_SIZE - 1);
+      uint32_t high = low + (uint32_t) (seg->len - offset);
+      if (high > BANK_SIZE) high = BANK_SIZE;
+      if (low < start) low = start;
+      if (high > end) high = end;
+      if (low < high) {
+        if (banked && (long) (addr >> 16) != bank) {
+          char header[32];
+          int n;
+          bank = addr >> 16;
+          n = snprintf(header, sizeof(header), "%s; bank %ld\n",
+              bank != (long) (image->segs[0].addr >> 16) ? "\n" : "", bank);
+          if (z80_buf_append(&out->buf, header, (size_t) n) != 0) {
+            return outOfMemory();
+          }
+        }
+        if (listPiece(out, seg->mem + offset + (low - (addr & (BANK_SIZE - 1))),
+            high - low, (uint16_t) low, threads, syntax, syms) != 0) {
+          return -1;
+        }
+      }
+      offset += BANK_SIZE - (addr & (BANK_SIZE - 1));
+    }
+  }
+  return flushOut(out);
+}
+
+static int isHexPath(const char* path) {
+  const char* dot = strrchr(path, '.');
+  return dot != NULL && (strcmp(dot, ".hex") == 0 || strcmp(dot, ".ihx") == 0 ||
+      strcmp(dot, ".HEX") == 0 || strcmp(dot, ".IHX") == 0);
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: z80dasm [-i] [-o org] [-b bank-size] [-s start] "
+      "[-e end] [-j threads]\n               [-y symbols] [-l] [-d | -H] image\n");
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  Image image = { NULL, 0, 0, NULL };
+  Writer out = { STDOUT_FILENO, { NULL, 0, 0 } };
+  Z80_Symbols syms;
+  const char* sym_path = NULL;
+  const char* path;
+  unsigned long org = 0;
+  unsigned long bank_size = 0;
+  unsigned long start = 0;
+  unsigned long end = BANK_SIZE;
+  int threads = z80_pool_default_threads();
+  int syntax = fmt_Zilog;
+  int hex = 0;
+  void* map = NULL;
+  struct stat st;
+  int rc = 1;
+  int fd;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "io:b:s:e:j:y:ldH")) != -1) {
+    switch (opt) {
+      case 'i':
+        hex = 1;
+        break;
+      case 'o':
+        org = strtoul(optarg, NULL, 0);
+        break;
+      case 'b':
+        bank_size = strtoul(optarg, NULL, 0);
+        break;
+      case 's':
+        start = strtoul(optarg, NULL, 0);
+        break;
+      case 'e':
+        end = strtoul(optarg, NULL, 0);
+        break;
+      case 'j':
+        threads = atoi(optarg);
+        break;
+      case 'y':
+        sym_path = optarg;
+        break;
+      case 'l':
+        syntax |= fmt_Lower;
+        break;
+      case 'd':
+        syntax |= fmt_HexDollar;
+        break;
+      case 'H':
+        syntax |= fmt_HexSuffix;
+        break;
+      default:
+        usage();
+    }
+  }
+  if (optind != argc - 1 || org >= BANK_SIZE || org + bank_size > BANK_SIZE ||
+      start >= end || end > BANK_SIZE || threads < 1) {
+    usage();
+  }
+  path = argv[optind];
+  if (isHexPath(path)) hex = 1;
+
+  if (sym_path != NULL) {
+    if (z80_sym_init(&syms) != 0) {
+      outOfMemory();
+      return 1;
+    }
+    if (z80_sym_load(&syms, sym_path) < 0) {
+      perror(sym_path);
+      return 1;
+    }
+  }
+
+  fd = open(path, O_RDONLY);
+  if (fd < 0 || fstat(fd, &st) != 0) {
+    perror(path);
+    return 1;
+  }
+  if (st.st_size != 0) {
+    map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED) {
+      perror(path);
+      return 1;
+    }
+    madvise(map, (size_t) st.st_size, MADV_SEQUENTIAL);
+  }
+  close(fd);
+
+  if ((hex ? loadHex(&image, path, (const char*) map, (size_t) st.st_size) :
+      loadRaw(&image, (const uint8_t*) map, (size_t) st.st_size,
+          (uint32_t) org, (uint32_t) bank_size)) == 0 &&
+      listImage(&out, &image, (uint32_t) start, (uint32_t) end, threads,
+      syntax, sym_path != NULL ? &syms : NULL) == 0) {
+    rc = 0;
+  }
+
+  if (map != NULL) munmap(map, (size_t) st.st_size);
+  z80_buf_free(&out.buf);
+  free(image.segs);
+  free(image.data);
+  if (sym_path != NULL) z80_sym_free(&syms);
+  return rc;
+}
@@ -0,0 +1,631 @@
+#include <string.h>
+
+#include "z80emu.h"
+#include "z80core.h"
+
+/* T-states of the unprefixed opcodes, conditional ones when not taken */
+static const uint8_t s_cycles[256] = {
+  4, 10,  7,  6,  4,  4,  7,  4,  4, 11,  7,  6,  4,  4,  7,  4,
+  8, 10,  7,  6,  4,  4,  7,  4, 12, 11,  7,  6,  4,  4,  7,  4,
+  7, 10, 16,  6,  4,  4,  7,  4,  7, 11, 16,  6,  4,  4,  7,  4,
+  7, 10, 13,  6, 11, 11, 10,  4,  7, 11, 13,  6,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  7,  7,  7,  7,  7,  7,  4,  7,  4,  4,  4,  4,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  5, 10, 10, 10, 10, 11,  7, 11,  5, 10, 10,  0, 10, 17,  7, 11,
+  5, 10, 10, 11, 10, 11,  7, 11,  5,  4, 10, 11, 10,  0,  7, 11,
+  5, 10, 10, 19, 10, 11,  7, 11,  5,  4, 10,  4, 10,  0,  7, 11,
+  5, 10, 10,  4, 10, 11,  7, 11,  5,  6, 10,  4, 10,  0,  7, 11
+};
+
+static inline void wr(Z80_CPU* cpu, uint16_t addr, uint8_t v) {
+  cpu->mem[addr] = v;
+  if (cpu->dirty != NULL) cpu->dirty[addr >> 11] |= 1 << ((addr >> 8) & 7);
+}
+
+static inline void wr16(Z80_CPU* cpu, uint16_t addr, uint16_t v) {
+  wr(cpu, addr, (uint8_t) v);
+  wr(cpu, (uint16_t) (addr + 1), (uint8_t) (v >> 8));
+}
+
+static inline uint8_t fetch(Z80_CPU* cpu) {
+  return rd(cpu, cpu->pc++);
+}
+
+static inline uint16_t fetch16(Z80_CPU* cpu) {
+  uint16_t v = rd16(cpu, cpu->pc);
+  cpu->pc += 2;
+  return v;
+}
+
+/* an M1 cycle: fetches an opcode and refreshes R */
+static inline uint8_t fetchOp(Z80_CPU* cpu) {
+  cpu->r++;
+  return rd(cpu, cpu->pc++);
+}
+
+static inline void push(Z80_CPU* cpu, uint16_t v) {
+  cpu->sp.w -= 2;
+  wr16(cpu, cpu->sp.w, v);
+}
+
+static inline uint16_t pop(Z80_CPU* cpu) {
+  uint16_t v = rd16(cpu, cpu->sp.w);
+  cpu->sp.w += 2;
+  return v;
+}
+
+/* register r of an opcode's 3-bit field, H and L replaced by xy's halves */
+static inline uint8_t* reg8(Z80_CPU* cpu, int r, Z80_Pair* xy) {
+  switch (r) {
+    case 0: return &cpu->bc.b.h;
+    case 1: return &cpu->bc.b.l;
+    case 2: return &cpu->de.b.h;
+    case 3: return &cpu->de.b.l;
+    case 4: return &xy->b.h;
+    case 5: return &xy->b.l;
+    default: return &cpu->af.b.h;
+  }
+}
+
+/* register pair p of an opcode's 2-bit field, with SP as pair 3 */
+static inline Z80_Pair* reg16(Z80_CPU* cpu, int p, Z80_Pair* xy) {
+  switch (p) {
+    case 0: return &cpu->bc;
+    case 1: return &cpu->de;
+    case 2: return xy;
+    default: return &cpu->sp;
+  }
+}
+
+/*
+ * Address of the (HL) operand: HL itself, or IX/IY plus a displacement
+ * fetched from the instruction, which costs t another 8 T-states.
+ */
+static inline uint16_t memAddr(Z80_CPU* cpu, Z80_Pair* xy, int* t) {
+  if (xy == &cpu->hl) return cpu->hl.w;
+  *t += 8;
+  return (uint16_t) (xy->w + (int8_t) fetch(cpu));
+}
+
+static int execCB(Z80_CPU* cpu, Z80_Pair* xy) {
+  uint16_t addr = 0;
+  uint8_t op, v;
+  int x, y, z;
+  if (xy != &cpu->hl) {
+    /* DD CB d op: no M1 cycle for d or op */
+    addr = (uint16_t) (xy->w + (int8_t) fetch(cpu));
+    op = fetch(cpu);
+  }
+  else {
+    op = fetchOp(cpu);
+  }
+  x = op >> 6;
+  y = (op >> 3) & 7;
+  z = op & 7;
+
+  if (xy != &cpu->hl) {
+    v = rd(cpu, addr);
+    if (x == 1) {
+      bit(cpu, y, v, (uint8_t) (addr >> 8));
+      return 16;
+    }
+    if (x == 0) v = rotate(cpu, y, v);
+    else if (x == 2) v &= ~(1 << y);
+    else v |= 1 << y;
+    wr(cpu, addr, v);
+    /* undocumented: the result is also copied to register z */
+    if (z != 6) *reg8(cpu, z, &cpu->hl) = v;
+    return 19;
+  }
+
+  if (z == 6) {
+    v = rd(cpu, cpu->hl.w);
+    if (x == 1) {
+      bit(cpu, y, v, cpu->hl.b.h);
+      return 12;
+    }
+    if (x == 0) v = rotate(cpu, y, v);
+    else if (x == 2) v &= ~(1 << y);
+    else v |= 1 << y;
+    wr(cpu, cpu->hl.w, v);
+    return 15;
+  }
+
+  {
+    uint8_t* r = reg8(cpu, z, &cpu->hl);
+    if (x == 0) *r = rotate(cpu, y, *r);
+    else if (x == 1) bit(cpu, y, *r, *r);
+    else if (x == 2) *r &= ~(1 << y);
+    else *r |= 1 << y;
+  }
+  return 8;
+}
+
+/* LDI/LDD/CPI/CPD/INI/IND/OUTI/OUTD and their repeating forms */
+static int blockOp(Z80_CPU* cpu, int y, int z) {
+  int dir = (y & 1) != 0 ? -1 : 1;
+  int repeat = y >= 6;
+  uint8_t v;
+  unsigned k;
+  switch (z) {
+    case 0:
+      v = rd(cpu, cpu->hl.w);
+      wr(cpu, cpu->de.w, v);
+      cpu->hl.w += dir;
+      cpu->de.w += dir;
+      cpu->bc.w--;
+      k = v + A;
+      F = (F & (zf_S | zf_Z | zf_C)) | (cpu->bc.w != 0 ? zf_P : 0)
+          | (k & zf_X) | ((k & 0x02) << 4);
+      if (repeat && cpu->bc.w != 0) break;
+      return 16;
+    case 1: {
+      uint8_t r, half;
+      v = rd(cpu, cpu->hl.w);
+      r = A - v;
+      half = (A ^ v ^ r) & zf_H;
+      k = (uint8_t) (r - (half != 0));
+      cpu->hl.w += dir;
+      cpu->bc.w--;
+      F = (F & zf_C) | zf_N | (sz(r) & (zf_S | zf_Z)) | half
+          | (cpu->bc.w != 0 ? zf_P : 0) | (k & zf_X) | ((k & 0x02) << 4);
+      if (repeat && cpu->bc.w != 0 && r != 0) break;
+      return 16;
+    }
+    case 2:
+      v = in(cpu, cpu->bc.w);
+      wr(cpu, cpu->hl.w, v);
+      cpu->hl.w += dir;
+      B--;
+      k = v + (uint8_t) (C + dir);
+      F = sz(B) | ((v & 0x80) >> 6) | (k > 0xff ? zf_H | zf_C : 0)
+          | (s_szp[(k & 7) ^ B] & zf_P);
+      if (repeat && B != 0) break;
+      return 16;
+    default:
+      v = rd(cpu, cpu->hl.w);
+      B--;
+      out(cpu, cpu->bc.w, v);
+      cpu->hl.w += dir;
+      k = v + L;
+      F = sz(B) | ((v & 0x80) >> 6) | (k > 0xff ? zf_H | zf_C : 0)
+          | (s_szp[(k & 7) ^ B] & zf_P);
+      if (repeat && B != 0) break;
+      return 16;
+  }
+  cpu->pc -= 2;
+  return 21;
+}
+
+static int execED(Z80_CPU* cpu) {
+  uint8_t op = fetchOp(cpu);
+  int x = op >> 6;
+  int y = (op >> 3) & 7;
+  int z = op & 7;
+
+  if (x == 2 && z <= 3 && y >= 4) return blockOp(cpu, y, z);
+  if (x != 1) return 8;
+
+  switch (z) {
+    case 0: {
+      uint8_t v = in(cpu, cpu->bc.w);
+      F = (F & zf_C) | s_szp[v];
+      if (y != 6) *reg8(cpu, y, &cpu->hl) = v;
+      return 12;
+    }
+    case 1:
+      out(cpu, cpu->bc.w, y != 6 ? *reg8(cpu, y, &cpu->hl) : 0);
+      return 12;
+    case 2:
+      if ((y & 1) == 0) cpu->hl.w = sbc16(cpu, cpu->hl.w, reg16(cpu, y >> 1, &cpu->hl)->w);
+      else cpu->hl.w = adc16(cpu, cpu->hl.w, reg16(cpu, y >> 1, &cpu->hl)->w);
+      return 15;
+    case 3: {
+      uint16_t addr = fetch16(cpu);
+      Z80_Pair* rr = reg16(cpu, y >> 1, &cpu->hl);
+      if ((y & 1) == 0) wr16(cpu, addr, rr->w);
+      else rr->w = rd16(cpu, addr);
+      return 20;
+    }
+    case 4: {
+      uint8_t v = A;
+      A = 0;
+      A = sub8(cpu, v, 0);
+      return 8;
+    }
+    case 5:
+      /* RETN and RETI both restore IFF1 */
+      cpu->iff1 = cpu->iff2;
+      cpu->pc = pop(cpu);
+      return 14;
+    case 6:
+      cpu->im = (y & 3) <= 1 ? 0 : (y & 3) - 1;
+      return 8;
+    default:
+      switch (y) {
+        case 0:
+          cpu->i = A;
+          return 9;
+        case 1:
+          cpu->r = A;
+          cpu->r7 = A & 0x80;
+          return 9;
+        case 2:
+          A = cpu->i;
+          F = (F & zf_C) | sz(A) | (cpu->iff2 ? zf_P : 0);
+          return 9;
+        case 3:
+          A = (cpu->r & 0x7f) | cpu->r7;
+          F = (F & zf_C) | sz(A) | (cpu->iff2 ? zf_P : 0);
+          return 9;
+        case 4: {
+          uint8_t m = rd(cpu, cpu->hl.w);
+          wr(cpu, cpu->hl.w, (uint8_t) (A << 4 | m >> 4));
+          A = (A & 0xf0) | (m & 0x0f);
+          F = (F & zf_C) | s_szp[A];
+          return 18;
+        }
+        case 5: {
+          uint8_t m = rd(cpu, cpu->hl.w);
+          wr(cpu, cpu->hl.w, (uint8_t) (m << 4 | (A & 0x0f)));
+          A = (A & 0xf0) | (m >> 4);
+          F = (F & zf_C) | s_szp[A];
+          return 18;
+        }
+        default:
+          return 8;
+      }
+  }
+}
+
+/*
+ * Executes the opcode op, already fetched. xy is &cpu->hl, or &cpu->ix
+ * or &cpu->iy after a DD or FD prefix.
+ */
+static int execOp(Z80_CPU* cpu, uint8_t op, Z80_Pair* xy) {
+  int t = s_cycles[op];
+  int y = (op >> 3) & 7;
+  int z = op & 7;
+
+  if (op >= 0x40 && op < 0xc0) {
+    if (op < 0x80) {
+      if (op == 0x76) {
+        cpu->halted = 1;
+      }
+      else if (z == 6) {
+        /* LD r,(IX+d) loads the real H or L */
+        *reg8(cpu, y, &cpu->hl) = rd(cpu, memAddr(cpu, xy, &t));
+      }
+      else if (y == 6) {
+        wr(cpu, memAddr(cpu, xy, &t), *reg8(cpu, z, &cpu->hl));
+      }
+      else {
+        *reg8(cpu, y, xy) = *reg8(cpu, z, xy);
+      }
+    }
+    else {
+      alu(cpu, y, z == 6 ? rd(cpu, memAddr(cpu, xy, &t)) : *reg8(cpu, z, xy));
+    }
+    return t;
+  }
+
+  switch (op) {
+    case 0x00:
+      break;
+    case 0x01: case 0x11: case 0x21: case 0x31:
+      reg16(cpu, y >> 1, xy)->w = fetch16(cpu);
+      break;
+    case 0x02:
+      wr(cpu, cpu->bc.w, A);
+      break;
+    case 0x12:
+      wr(cpu, cpu->de.w, A);
+      break;
+    case 0x0a:
+      A = rd(cpu, cpu->bc.w);
+      break;
+    case 0x1a:
+      A = rd(cpu, cpu->de.w);
+      break;
+    case 0x22:
+      wr16(cpu, fetch16(cpu), xy->w);
+      break;
+    case 0x2a:
+      xy->w = rd16(cpu, fetch16(cpu));
+      break;
+    case 0x32:
+      wr(cpu, fetch16(cpu), A);
+      break;
+    case 0x3a:
+      A = rd(cpu, fetch16(cpu));
+      break;
+    case 0x03: case 0x13: case 0x23: case 0x33:
+      reg16(cpu, y >> 1, xy)->w++;
+      break;
+    case 0x0b: case 0x1b: case 0x2b: case 0x3b:
+      reg16(cpu, y >> 1, xy)->w--;
+      break;
+    case 0x09: case 0x19: case 0x29: case 0x39:
+      xy->w = add16(cpu, xy->w, reg16(cpu, y >> 1, xy)->w);
+      break;
+    case 0x04: case 0x0c: case 0x14: case 0x1c: case 0x24: case 0x2c: case 0x3c: {
+      uint8_t* r = reg8(cpu, y, xy);
+      *r = inc8(cpu, *r);
+      break;
+    }
+    case 0x05: case 0x0d: case 0x15: case 0x1d: case 0x25: case 0x2d: case 0x3d: {
+      uint8_t* r = reg8(cpu, y, xy);
+      *r = dec8(cpu, *r);
+      break;
+    }
+    case 0x34: {
+      uint16_t addr = memAddr(cpu, xy, &t);
+      wr(cpu, addr, inc8(cpu, rd(cpu, addr)));
+      break;
+    }
+    case 0x35: {
+      uint16_t addr = memAddr(cpu, xy, &t);
+      wr(cpu, addr, dec8(cpu, rd(cpu, addr)));
+      break;
+    }
+    case 0x06: case 0x0e: case 0x16: case 0x1e: case 0x26: case 0x2e: case 0x3e:
+      *reg8(cpu, y, xy) = fetch(cpu);
+      break;
+    case 0x36: {
+      uint16_t addr = memAddr(cpu, xy, &t);
+      if (xy != &cpu->hl) t -= 3;
+      wr(cpu, addr, fetch(cpu));
+      break;
+    }
+    case 0x07: case 0x0f: case 0x17: case 0x1f:
+      rotateA(cpu, y);
+      break;
+    case 0x08: {
+      uint16_t v = cpu->af.w;
+      cpu->af.w = cpu->af_.w;
+      cpu->af_.w = v;
+      break;
+    }
+    case 0x10: {
+      int8_t d = (int8_t) fetch(cpu);
+      if (--B != 0) {
+        cpu->pc += d;
+        t += 5;
+      }
+      break;
+    }
+    case 0x18:
+      cpu->pc += (int8_t) fetch(cpu);
+      break;
+    case 0x20: case 0x28: case 0x30: case 0x38: {
+      int8_t d = (int8_t) fetch(cpu);
+      if (condition(cpu, y - 4)) {
+        cpu->pc += d;
+        t += 5;
+      }
+      break;
+    }
+    case 0x27:
+      daa(cpu);
+      break;
+    case 0x2f:
+      cpl(cpu);
+      break;
+    case 0x37:
+      scf(cpu);
+      break;
+    case 0x3f:
+      ccf(cpu);
+      break;
+    case 0xc0: case 0xc8: case 0xd0: case 0xd8:
+    case 0xe0: case 0xe8: case 0xf0: case 0xf8:
+      if (condition(cpu, y)) {
+        cpu->pc = pop(cpu);
+        t += 6;
+      }
+      break;
+    case 0xc9:
+      cpu->pc = pop(cpu);
+      break;
+    case 0xc1: case 0xd1: case 0xe1:
+      reg16(cpu, y >> 1, xy)->w = pop(cpu);
+      break;
+    case 0xf1:
+      cpu->af.w = pop(cpu);
+      break;
+    case 0xc5: case 0xd5: case 0xe5:
+      push(cpu, reg16(cpu, y >> 1, xy)->w);
+      break;
+    case 0xf5:
+      push(cpu, cpu->af.w);
+      break;
+    case 0xc2: case 0xca: case 0xd2: case 0xda:
+    case 0xe2: case 0xea: case 0xf2: case 0xfa: {
+      uint16_t addr = fetch16(cpu);
+      if (condition(cpu, y)) cpu->pc = addr;
+      break;
+    }
+    case 0xc3:
+      cpu->pc = fetch16(cpu);
+      break;
+    case 0xc4: case 0xcc: case 0xd4: case 0xdc:
+    case 0xe4: case 0xec: case 0xf4: case 0xfc: {
+      uint16_t addr = fetch16(cpu);
+      if (condition(cpu, y)) {
+        push(cpu, cpu->pc);
+        cpu->pc = addr;
+        t += 7;
+      }
+      break;
+    }
+    case 0xcd: {
+      uint16_t addr = fetch16(cpu);
+      push(cpu, cpu->pc);
+      cpu->pc = addr;
+      break;
+    }
+    case 0xc6: case 0xce: case 0xd6: case 0xde:
+    case 0xe6: case 0xee: case 0xf6: case 0xfe:
+      alu(cpu, y, fetch(cpu));
+      break;
+    case 0xc7: case 0xcf: case 0xd7: case 0xdf:
+    case 0xe7: case 0xef: case 0xf7: case 0xff:
+      if (cpu->rst_trap != NULL &&
+          cpu->rst_trap(cpu->trap_ctx, cpu, (uint8_t) (y << 3))) {
+        break;
+      }
+      push(cpu, cpu->pc);
+      cpu->pc = (uint16_t) (y << 3);
+      break;
+    case 0xd3: {
+      uint8_t n = fetch(cpu);
+      out(cpu, (uint16_t) (A << 8 | n), A);
+      break;
+    }
+    case 0xdb: {
+      uint8_t n = fetch(cpu);
+      A = in(cpu, (uint16_t) (A << 8 | n));
+      break;
+    }
+    case 0xd9: {
+      uint16_t v;
+      v = cpu->bc.w; cpu->bc.w = cpu->bc_.w; cpu->bc_.w = v;
+      v = cpu->de.w; cpu->de.w = cpu->de_.w; cpu->de_.w = v;
+      v = cpu->hl.w; cpu->hl.w = cpu->hl_.w; cpu->hl_.w = v;
+      break;
+    }
+    case 0xe3: {
+      uint16_t v = rd16(cpu, cpu->sp.w);
+      wr16(cpu, cpu->sp.w, xy->w);
+      xy->w = v;
+      break;
+    }
+    case 0xe9:
+      cpu->pc = xy->w;
+      break;
+    case 0xeb: {
+      uint16_t v = cpu->de.w;
+      cpu->de.w = cpu->hl.w;
+      cpu->hl.w = v;
+      break;
+    }
+    case 0xf9:
+      cpu->sp.w = xy->w;
+      break;
+    case 0xf3:
+      cpu->iff1 = cpu->iff2 = 0;
+      break;
+    case 0xfb:
+      cpu->iff1 = cpu->iff2 = 1;
+      cpu->ei_shadow = 1;
+      break;
+    case 0xcb:
+      t = execCB(cpu, xy);
+      break;
+    case 0xed:
+      /* an index prefix has no effect on the ED page */
+      t = execED(cpu);
+      break;
+    case 0xdd:
+      t = 4 + execOp(cpu, fetchOp(cpu), &cpu->ix);
+      break;
+    case 0xfd:
+      t = 4 + execOp(cpu, fetchOp(cpu), &cpu->iy);
+      break;
+  }
+  return t;
+}
+
+/*
+ * Accepts an NMI, or a maskable interrupt if enabled. In IM 0 the data
+ * bus byte is expected to be an RST; anything else is taken as RST 0x38.
+ */
+static int interrupt(Z80_CPU* cpu) {
+  cpu->halted = 0;
+  cpu->r++;
+  if (cpu->nmi) {
+    cpu->nmi = 0;
+    cpu->iff1 = 0;
+    push(cpu, cpu->pc);
+    cpu->pc = 0x66;
+    return 11;
+  }
+  cpu->iff1 = cpu->iff2 = 0;
+  push(cpu, cpu->pc);
+  switch (cpu->im) {
+    case 0:
+      cpu->pc = (cpu->irq_data & 0xc7) == 0xc7 ? cpu->irq_data & 0x38 : 0x38;
+      return 13;
+    case 1:
+      cpu->pc = 0x38;
+      return 13;
+    default:
+      cpu->pc = rd16(cpu, (uint16_t) (cpu->i << 8 | (cpu->irq_data & 0xfe)));
+      return 19;
+  }
+}
+
+static inline int step(Z80_CPU* cpu) {
+  int t;
+  if ((cpu->nmi || (cpu->irq && cpu->iff1)) && !cpu->ei_shadow) {
+    t = interrupt(cpu);
+  }
+  else {
+    cpu->ei_shadow = 0;
+    if (cpu->halted) {
+      cpu->r++;
+      t = 4;
+    }
+    else {
+      t = execOp(cpu, fetchOp(cpu), &cpu->hl);
+    }
+  }
+  cpu->cycles += t;
+  return t;
+}
+
+void z80_cpu_init(Z80_CPU* cpu, uint8_t* mem, Z80_InFn in, Z80_OutFn out,
+    void* io_ctx) {
+  memset(cpu, 0, sizeof(*cpu));
+  cpu->mem = mem;
+  cpu->in = in;
+  cpu->out = out;
+  cpu->io_ctx = io_ctx;
+  z80_cpu_reset(cpu);
+}
+
+void z80_cpu_reset(Z80_CPU* cpu) {
+  cpu->pc = 0;
+  cpu->i = 0;
+  cpu->r = 0;
+  cpu->r7 = 0;
+  cpu->iff1 = cpu->iff2 = 0;
+  cpu->im = 0;
+  cpu->halted = 0;
+  cpu->ei_shadow = 0;
+  cpu->af.w = 0xffff;
+  cpu->sp.w = 0xffff;
+}
+
+int z80_cpu_step(Z80_CPU* cpu) {
+  return step(cpu);
+}
+
+uint64_t z80_cpu_run(Z80_CPU* cpu, uint64_t cycles) {
+  uint64_t start = cpu->cycles;
+  cpu->run_end = start + cycles;
+  if (cpu->runner != NULL) {
+    cpu->runner(cpu->run_ctx, cpu);
+    return cpu->cycles - start;
+  }
+  while (cpu->cycles < cpu->run_end && !z80_cpu_stopped(cpu)) {
+    step(cpu);
+  }
+  return cpu->cycles - start;
+}
@@ -0,0 +1,123 @@
+#ifndef z80emu_h
+#define z80emu_h
+
+#include <stdint.h>
+
+#define Z80_MEM_SIZE 65536
+#define Z80_PAGE_COUNT 256
+
+typedef enum {
+  zf_C = 0x01,
+  zf_N = 0x02,
+  zf_P = 0x04,
+  zf_X = 0x08,
+  zf_H = 0x10,
+  zf_Y = 0x20,
+  zf_Z = 0x40,
+  zf_S = 0x80
+} Z80_Flags;
+
+typedef union {
+  uint16_t w;
+  struct {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    uint8_t h, l;
+#else
+    uint8_t l, h;
+#endif
+  } b;
+} Z80_Pair;
+
+typedef struct Z80_CPU Z80_CPU;
+
+typedef uint8_t (*Z80_InFn)(void* ctx, uint16_t port);
+typedef void (*Z80_OutFn)(void* ctx, uint16_t port, uint8_t value);
+
+/*
+ * Called as an RST to vector executes, with PC past the RST and nothing
+ * pushed yet. Returns 0 to let the RST proceed, or nonzero if it has done
+ * the work of the handler itself and left the CPU in the state to resume
+ * from; the RST's own T-states are still counted.
+ */
+typedef int (*Z80_TrapFn)(void* ctx, Z80_CPU* cpu, uint8_t vector);
+
+/*
+ * Runs cpu in place of z80_cpu_run()'s loop of steps, with the same
+ * result: until the cycle count reaches run_end or the CPU stops.
+ */
+typedef void (*Z80_RunFn)(void* ctx, Z80_CPU* cpu);
+
+/*
+ * Processor state. mem is the caller's 64 KiB address space. An I/O
+ * device asserts the maskable interrupt by setting irq (a level: leave it
+ * set until the device is serviced) with the byte it places on the data
+ * bus in irq_data, and requests an NMI by setting nmi, which the CPU
+ * clears when it accepts it. When dirty is not NULL, every write by the
+ * CPU sets the bit for its 256-byte page in that Z80_PAGE_COUNT-bit map.
+ * rst_trap, when not NULL, sees every RST instruction executed. During
+ * z80_cpu_run(), a callback may lower run_end to make the run return once
+ * the cycle count reaches it, e.g. when a device's next event falls due.
+ * runner, when not NULL, does the running for z80_cpu_run(), e.g. from
+ * translated code (see z80xlat.h).
+ */
+struct Z80_CPU {
+  Z80_Pair af, bc, de, hl;
+  Z80_Pair af_, bc_, de_, hl_;
+  Z80_Pair ix, iy, sp;
+  uint16_t pc;
+  uint8_t i;
+  uint8_t r;
+  uint8_t r7;
+  uint8_t iff1;
+  uint8_t iff2;
+  uint8_t im;
+  uint8_t halted;
+  uint8_t ei_shadow;
+  uint8_t irq;
+  uint8_t irq_data;
+  uint8_t nmi;
+  uint64_t cycles;
+  uint64_t run_end;
+  uint8_t* mem;
+  uint8_t* dirty;
+  void* io_ctx;
+  Z80_InFn in;
+  Z80_OutFn out;
+  Z80_TrapFn rst_trap;
+  void* trap_ctx;
+  Z80_RunFn runner;
+  void* run_ctx;
+};
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/* Clears cpu, attaches mem and I/O callbacks (either may be NULL) and resets. */
+void z80_cpu_init(Z80_CPU* cpu, uint8_t* mem, Z80_InFn in, Z80_OutFn out,
+    void* io_ctx);
+
+/* Power-on/RESET state: PC, I, R, IFFs and IM cleared, AF and SP 0xFFFF. */
+void z80_cpu_reset(Z80_CPU* cpu);
+
+/*
+ * Accepts a pending interrupt or executes one instruction (a halted CPU
+ * executes NOPs) and returns the T-states taken.
+ */
+int z80_cpu_step(Z80_CPU* cpu);
+
+/*
+ * Steps until at least cycles T-states have elapsed, or the CPU halts
+ * with no interrupt it would accept pending. Returns the T-states run.
+ */
+uint64_t z80_cpu_run(Z80_CPU* cpu, uint64_t cycles);
+
+static inline int z80_cpu_stopped(const Z80_CPU* cpu) {
+  return cpu->halted && !cpu->nmi && !(cpu->irq && cpu->iff1);
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80emu_h */
@@ -0,0 +1,271 @@
+#include <string.h>
+
+#include "z80flow.h"
+
+#define WRAP_PAD 16
+
+enum {
+  cf_End = 0x1,
+  cf_Falls = 0x2,
+  cf_Target = 0x4
+};
+
+static const uint16_t s_vectors[] = {
+  0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38, 0x66
+};
+
+static int testBit(const uint8_t* bits, uint16_t addr) {
+  return (bits[addr >> 3] >> (addr & 7)) & 1;
+}
+
+static void setBit(uint8_t* bits, uint16_t addr) {
+  bits[addr >> 3] |= 1 << (addr & 7);
+}
+
+static int decodeAt(const uint8_t* ext, uint16_t pc, Z80_Line* line) {
+  z80_disassemble_range(ext + pc, Z80_IMAGE_SIZE + WRAP_PAD - pc, pc, line, 1, NULL);
+  return line->status == ds_Ok;
+}
+
+/*
+ * Classifies the control transfer done by opcode, returning cf_ bits and
+ * setting the target, edge kind and block flags where they apply.
+ */
+static int controlFlow(const Z80_OpCode* opcode, uint16_t* target,
+    uint8_t* kind, uint8_t* flags) {
+  const Z80_Arg* last = &opcode->args[opcode->argc > 0 ? opcode->argc - 1 : 0];
+  int conditional = opcode->argc == 2 && opcode->args[0].flags == am_Flag;
+  switch (opcode->operation) {
+    case op_JP:
+      if ((last->flags & am_Register) != 0) {
+        *flags |= bf_Indirect;
+        return cf_End;
+      }
+      /* fall through */
+    case op_JR:
+      *target = last->v;
+      *kind = conditional ? fe_Branch : fe_Jump;
+      return cf_End | cf_Target | (conditional ? cf_Falls : 0);
+    case op_DJNZ:
+      *target = last->v;
+      *kind = fe_Branch;
+      return cf_End | cf_Target | cf_Falls;
+    case op_CALL:
+      *target = last->v;
+      *kind = fe_Call;
+      return cf_End | cf_Target | cf_Falls;
+    case op_RST:
+      *target = last->v;
+      *kind = fe_Rst;
+      return cf_End | cf_Target | cf_Falls;
+    case op_RET:
+      *flags |= bf_Return;
+      return cf_End | (opcode->argc != 0 ? cf_Falls : 0);
+    case op_RETI:
+    case op_RETN:
+      *flags |= bf_Return;
+      return cf_End;
+    case op_HALT:
+      *flags |= bf_Halt;
+      return cf_End | cf_Falls;
+    default:
+      return 0;
+  }
+}
+
+/* value loaded into A by opcode, or -1 if it is not an LD A,n */
+static int loadsA(const Z80_OpCode* opcode) {
+  if (opcode->operation != op_LD || opcode->argc != 2) return -1;
+  if (opcode->args[0].flags != am_Register || opcode->args[0].v != reg_A) return -1;
+  if (opcode->args[1].flags != am_Immediate) return -1;
+  return opcode->args[1].v;
+}
+
+/*
+ * Drops cf_Falls from a CALL or RST whose target, or whose RST vector and
+ * A value a, the options say never returns.
+ */
+static int returns(const Z80_FlowOptions* options, int cf, uint8_t kind,
+    uint16_t target, int a) {
+  if ((cf & cf_Target) == 0 || (kind != fe_Call && kind != fe_Rst)) return cf;
+  for (size_t i = 0; i < options->exit_count; i++) {
+    if (options->exits[i] == target) return cf & ~cf_Falls;
+  }
+  if (kind == fe_Rst) {
+    for (size_t i = 0; i < options->exit_svc_count; i++) {
+      const Z80_FlowSvc* svc = &options->exit_svc[i];
+      if (svc->vector == target && svc->a == a) return cf & ~cf_Falls;
+    }
+  }
+  return cf;
+}
+
+static void explore(const uint8_t* ext, uint8_t* insn, Z80_Flow* flow,
+    const Z80_FlowOptions* options, uint16_t* stack, size_t sp) {
+  Z80_Line line;
+  while (sp > 0) {
+    uint16_t pc = stack[--sp];
+    int a = -1;
+    while (!testBit(insn, pc) && decodeAt(ext, pc, &line)) {
+      uint16_t target = 0;
+      uint16_t next = (uint16_t) (pc + line.opcode.len);
+      uint8_t kind, flags = 0;
+      int cf = controlFlow(&line.opcode, &target, &kind, &flags);
+      cf = returns(options, cf, kind, target, a);
+      a = loadsA(&line.opcode);
+      setBit(insn, pc);
+      for (int i = 0; i < line.opcode.len; i++) {
+        setBit(flow->code, (uint16_t) (pc + i));
+      }
+      if ((cf & cf_Target) != 0 && !testBit(flow->leader, target)) {
+        setBit(flow->leader, target);
+        stack[sp++] = target;
+      }
+      if ((cf & cf_End) != 0) {
+        if ((cf & cf_Falls) != 0 && !testBit(flow->leader, next)) {
+          setBit(flow->leader, next);
+          stack[sp++] = next;
+        }
+        break;
+      }
+      pc = next;
+      if (testBit(insn, pc)) {
+        /* joined code explored earlier; a second path enters here */
+        setBit(flow->leader, pc);
+      }
+    }
+  }
+}
+
+static long findBlock(const Z80_Flow* flow, uint16_t addr) {
+  size_t lo = 0, hi = flow->block_count;
+  while (lo < hi) {
+    size_t mid = (lo + hi) / 2;
+    if (flow->blocks[mid].start <= addr) lo = mid + 1;
+    else hi = mid;
+  }
+  return (long) lo - 1;
+}
+
+static void addEdge(Z80_Flow* flow, uint32_t from, uint16_t to, uint8_t kind) {
+  Z80_Edge* edge = &flow->edges[flow->edge_count++];
+  edge->from = from;
+  edge->to = to;
+  edge->kind = kind;
+  flow->blocks[from].edge_count++;
+}
+
+static void buildBlock(const uint8_t* ext, Z80_Flow* flow,
+    const Z80_FlowOptions* options, uint32_t index) {
+  Z80_Block* block = &flow->blocks[index];
+  uint32_t pc = block->start;
+  Z80_Line line;
+  int a = -1;
+  block->first_edge = (uint32_t) flow->edge_count;
+  for (;;) {
+    uint16_t target = 0;
+    uint8_t kind, flags = 0;
+    int cf;
+    if (!decodeAt(ext, (uint16_t) pc, &line)) {
+      block->flags |= bf_Invalid;
+      break;
+    }
+    cf = controlFlow(&line.opcode, &target, &kind, &flags);
+    cf = returns(options, cf, kind, target, a);
+    a = loadsA(&line.opcode);
+    block->flags |= flags;
+    block->insns++;
+    pc += line.opcode.len;
+    if ((cf & cf_Target) != 0) addEdge(flow, index, target, kind);
+    if ((cf & cf_End) != 0) {
+      if ((cf & cf_Falls) != 0) addEdge(flow, index, (uint16_t) pc, fe_Fallthrough);
+      break;
+    }
+    if (testBit(flow->leader, (uint16_t) pc)) {
+      addEdge(flow, index, (uint16_t) pc, fe_Fallthrough);
+      break;
+    }
+  }
+  block->end = pc;
+}
+
+int z80_flow_analyze(Z80_Flow* flow, const uint8_t* image,
+    const Z80_FlowOptions* options) {
+  const uint16_t* entries = options->entries;
+  size_t entry_count = options->entry_count;
+  size_t vector_count = options->vectors
+      ? sizeof(s_vectors) / sizeof(s_vectors[0]) : 0;
+  uint8_t* ext = (uint8_t*) malloc(Z80_IMAGE_SIZE + WRAP_PAD);
+  uint8_t* insn = (uint8_t*) calloc(Z80_IMAGE_SIZE / 8, 1);
+  uint16_t* stack = (uint16_t*) malloc(
+      (Z80_IMAGE_SIZE + vector_count + entry_count) * sizeof(uint16_t));
+  size_t sp = 0;
+  size_t leaders = 0;
+  int rc = -1;
+
+  memset(flow, 0, sizeof(*flow));
+  if (ext == NULL || insn == NULL || stack == NULL) goto done;
+  memcpy(ext, image, Z80_IMAGE_SIZE);
+  memcpy(ext + Z80_IMAGE_SIZE, image, WRAP_PAD);
+
+  for (size_t i = 0; i < vector_count; i++) {
+    setBit(flow->leader, s_vectors[i]);
+    stack[sp++] = s_vectors[i];
+  }
+  for (size_t i = 0; i < entry_count; i++) {
+    setBit(flow->leader, entries[i]);
+    stack[sp++] = entries[i];
+  }
+  explore(ext, insn, flow, options, stack, sp);
+
+  for (size_t i = 0; i < sizeof(flow->leader); i++) {
+    leaders += __builtin_popcount(flow->leader[i]);
+  }
+  flow->blocks = (Z80_Block*) calloc(leaders != 0 ? leaders : 1, sizeof(Z80_Block));
+  flow->edges = (Z80_Edge*) malloc((2 * leaders + 1) * sizeof(Z80_Edge));
+  if (flow->blocks == NULL || flow->edges == NULL) {
+    z80_flow_free(flow);
+    goto done;
+  }
+  for (uint32_t addr = 0; addr < Z80_IMAGE_SIZE; addr++) {
+    if (testBit(flow->leader, (uint16_t) addr)) {
+      flow->blocks[flow->block_count++].start = (uint16_t) addr;
+    }
+  }
+  for (uint32_t i = 0; i < flow->block_count; i++) {
+    buildBlock(ext, flow, options, i);
+  }
+  for (size_t i = 0; i < flow->edge_count; i++) {
+    flow->edges[i].to = (uint32_t) findBlock(flow, (uint16_t) flow->edges[i].to);
+  }
+  for (size_t i = 0; i < vector_count; i++) {
+    flow->blocks[findBlock(flow, s_vectors[i])].flags |= bf_Entry;
+  }
+  for (size_t i = 0; i < entry_count; i++) {
+    flow->blocks[findBlock(flow, entries[i])].flags |= bf_Entry;
+  }
+  rc = 0;
+
+done:
+  free(stack);
+  free(insn);
+  free(ext);
+  return rc;
+}
+
+void z80_flow_free(Z80_Flow* flow) {
+  free(flow->blocks);
+  free(flow->edges);
+  flow->blocks = NULL;
+  flow->edges = NULL;
+  flow->block_count = 0;
+  flow->edge_count = 0;
+}
+
+long z80_flow_block_at(const Z80_Flow* flow, uint16_t addr) {
+  long i;
+  if (!z80_flow_is_code(flow, addr)) return -1;
+  i = findBlock(flow, addr);
+  if (i < 0 || addr >= flow->blocks[i].end) return -1;
+  return i;
+}
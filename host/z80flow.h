@@ -0,0 +1,99 @@
+#ifndef z80flow_h
+#define z80flow_h
+
+#include "z80dasm.h"
+
+#define Z80_IMAGE_SIZE 65536
+
+typedef enum {
+  fe_Fallthrough,
+  fe_Jump,
+  fe_Branch,
+  fe_Call,
+  fe_Rst
+} Z80_EdgeKind;
+
+typedef enum {
+  bf_Entry = 0x1,
+  bf_Return = 0x2,
+  bf_Indirect = 0x4,
+  bf_Halt = 0x8,
+  bf_Invalid = 0x10
+} Z80_BlockFlags;
+
+typedef struct {
+  uint32_t from;
+  uint32_t to;
+  uint8_t kind;
+} Z80_Edge;
+
+/*
+ * A basic block covers the instructions from start up to end (exclusive,
+ * so a block ending at the top of memory has end 0x10000). Its
+ * successors are edges[first_edge] .. edges[first_edge + edge_count - 1].
+ */
+typedef struct {
+  uint16_t start;
+  uint32_t end;
+  uint32_t insns;
+  uint32_t first_edge;
+  uint32_t edge_count;
+  uint8_t flags;
+} Z80_Block;
+
+typedef struct {
+  Z80_Block* blocks;
+  size_t block_count;
+  Z80_Edge* edges;
+  size_t edge_count;
+  uint8_t code[Z80_IMAGE_SIZE / 8];
+  uint8_t leader[Z80_IMAGE_SIZE / 8];
+} Z80_Flow;
+
+/* A supervisor call that does not return: RST vector with A == a. */
+typedef struct {
+  uint8_t vector;
+  uint8_t a;
+} Z80_FlowSvc;
+
+typedef struct {
+  const uint16_t* entries;
+  size_t entry_count;
+  /* also seed with the reset, RST and NMI vectors */
+  int vectors;
+  /* CALL and RST targets that never return */
+  const uint16_t* exits;
+  size_t exit_count;
+  /* supervisor calls that never return, matched when the RST directly
+   * follows an LD A,n */
+  const Z80_FlowSvc* exit_svc;
+  size_t exit_svc_count;
+} Z80_FlowOptions;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+ * Builds the control-flow graph of the 64 KiB image reachable from the
+ * entry points in options by following JP, JR, DJNZ, CALL and RST
+ * targets. Computed jumps (JP (HL), RET) end their paths. Returns 0, or
+ * -1 if memory is exhausted.
+ */
+int z80_flow_analyze(Z80_Flow* flow, const uint8_t* image,
+    const Z80_FlowOptions* options);
+
+void z80_flow_free(Z80_Flow* flow);
+
+/* Index of the block containing addr, or -1 if addr is not code. */
+long z80_flow_block_at(const Z80_Flow* flow, uint16_t addr);
+
+static inline int z80_flow_is_code(const Z80_Flow* flow, uint16_t addr) {
+  return (flow->code[addr >> 3] >> (addr & 7)) & 1;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80flow_h */
@@ -0,0 +1,72 @@
+#include <string.h>
+
+#include "z80icache.h"
+
+#define PAGE_SIZE 256
+#define MAX_INSN 4
+
+static void invalidatePage(Z80_ICache* cache, unsigned page) {
+  uint16_t before = (uint16_t) (page * PAGE_SIZE - (MAX_INSN - 1));
+  cache->dirty[page >> 3] &= ~(1 << (page & 7));
+  memset(cache->valid + page * (PAGE_SIZE / 8), 0, PAGE_SIZE / 8);
+  /* instructions starting just before the page may extend into it */
+  for (int i = 0; i < MAX_INSN - 1; i++, before++) {
+    cache->valid[before >> 3] &= ~(1 << (before & 7));
+  }
+  cache->invalidations++;
+}
+
+static int isDirty(const Z80_ICache* cache, unsigned page) {
+  return (cache->dirty[page >> 3] >> (page & 7)) & 1;
+}
+
+void z80_icache_init(Z80_ICache* cache, const uint8_t* mem) {
+  memset(cache, 0, sizeof(*cache));
+  cache->mem = mem;
+}
+
+void z80_icache_free(Z80_ICache* cache) {
+  for (int i = 0; i < Z80_PAGE_COUNT; i++) {
+    free(cache->pages[i]);
+  }
+  memset(cache, 0, sizeof(*cache));
+}
+
+void z80_icache_flush(Z80_ICache* cache) {
+  memset(cache->valid, 0, sizeof(cache->valid));
+  memset(cache->dirty, 0, sizeof(cache->dirty));
+}
+
+static void decode(const uint8_t* mem, uint16_t addr, Z80_OpCode* opcode) {
+  uint8_t bytes[MAX_INSN];
+  Z80_Line line;
+  for (int i = 0; i < MAX_INSN; i++) {
+    bytes[i] = mem[(uint16_t) (addr + i)];
+  }
+  z80_disassemble_range(bytes, MAX_INSN, addr, &line, 1, NULL);
+  *opcode = line.opcode;
+  if (line.status != ds_Ok) opcode->len = 0;
+}
+
+const Z80_OpCode* z80_icache_lookup(Z80_ICache* cache, uint16_t addr) {
+  unsigned page = addr >> 8;
+  unsigned last = ((uint16_t) (addr + MAX_INSN - 1)) >> 8;
+  Z80_OpCode* entries;
+  if (isDirty(cache, page)) invalidatePage(cache, page);
+  if (last != page && isDirty(cache, last)) invalidatePage(cache, last);
+
+  entries = cache->pages[page];
+  if ((cache->valid[addr >> 3] >> (addr & 7)) & 1) {
+    cache->hits++;
+    return &entries[addr & (PAGE_SIZE - 1)];
+  }
+  if (entries == NULL) {
+    entries = (Z80_OpCode*) malloc(PAGE_SIZE * sizeof(Z80_OpCode));
+    if (entries == NULL) return NULL;
+    cache->pages[page] = entries;
+  }
+  cache->misses++;
+  decode(cache->mem, addr, &entries[addr & (PAGE_SIZE - 1)]);
+  cache->valid[addr >> 3] |= 1 << (addr & 7);
+  return &entries[addr & (PAGE_SIZE - 1)];
+}
@@ -0,0 +1,52 @@
+#ifndef z80icache_h
+#define z80icache_h
+
+#include "z80dasm.h"
+#include "z80emu.h"
+
+/*
+ * Decoded instructions keyed by address. Entries live in 256-entry pages
+ * allocated on first use, with a valid bit per address. Attach dirty to
+ * the CPU (cpu->dirty = cache->dirty) so its writes mark pages; a lookup
+ * drops the entries of a marked page, and the few before it whose bytes
+ * may run into it, before using them.
+ */
+typedef struct {
+  const uint8_t* mem;
+  Z80_OpCode* pages[Z80_PAGE_COUNT];
+  uint8_t valid[Z80_MEM_SIZE / 8];
+  uint8_t dirty[Z80_PAGE_COUNT / 8];
+  uint64_t hits;
+  uint64_t misses;
+  uint64_t invalidations;
+} Z80_ICache;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void z80_icache_init(Z80_ICache* cache, const uint8_t* mem);
+
+void z80_icache_free(Z80_ICache* cache);
+
+/*
+ * Returns the instruction at addr, decoding it on a miss, with JR/DJNZ
+ * targets resolved as by z80_disassemble_range(). Its len is 0 if the
+ * bytes at addr are not a valid instruction. Returns NULL only if memory
+ * is exhausted. The entry stays valid until the next lookup.
+ */
+const Z80_OpCode* z80_icache_lookup(Z80_ICache* cache, uint16_t addr);
+
+/* Marks addr's page changed, for writes made other than by the CPU. */
+static inline void z80_icache_touch(Z80_ICache* cache, uint16_t addr) {
+  cache->dirty[addr >> 11] |= 1 << ((addr >> 8) & 7);
+}
+
+/* Drops every entry, e.g. after loading a new image. */
+void z80_icache_flush(Z80_ICache* cache);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80icache_h */
@@ -0,0 +1,109 @@
+#include <string.h>
+
+#include "z80list.h"
+
+#define LINE_BATCH 256
+#define LINE_MAX 128
+#define BYTES_WIDTH 12
+#define LABEL_MAX 64
+
+static const char s_hexUpper[] = "0123456789ABCDEF";
+static const char s_hexLower[] = "0123456789abcdef";
+
+void z80_buf_init(Z80_Buf* buf) {
+  buf->data = NULL;
+  buf->len = 0;
+  buf->cap = 0;
+}
+
+char* z80_buf_reserve(Z80_Buf* buf, size_t n) {
+  if (buf->cap - buf->len < n) {
+    size_t cap = buf->cap != 0 ? buf->cap : 4096;
+    char* data;
+    while (cap - buf->len < n) cap *= 2;
+    data = (char*) realloc(buf->data, cap);
+    if (data == NULL) return NULL;
+    buf->data = data;
+    buf->cap = cap;
+  }
+  return buf->data + buf->len;
+}
+
+int z80_buf_append(Z80_Buf* buf, const char* s, size_t n) {
+  char* p = z80_buf_reserve(buf, n);
+  if (p == NULL) return -1;
+  memcpy(p, s, n);
+  buf->len += n;
+  return 0;
+}
+
+void z80_buf_free(Z80_Buf* buf) {
+  free(buf->data);
+  z80_buf_init(buf);
+}
+
+static size_t listLine(char* p, const Z80_Line* line, const uint8_t* mem,
+    size_t len, int syntax, Z80_SymbolLookup lookup, const void* ctx) {
+  const char* digits = (syntax & fmt_Lower) != 0 ? s_hexLower : s_hexUpper;
+  const char* label = lookup != NULL ? lookup(ctx, line->addr) : NULL;
+  char* first = p;
+  char* start;
+  char* pad;
+  if (label != NULL) {
+    size_t n = strlen(label);
+    if (n > LABEL_MAX) n = LABEL_MAX;
+    memcpy(p, label, n);
+    p += n;
+    *p++ = ':';
+    *p++ = '\n';
+  }
+  start = p;
+  for (int shift = 12; shift >= 0; shift -= 4) {
+    *p++ = digits[(line->addr >> shift) & 0xf];
+  }
+  *p++ = ' ';
+  *p++ = ' ';
+  pad = p + BYTES_WIDTH;
+  for (size_t i = 0; i < len; i++) {
+    *p++ = digits[mem[i] >> 4];
+    *p++ = digits[mem[i] & 0xf];
+    *p++ = ' ';
+  }
+  while (p < pad) *p++ = ' ';
+  *p++ = ' ';
+  if (line->status == ds_Ok) {
+    p += z80_format_sym(&line->opcode, syntax, lookup, ctx, p,
+        LINE_MAX - (p - start) - 1);
+  }
+  else {
+    p += z80_format_data(mem, len, syntax, p, LINE_MAX - (p - start) - 1);
+  }
+  *p++ = '\n';
+  return (size_t) (p - first);
+}
+
+int z80_list_range(Z80_Buf* out, const uint8_t* mem, size_t len,
+    uint16_t base_addr, int syntax) {
+  return z80_list_range_sym(out, mem, len, base_addr, syntax, NULL, NULL);
+}
+
+int z80_list_range_sym(Z80_Buf* out, const uint8_t* mem, size_t len,
+    uint16_t base_addr, int syntax, Z80_SymbolLookup lookup, const void* ctx) {
+  Z80_Line lines[LINE_BATCH];
+  size_t offset = 0;
+  while (offset < len) {
+    size_t consumed;
+    size_t n = z80_disassemble_range(mem + offset, len - offset,
+        (uint16_t) (base_addr + offset), lines, LINE_BATCH, &consumed);
+    char* p = z80_buf_reserve(out, n * (LINE_MAX + LABEL_MAX + 2));
+    if (p == NULL) return -1;
+    for (size_t i = 0; i < n; i++) {
+      size_t insn_len = lines[i].status == ds_Invalid ? 1 : lines[i].opcode.len;
+      if (insn_len > (LINE_MAX - 32) / 3) insn_len = (LINE_MAX - 32) / 3;
+      p += listLine(p, &lines[i], mem + offset, insn_len, syntax, lookup, ctx);
+      offset += lines[i].status == ds_Invalid ? 1 : lines[i].opcode.len;
+    }
+    out->len = (size_t) (p - out->data);
+  }
+  return 0;
+}
@@ -0,0 +1,49 @@
+#ifndef z80list_h
+#define z80list_h
+
+#include "z80dasm.h"
+
+typedef struct {
+  char* data;
+  size_t len;
+  size_t cap;
+} Z80_Buf;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void z80_buf_init(Z80_Buf* buf);
+
+/*
+ * Ensures n bytes can be written at buf->data + buf->len and returns a
+ * pointer to them, or NULL if memory is exhausted. The caller advances
+ * buf->len by the number of bytes actually written.
+ */
+char* z80_buf_reserve(Z80_Buf* buf, size_t n);
+
+int z80_buf_append(Z80_Buf* buf, const char* s, size_t n);
+
+void z80_buf_free(Z80_Buf* buf);
+
+/*
+ * Appends a listing of the len bytes at mem, located at base_addr, to out.
+ * Each line holds the address, the instruction bytes and the instruction
+ * formatted with the given Z80_Syntax flags. Returns 0, or -1 if memory
+ * is exhausted.
+ */
+int z80_list_range(Z80_Buf* out, const uint8_t* mem, size_t len,
+    uint16_t base_addr, int syntax);
+
+/*
+ * As z80_list_range(), naming addresses through lookup: operands are
+ * printed symbolically and a "name:" line precedes each named address.
+ */
+int z80_list_range_sym(Z80_Buf* out, const uint8_t* mem, size_t len,
+    uint16_t base_addr, int syntax, Z80_SymbolLookup lookup, const void* ctx);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80list_h */
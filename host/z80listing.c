@@ -0,0 +1,113 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "z80listing.h"
+
+#define PAGE_SIZE 256
+/* the most bytes decoding one instruction reads */
+#define MAX_INSN 4
+
+static int isStart(const Z80_Listing* listing, size_t offset) {
+  return (listing->starts[offset >> 3] >> (offset & 7)) & 1;
+}
+
+/* decodes the line at offset, returning its length */
+static size_t decodeAt(Z80_Listing* listing, size_t offset) {
+  Z80_Line* line = &listing->lines[offset];
+  z80_disassemble_range(listing->mem + offset, listing->len - offset,
+      (uint16_t) (listing->base_addr + offset), line, 1, NULL);
+  listing->decoded++;
+  return line->opcode.len;
+}
+
+int z80_listing_init(Z80_Listing* listing, const uint8_t* mem, size_t len,
+    uint16_t base_addr, Z80_ListingNotify notify, void* ctx) {
+  memset(listing, 0, sizeof(*listing));
+  listing->mem = mem;
+  listing->len = len;
+  listing->base_addr = base_addr;
+  listing->notify = notify;
+  listing->notify_ctx = ctx;
+  listing->lines = (Z80_Line*) malloc((len != 0 ? len : 1) * sizeof(Z80_Line));
+  listing->starts = (uint8_t*) calloc(len / 8 + 1, 1);
+  if (listing->lines == NULL || listing->starts == NULL) {
+    z80_listing_free(listing);
+    return -1;
+  }
+  for (size_t offset = 0; offset < len; listing->count++) {
+    listing->starts[offset >> 3] |= 1 << (offset & 7);
+    offset += decodeAt(listing, offset);
+  }
+  return 0;
+}
+
+void z80_listing_free(Z80_Listing* listing) {
+  free(listing->lines);
+  free(listing->starts);
+  memset(listing, 0, sizeof(*listing));
+}
+
+void z80_listing_patch(Z80_Listing* listing, uint16_t addr, size_t n) {
+  size_t first = (uint16_t) (addr - listing->base_addr);
+  size_t last, offset;
+  Z80_ListingChange change;
+
+  if (n == 0 || first >= listing->len) return;
+  last = n < listing->len - first ? first + n : listing->len;
+  /* the lines that may have read a changed byte start at most
+   * MAX_INSN - 1 bytes before it, and lines tile the listing, so one
+   * starts no further back than that */
+  offset = first >= MAX_INSN - 1 ? first - (MAX_INSN - 1) : 0;
+  while (!isStart(listing, offset)) offset++;
+
+  change.start = (uint16_t) (listing->base_addr + offset);
+  change.removed = 0;
+  change.added = 0;
+  /* the old boundaries ahead of offset are intact until decoded over */
+  while (offset < listing->len && (offset < last || !isStart(listing, offset))) {
+    size_t len;
+    if (isStart(listing, offset)) change.removed++;
+    else listing->starts[offset >> 3] |= 1 << (offset & 7);
+    len = decodeAt(listing, offset);
+    for (size_t i = offset + 1; i < offset + len; i++) {
+      if (isStart(listing, i)) {
+        listing->starts[i >> 3] &= ~(1 << (i & 7));
+        change.removed++;
+      }
+    }
+    offset += len;
+    change.added++;
+  }
+  change.end = listing->base_addr + (uint32_t) offset;
+  listing->count = listing->count - change.removed + change.added;
+  if (listing->notify != NULL) listing->notify(listing->notify_ctx, &change);
+}
+
+void z80_listing_sync(Z80_Listing* listing, uint8_t* dirty) {
+  uint32_t end = listing->base_addr + (uint32_t) listing->len;
+  uint32_t run = 0;
+  size_t run_len = 0;
+  for (uint32_t page = listing->base_addr / PAGE_SIZE;
+      page * PAGE_SIZE < end; page++) {
+    uint32_t start = page * PAGE_SIZE;
+    if (((dirty[page >> 3] >> (page & 7)) & 1) == 0) continue;
+    dirty[page >> 3] &= ~(1 << (page & 7));
+    if (start < listing->base_addr) start = listing->base_addr;
+    /* runs of marked pages make one patch */
+    if (run_len != 0 && run + run_len == start) {
+      run_len = (page + 1) * PAGE_SIZE - run;
+      continue;
+    }
+    if (run_len != 0) z80_listing_patch(listing, (uint16_t) run, run_len);
+    run = start;
+    run_len = (page + 1) * PAGE_SIZE - start;
+  }
+  if (run_len != 0) z80_listing_patch(listing, (uint16_t) run, run_len);
+}
+
+const Z80_Line* z80_listing_at(const Z80_Listing* listing, uint16_t addr) {
+  size_t offset = (uint16_t) (addr - listing->base_addr);
+  if (offset >= listing->len) return NULL;
+  while (!isStart(listing, offset)) offset--;
+  return &listing->lines[offset];
+}
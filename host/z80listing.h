@@ -0,0 +1,84 @@
+#ifndef z80listing_h
+#define z80listing_h
+
+#include "z80dasm.h"
+
+/*
+ * The lines re-decoded by one patch: those from start up to end
+ * (exclusive, as for Z80_Block), which replaced removed lines there.
+ * Lines outside the range are unchanged.
+ */
+typedef struct {
+  uint16_t start;
+  uint32_t end;
+  size_t removed;
+  size_t added;
+} Z80_ListingChange;
+
+typedef void (*Z80_ListingNotify)(void* ctx, const Z80_ListingChange* change);
+
+/*
+ * The linear-sweep listing of the len bytes at mem, located at base_addr,
+ * kept up to date as they change. lines is indexed by offset from
+ * base_addr and holds a line at each offset marked in starts, the
+ * instruction-boundary index; count is the number of lines. decoded
+ * counts the lines decoded, initially and by patches since.
+ */
+typedef struct {
+  const uint8_t* mem;
+  size_t len;
+  uint16_t base_addr;
+  Z80_Line* lines;
+  uint8_t* starts;
+  size_t count;
+  uint64_t decoded;
+  Z80_ListingNotify notify;
+  void* notify_ctx;
+} Z80_Listing;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+ * Sweeps the len bytes at mem, located at base_addr, with base_addr + len
+ * at most 0x10000. mem must stay valid for the life of the listing.
+ * notify, if not NULL, is called with ctx after each patch that
+ * re-decodes anything. Returns 0, or -1 if memory is exhausted.
+ */
+int z80_listing_init(Z80_Listing* listing, const uint8_t* mem, size_t len,
+    uint16_t base_addr, Z80_ListingNotify notify, void* ctx);
+
+void z80_listing_free(Z80_Listing* listing);
+
+/*
+ * Brings the listing up to date after the n bytes at addr changed in
+ * mem. Only the lines that read a changed byte are decoded again, and
+ * then those after them until a line starts where one started before, so
+ * a patch costs time in proportion to the lines it disturbs.
+ */
+void z80_listing_patch(Z80_Listing* listing, uint16_t addr, size_t n);
+
+/*
+ * Patches each 256-byte page marked in dirty, a Z80_PAGE_COUNT-bit map
+ * as kept by a CPU (see z80emu.h), that the listing covers, and clears
+ * the marks.
+ */
+void z80_listing_sync(Z80_Listing* listing, uint8_t* dirty);
+
+/* The line covering addr, or NULL if addr is outside the listing. */
+const Z80_Line* z80_listing_at(const Z80_Listing* listing, uint16_t addr);
+
+/* The line following line, or NULL at the end of the listing. */
+static inline const Z80_Line* z80_listing_next(const Z80_Listing* listing,
+    const Z80_Line* line) {
+  size_t offset = (uint16_t) (line->addr - listing->base_addr) +
+      (size_t) line->opcode.len;
+  return offset < listing->len ? &listing->lines[offset] : NULL;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80listing_h */
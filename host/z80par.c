@@ -0,0 +1,105 @@
+#include <string.h>
+
+#include "z80par.h"
+#include "z80pool.h"
+
+#define LINE_BATCH 256
+
+typedef struct {
+  const Z80_Region* regions;
+  Z80_Buf* bufs;
+  int syntax;
+  Z80_SymbolLookup lookup;
+  const void* lookup_ctx;
+  /* one per job, combined after the pool joins */
+  int* failed;
+} Z80_ParJobs;
+
+size_t z80_par_split(const uint8_t* mem, size_t len, uint16_t base_addr,
+    size_t chunk, Z80_Region* regions, size_t max_regions) {
+  Z80_Line lines[LINE_BATCH];
+  size_t start = 0;
+  size_t offset = 0;
+  size_t n = 0;
+  while (offset < len) {
+    size_t consumed;
+    size_t count = z80_disassemble_range(mem + offset, len - offset,
+        (uint16_t) (base_addr + offset), lines, LINE_BATCH, &consumed);
+    for (size_t i = 0; i < count; i++) {
+      offset += lines[i].status == ds_Invalid ? 1 : lines[i].opcode.len;
+      if (offset - start >= chunk || offset == len) {
+        if (n == max_regions) return 0;
+        regions[n].mem = mem + start;
+        regions[n].len = offset - start;
+        regions[n].base_addr = (uint16_t) (base_addr + start);
+        n++;
+        start = offset;
+      }
+    }
+  }
+  return n;
+}
+
+static void listRegion(void* ctx, size_t job, int worker) {
+  Z80_ParJobs* jobs = (Z80_ParJobs*) ctx;
+  const Z80_Region* region = &jobs->regions[job];
+  (void) worker;
+  if (z80_list_range_sym(&jobs->bufs[job], region->mem, region->len,
+      region->base_addr, jobs->syntax, jobs->lookup, jobs->lookup_ctx) != 0) {
+    jobs->failed[job] = 1;
+  }
+}
+
+int z80_par_list(const Z80_Region* regions, size_t n, int threads, int syntax,
+    Z80_Buf* out) {
+  return z80_par_list_sym(regions, n, threads, syntax, NULL, NULL, out);
+}
+
+int z80_par_list_sym(const Z80_Region* regions, size_t n, int threads,
+    int syntax, Z80_SymbolLookup lookup, const void* ctx, Z80_Buf* out) {
+  Z80_ParJobs jobs;
+  size_t total = 0;
+  int rc = 0;
+  char* p;
+
+  jobs.regions = regions;
+  jobs.bufs = (Z80_Buf*) calloc(n != 0 ? n : 1, sizeof(Z80_Buf));
+  jobs.syntax = syntax;
+  jobs.lookup = lookup;
+  jobs.lookup_ctx = ctx;
+  jobs.failed = (int*) calloc(n != 0 ? n : 1, sizeof(int));
+  if (jobs.bufs == NULL || jobs.failed == NULL) {
+    free(jobs.bufs);
+    free(jobs.failed);
+    return -1;
+  }
+
+  if (z80_pool_run(n, threads, listRegion, &jobs) != 0) {
+    rc = -1;
+    goto done;
+  }
+  for (size_t i = 0; i < n; i++) {
+    if (jobs.failed[i]) {
+      rc = -1;
+      goto done;
+    }
+  }
+
+  for (size_t i = 0; i < n; i++) total += jobs.bufs[i].len;
+  p = z80_buf_reserve(out, total);
+  if (p == NULL) {
+    rc = -1;
+    goto done;
+  }
+  for (size_t i = 0; i < n; i++) {
+    memcpy(p, jobs.bufs[i].data, jobs.bufs[i].len);
+    p += jobs.bufs[i].len;
+  }
+  out->len += total;
+
+done:
+  for (size_t i = 0; i < n; i++) z80_buf_free(&jobs.bufs[i]);
+  free(jobs.bufs);
+  free(jobs.failed);
+  return rc;
+}
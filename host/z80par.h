@@ -0,0 +1,47 @@
+#ifndef z80par_h
+#define z80par_h
+
+#include "z80list.h"
+
+typedef struct {
+  const uint8_t* mem;
+  size_t len;
+  uint16_t base_addr;
+} Z80_Region;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+ * Splits the len bytes at mem into regions of roughly chunk bytes that
+ * start on the instruction boundaries a linear sweep from mem would find,
+ * so that listing the regions independently gives the same result as
+ * listing the whole. Returns the number of regions written, or 0 if they
+ * would not fit in max_regions.
+ */
+size_t z80_par_split(const uint8_t* mem, size_t len, uint16_t base_addr,
+    size_t chunk, Z80_Region* regions, size_t max_regions);
+
+/*
+ * Lists each region on a pool of threads workers, each into a buffer of
+ * its own, then appends the listings to out in region order. Pass regions
+ * in address order to get an address-ordered listing. Returns 0, or -1 if
+ * memory is exhausted.
+ */
+int z80_par_list(const Z80_Region* regions, size_t n, int threads, int syntax,
+    Z80_Buf* out);
+
+/*
+ * As z80_par_list(), listing each region with z80_list_range_sym().
+ * lookup is called from every worker at once, so it must be safe to call
+ * concurrently; z80_sym_lookup() is.
+ */
+int z80_par_list_sym(const Z80_Region* regions, size_t n, int threads,
+    int syntax, Z80_SymbolLookup lookup, const void* ctx, Z80_Buf* out);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80par_h */
@@ -0,0 +1,131 @@
+#include <pthread.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+#include "z80pool.h"
+
+typedef struct {
+  pthread_mutex_t lock;
+  size_t head;
+  size_t tail;
+} Z80_Deque;
+
+typedef struct {
+  Z80_Deque* deques;
+  int nthreads;
+  Z80_PoolJob fn;
+  void* ctx;
+} Z80_Pool;
+
+typedef struct {
+  Z80_Pool* pool;
+  int id;
+} Z80_Worker;
+
+int z80_pool_default_threads(void) {
+  long n = sysconf(_SC_NPROCESSORS_ONLN);
+  return n > 0 ? (int) n : 1;
+}
+
+static int take(Z80_Deque* deque, size_t* job) {
+  int found = 0;
+  pthread_mutex_lock(&deque->lock);
+  if (deque->head < deque->tail) {
+    *job = deque->head++;
+    found = 1;
+  }
+  pthread_mutex_unlock(&deque->lock);
+  return found;
+}
+
+static int steal(Z80_Pool* pool, int self, size_t* job) {
+  Z80_Deque* own = &pool->deques[self];
+  for (int i = 1; i < pool->nthreads; i++) {
+    Z80_Deque* victim = &pool->deques[(self + i) % pool->nthreads];
+    size_t lo = 0, hi = 0;
+    pthread_mutex_lock(&victim->lock);
+    if (victim->head < victim->tail) {
+      size_t n = (victim->tail - victim->head + 1) / 2;
+      hi = victim->tail;
+      lo = hi - n;
+      victim->tail = lo;
+    }
+    pthread_mutex_unlock(&victim->lock);
+    if (lo < hi) {
+      pthread_mutex_lock(&own->lock);
+      own->head = lo + 1;
+      own->tail = hi;
+      pthread_mutex_unlock(&own->lock);
+      *job = lo;
+      return 1;
+    }
+  }
+  return 0;
+}
+
+static void* workerMain(void* arg) {
+  Z80_Worker* worker = (Z80_Worker*) arg;
+  Z80_Pool* pool = worker->pool;
+  size_t job;
+  for (;;) {
+    if (!take(&pool->deques[worker->id], &job)
+        && !steal(pool, worker->id, &job)) {
+      break;
+    }
+    pool->fn(pool->ctx, job, worker->id);
+  }
+  return NULL;
+}
+
+int z80_pool_run(size_t njobs, int nthreads, Z80_PoolJob fn, void* ctx) {
+  Z80_Pool pool;
+  Z80_Worker* workers;
+  pthread_t* threads;
+  int started = 0;
+  int rc = 0;
+
+  if (nthreads < 1) nthreads = 1;
+  if ((size_t) nthreads > njobs) nthreads = njobs > 0 ? (int) njobs : 1;
+  if (nthreads == 1) {
+    for (size_t job = 0; job < njobs; job++) fn(ctx, job, 0);
+    return 0;
+  }
+
+  pool.deques = (Z80_Deque*) calloc(nthreads, sizeof(Z80_Deque));
+  workers = (Z80_Worker*) calloc(nthreads, sizeof(Z80_Worker));
+  threads = (pthread_t*) calloc(nthreads, sizeof(pthread_t));
+  if (pool.deques == NULL || workers == NULL || threads == NULL) {
+    rc = -1;
+    goto done;
+  }
+  pool.nthreads = nthreads;
+  pool.fn = fn;
+  pool.ctx = ctx;
+  for (int i = 0; i < nthreads; i++) {
+    pthread_mutex_init(&pool.deques[i].lock, NULL);
+    pool.deques[i].head = njobs * i / nthreads;
+    pool.deques[i].tail = njobs * (i + 1) / nthreads;
+    workers[i].pool = &pool;
+    workers[i].id = i;
+  }
+
+  /* jobs of workers that fail to start are stolen by the others */
+  for (started = 1; started < nthreads; started++) {
+    if (pthread_create(&threads[started], NULL, workerMain, &workers[started]) != 0) {
+      break;
+    }
+  }
+  workerMain(&workers[0]);
+  for (int i = 1; i < started; i++) {
+    pthread_join(threads[i], NULL);
+  }
+  for (int i = 0; i < nthreads; i++) {
+    pthread_mutex_destroy(&pool.deques[i].lock);
+  }
+
+done:
+  free(threads);
+  free(workers);
+  free(pool.deques);
+  return rc;
+}
@@ -0,0 +1,28 @@
+#ifndef z80pool_h
+#define z80pool_h
+
+#include <stddef.h>
+
+typedef void (*Z80_PoolJob)(void* ctx, size_t job, int worker);
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/* Number of online processors, at least 1. */
+int z80_pool_default_threads(void);
+
+/*
+ * Runs fn(ctx, job, worker) for every job in [0, njobs) on nthreads
+ * workers and returns once all jobs are done. Each worker starts with a
+ * contiguous share of the jobs and, when it runs dry, steals the back
+ * half of another worker's remaining share. Returns 0, or -1 if memory
+ * for the workers could not be allocated.
+ */
+int z80_pool_run(size_t njobs, int nthreads, Z80_PoolJob fn, void* ctx);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80pool_h */
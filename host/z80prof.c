@@ -0,0 +1,174 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "z80prof.h"
+
+#define OPERATIONS (op_XOR + 1)
+#define NAME_MAX 48
+#define TEXT_MAX 64
+
+/* an address or operation and the figure it is ranked by */
+typedef struct {
+  uint32_t key;
+  uint64_t value;
+} Rank;
+
+void z80_prof_init(Z80_Prof* prof) {
+  memset(prof, 0, sizeof(*prof));
+}
+
+void z80_prof_flow(Z80_Prof* prof, const Z80_CPU* cpu) {
+  uint16_t sp = cpu->sp.w;
+  if (prof->flow == prf_Call) {
+    /* one not taken, or done by an RST trap, pushes nothing */
+    if (sp != (uint16_t) (prof->sp - 2)) return;
+    prof->calls[cpu->pc]++;
+    if (prof->depth < Z80_PROF_DEPTH) {
+      Z80_ProfFrame* frame = &prof->frames[prof->depth++];
+      frame->entry = cpu->pc;
+      frame->sp = sp;
+      frame->start = cpu->cycles;
+    }
+    return;
+  }
+  if (sp != (uint16_t) (prof->sp + 2)) return;
+  /* close the calls whose return addresses are now off the stack */
+  while (prof->depth > 0) {
+    const Z80_ProfFrame* frame = &prof->frames[prof->depth - 1];
+    if ((unsigned) (uint16_t) (sp - frame->sp) - 1 >= 0x8000) break;
+    prof->inclusive[frame->entry] += cpu->cycles - frame->start;
+    prof->depth--;
+  }
+}
+
+static int byValue(const void* a, const void* b) {
+  const Rank* x = (const Rank*) a;
+  const Rank* y = (const Rank*) b;
+  if (x->value != y->value) return x->value < y->value ? 1 : -1;
+  return x->key < y->key ? -1 : x->key > y->key;
+}
+
+/* ranks the addresses with a nonzero value, highest first */
+static size_t rank(const uint64_t* values, Rank* ranks) {
+  size_t n = 0;
+  for (uint32_t addr = 0; addr < Z80_MEM_SIZE; addr++) {
+    if (values[addr] != 0) {
+      ranks[n].key = addr;
+      ranks[n++].value = values[addr];
+    }
+  }
+  qsort(ranks, n, sizeof(Rank), byValue);
+  return n;
+}
+
+/* addr as the nearest symbol at or below it plus an offset, or empty */
+static void where(const Z80_Symbols* syms, uint16_t addr, char* buf, size_t cap) {
+  buf[0] = 0;
+  if (syms == NULL) return;
+  for (uint32_t a = addr + 1; a-- > 0;) {
+    const char* name = z80_sym_name(syms, (uint16_t) a);
+    if (name == NULL) continue;
+    if (a == addr) snprintf(buf, cap, "%s", name);
+    else snprintf(buf, cap, "%s+%u", name, (unsigned) (addr - a));
+    return;
+  }
+}
+
+/*
+ * Decodes the instruction at addr from its first four bytes, wrapping at
+ * the end of memory. Returns its length, or 0 if it is not valid or is a
+ * longer run of redundant prefixes.
+ */
+static int decodeAt(const uint8_t* mem, uint16_t addr, Z80_OpCode* opcode,
+    uint8_t* bytes) {
+  Z80_Line line;
+  for (int i = 0; i < 4; i++) bytes[i] = mem[(uint16_t) (addr + i)];
+  z80_disassemble_range(bytes, 4, addr, &line, 1, NULL);
+  *opcode = line.opcode;
+  return line.status == ds_Ok ? opcode->len : 0;
+}
+
+static double percent(uint64_t part, uint64_t whole) {
+  return whole != 0 ? 100.0 * part / whole : 0.0;
+}
+
+int z80_prof_report(const Z80_Prof* prof, const uint8_t* mem,
+    const Z80_Symbols* syms, size_t top, FILE* out) {
+  Rank* ranks = (Rank*) malloc(Z80_MEM_SIZE * sizeof(Rank));
+  Rank operations[OPERATIONS + 1];
+  uint64_t op_steps[OPERATIONS + 1] = { 0 };
+  uint64_t steps = 0, total = 0;
+  char name[NAME_MAX], text[TEXT_MAX];
+  size_t n;
+
+  if (ranks == NULL) return -1;
+  for (uint32_t addr = 0; addr < Z80_MEM_SIZE; addr++) {
+    steps += prof->count[addr];
+    total += prof->cycles[addr];
+  }
+  fprintf(out, "%llu steps, %llu T-states, %llu interrupts\n",
+      (unsigned long long) steps, (unsigned long long) total,
+      (unsigned long long) prof->interrupts);
+
+  n = rank(prof->cycles, ranks);
+  fprintf(out, "\ninstructions by T-states\n"
+      "    T-states      %%       steps  address  %-24s instruction\n", "");
+  for (size_t i = 0; i < n && i < top; i++) {
+    uint16_t addr = (uint16_t) ranks[i].key;
+    Z80_OpCode opcode;
+    uint8_t bytes[4];
+    if (decodeAt(mem, addr, &opcode, bytes) != 0) {
+      z80_format_sym(&opcode, fmt_Zilog, syms != NULL ? z80_sym_lookup : NULL,
+          syms, text, sizeof(text));
+    }
+    else {
+      z80_format_data(bytes, 1, fmt_Zilog, text, sizeof(text));
+    }
+    where(syms, addr, name, sizeof(name));
+    fprintf(out, "%12llu %6.2f %11llu  0x%04x   %-24s %s\n",
+        (unsigned long long) ranks[i].value, percent(ranks[i].value, total),
+        (unsigned long long) prof->count[addr], addr, name, text);
+  }
+
+  n = rank(prof->inclusive, ranks);
+  fprintf(out, "\nroutines by inclusive T-states\n"
+      "   inclusive      %%       calls    per call  entry    name\n");
+  for (size_t i = 0; i < n && i < top; i++) {
+    uint16_t addr = (uint16_t) ranks[i].key;
+    where(syms, addr, name, sizeof(name));
+    fprintf(out, "%12llu %6.2f %11llu %11.1f  0x%04x   %s\n",
+        (unsigned long long) ranks[i].value, percent(ranks[i].value, total),
+        (unsigned long long) prof->calls[addr],
+        prof->calls[addr] != 0 ? (double) ranks[i].value / prof->calls[addr] : 0.0,
+        addr, name);
+  }
+
+  /* the last slot collects bytes that do not decode */
+  for (int i = 0; i <= OPERATIONS; i++) {
+    operations[i].key = (uint32_t) i;
+    operations[i].value = 0;
+  }
+  for (uint32_t addr = 0; addr < Z80_MEM_SIZE; addr++) {
+    Z80_OpCode opcode;
+    uint8_t bytes[4];
+    int i;
+    if (prof->count[addr] == 0) continue;
+    i = decodeAt(mem, (uint16_t) addr, &opcode, bytes) != 0
+        ? (int) opcode.operation : OPERATIONS;
+    operations[i].value += prof->cycles[addr];
+    op_steps[i] += prof->count[addr];
+  }
+  qsort(operations, OPERATIONS + 1, sizeof(Rank), byValue);
+  fprintf(out, "\noperations by T-states\n"
+      "    T-states      %%       steps  operation\n");
+  for (int i = 0; i <= OPERATIONS && operations[i].value != 0; i++) {
+    uint32_t op = operations[i].key;
+    fprintf(out, "%12llu %6.2f %11llu  %s\n",
+        (unsigned long long) operations[i].value,
+        percent(operations[i].value, total), (unsigned long long) op_steps[op],
+        op < OPERATIONS ? z80_mnemonic((Z80_Operation) op) : "(invalid)");
+  }
+
+  free(ranks);
+  return ferror(out) ? -1 : 0;
+}
@@ -0,0 +1,106 @@
+#ifndef z80prof_h
+#define z80prof_h
+
+#include "z80emu.h"
+#include "z80sym.h"
+
+/* The calls a profile follows into at once; deeper ones go uncounted. */
+#define Z80_PROF_DEPTH 256
+
+/* What the step being profiled may do to the call stack. */
+typedef enum {
+  prf_None,
+  prf_Call,
+  prf_Return
+} Z80_ProfFlow;
+
+/* A call in progress: where it entered, SP after the push and when. */
+typedef struct {
+  uint16_t entry;
+  uint16_t sp;
+  uint64_t start;
+} Z80_ProfFrame;
+
+/*
+ * An execution profile. count and cycles hold the steps taken and
+ * T-states spent at each address, a halted CPU's idle time counting at
+ * its HALT. A CALL, RST or interrupt that pushes its return address is
+ * followed until the RET that pops it (or one further out), adding the
+ * T-states in between to inclusive at the address it entered; a routine
+ * that calls itself counts the nested calls again. The remaining fields
+ * describe the step in progress.
+ */
+typedef struct {
+  uint64_t count[Z80_MEM_SIZE];
+  uint64_t cycles[Z80_MEM_SIZE];
+  uint64_t calls[Z80_MEM_SIZE];
+  uint64_t inclusive[Z80_MEM_SIZE];
+  Z80_ProfFrame frames[Z80_PROF_DEPTH];
+  int depth;
+  uint64_t interrupts;
+  int started;
+  uint16_t pc;
+  uint16_t sp;
+  uint8_t flow;
+  uint64_t start;
+} Z80_Prof;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void z80_prof_init(Z80_Prof* prof);
+
+/* Matches the step just taken, of kind prof->flow, against the call stack. */
+void z80_prof_flow(Z80_Prof* prof, const Z80_CPU* cpu);
+
+/*
+ * Charges the previous step to its address and notes the step cpu is
+ * about to take: call it before each z80_cpu_step(), as with
+ * z80_trace_step(), and once more at the end.
+ */
+static inline void z80_prof_step(Z80_Prof* prof, const Z80_CPU* cpu) {
+  uint8_t op;
+  if (prof->started) {
+    prof->count[prof->pc]++;
+    prof->cycles[prof->pc] += cpu->cycles - prof->start;
+    if (prof->flow != prf_None) z80_prof_flow(prof, cpu);
+  }
+  prof->started = 1;
+  prof->pc = cpu->pc;
+  prof->sp = cpu->sp.w;
+  prof->start = cpu->cycles;
+  /* as z80_cpu_step() decides between an interrupt and the next opcode */
+  if ((cpu->nmi || (cpu->irq && cpu->iff1)) && !cpu->ei_shadow) {
+    prof->flow = prf_Call;
+    prof->interrupts++;
+    return;
+  }
+  op = cpu->mem[cpu->pc];
+  prof->flow = prf_None;
+  if (op >= 0xc0 && !cpu->halted) {
+    if (op == 0xcd || (op & 0xc7) == 0xc4 || (op & 0xc7) == 0xc7) {
+      prof->flow = prf_Call;
+    }
+    else if (op == 0xc9 || (op & 0xc7) == 0xc0 ||
+        (op == 0xed && (cpu->mem[(uint16_t) (cpu->pc + 1)] & 0xc7) == 0x45)) {
+      prof->flow = prf_Return;
+    }
+  }
+}
+
+/*
+ * Writes a report to out: the top instructions by T-states, disassembled
+ * from mem, the top routines by inclusive T-states and the T-states of
+ * each operation. Instructions are classed as they stand in mem now.
+ * Addresses are shown relative to the nearest symbol at or below them
+ * when syms is not NULL. Returns -1 if a write fails.
+ */
+int z80_prof_report(const Z80_Prof* prof, const uint8_t* mem,
+    const Z80_Symbols* syms, size_t top, FILE* out);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80prof_h */
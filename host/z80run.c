@@ -0,0 +1,344 @@
+/*
+ * Runs a Z80 memory image, such as the assembled supervisor, with a
+ * Z80_Console on stdin and stdout. Stops when the CPU halts with nothing
+ * left to wake it. -d makes each character sent take that many T-states.
+ * -t writes each instruction executed to a file, decoded through a
+ * Z80_ICache. -T records a binary trace instead, for z80tdump; with -K it
+ * keeps only the last blocks of it in memory and writes them at the end.
+ * -s runs the supervisor calls of sup/sup.asm natively instead of through
+ * the ROM code. -x runs translated blocks (z80xlat.h) instead of
+ * interpreting each instruction. -p profiles the run and writes a report
+ * of where the time went, naming addresses from the symbols given with -y.
+ *
+ *   cc -O2 -I.. -o z80run z80run.c z80con.c z80emu.c z80icache.c z80prof.c \
+ *       z80svc.c z80sym.c z80trace.c z80xlat.c ../z80dasm.c
+ *   z80run [-o org] [-e entry] [-c max-cycles] [-d char-cycles]
+ *       [-t trace-file | -T trace-file [-K blocks] | -p report-file
+ *       [-y symbols]] [-s] [-x] [-v] image.bin
+ */
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "z80con.h"
+#include "z80icache.h"
+#include "z80prof.h"
+#include "z80svc.h"
+#include "z80trace.h"
+#include "z80xlat.h"
+
+#define SLICE_CYCLES 1000000
+
+static int stdinRead(void* ctx, int wait) {
+  struct pollfd pfd;
+  uint8_t c;
+  ssize_t n;
+  (void) ctx;
+  fflush(stdout);
+  if (!wait) {
+    pfd.fd = STDIN_FILENO;
+    pfd.events = POLLIN;
+    if (poll(&pfd, 1, 0) <= 0) return -1;
+  }
+  do {
+    n = read(STDIN_FILENO, &c, 1);
+  } while (n < 0 && errno == EINTR);
+  return n == 1 ? c : -2;
+}
+
+static void stdoutWrite(void* ctx, uint8_t c) {
+  (void) ctx;
+  putchar(c);
+}
+
+static double now(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/* steps one instruction at a time, writing each to trace */
+static int runTraced(Z80_Console* con, Z80_ICache* cache, FILE* trace,
+    uint64_t max_cycles) {
+  Z80_CPU* cpu = con->cpu;
+  char text[64];
+  cpu->dirty = cache->dirty;
+  while (max_cycles == 0 || cpu->cycles < max_cycles) {
+    if (!cpu->halted) {
+      const Z80_OpCode* opcode = z80_icache_lookup(cache, cpu->pc);
+      if (opcode == NULL) return -1;
+      if (opcode->len != 0) z80_format(opcode, text, sizeof(text));
+      else z80_format_data(cpu->mem + cpu->pc, 1, fmt_Zilog, text, sizeof(text));
+      fprintf(trace, "%04X  %s\n", cpu->pc, text);
+    }
+    if (z80_con_run(con, 1) == 0) break;
+  }
+  return 0;
+}
+
+/* steps one instruction at a time, recording each in trace */
+static int runRecorded(Z80_Console* con, Z80_Trace* trace, uint64_t max_cycles) {
+  Z80_CPU* cpu = con->cpu;
+  while (max_cycles == 0 || cpu->cycles < max_cycles) {
+    /* a stopped CPU takes no step; the console idles it or ends the run */
+    if (!z80_cpu_stopped(cpu)) z80_trace_step(trace, cpu);
+    if (z80_con_run(con, 1) == 0) break;
+  }
+  return z80_trace_finish(trace, cpu);
+}
+
+/* steps one instruction at a time, profiling each */
+static void runProfiled(Z80_Console* con, Z80_Prof* prof, uint64_t max_cycles) {
+  Z80_CPU* cpu = con->cpu;
+  while (max_cycles == 0 || cpu->cycles < max_cycles) {
+    /* time a stopped CPU idles counts at its HALT */
+    if (!z80_cpu_stopped(cpu)) z80_prof_step(prof, cpu);
+    if (z80_con_run(con, 1) == 0) break;
+  }
+  z80_prof_step(prof, cpu);
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: z80run [-o org] [-e entry] [-c max-cycles] "
+      "[-d char-cycles]\n              [-t trace-file | -T trace-file "
+      "[-K blocks] | -p report-file\n              [-y symbols]] [-s] [-x] "
+      "[-v] image.bin\n");
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  static uint8_t mem[Z80_MEM_SIZE];
+  static char outbuf[65536];
+  Z80_Console con;
+  Z80_CPU cpu;
+  Z80_ICache* cache = NULL;
+  Z80_Svc svc;
+  FILE* trace = NULL;
+  Z80_Trace* recorder = NULL;
+  Z80_Xlat* xlat = NULL;
+  Z80_Prof* prof = NULL;
+  FILE* report = NULL;
+  Z80_Symbols syms;
+  const char* sym_path = NULL;
+  const char* record_path = NULL;
+  unsigned long keep_blocks = 0;
+  int record_fd = -1;
+  unsigned long org = 0;
+  long entry = -1;
+  uint64_t max_cycles = 0;
+  unsigned long char_cycles = 0;
+  int verbose = 0;
+  int native_svc = 0;
+  int translate = 0;
+  double start, elapsed;
+  size_t n;
+  FILE* fp;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "o:e:c:d:t:T:K:p:y:sxv")) != -1) {
+    switch (opt) {
+      case 'o':
+        org = strtoul(optarg, NULL, 0);
+        break;
+      case 'e':
+        entry = strtol(optarg, NULL, 0);
+        break;
+      case 'c':
+        max_cycles = strtoull(optarg, NULL, 0);
+        break;
+      case 'd':
+        char_cycles = strtoul(optarg, NULL, 0);
+        break;
+      case 't':
+        trace = strcmp(optarg, "-") == 0 ? stderr : fopen(optarg, "w");
+        if (trace == NULL) {
+          perror(optarg);
+          return 1;
+        }
+        break;
+      case 'T':
+        record_path = optarg;
+        break;
+      case 'K':
+        keep_blocks = strtoul(optarg, NULL, 0);
+        break;
+      case 'p':
+        report = strcmp(optarg, "-") == 0 ? stderr : fopen(optarg, "w");
+        if (report == NULL) {
+          perror(optarg);
+          return 1;
+        }
+        break;
+      case 'y':
+        sym_path = optarg;
+        break;
+      case 's':
+        native_svc = 1;
+        break;
+      case 'x':
+        translate = 1;
+        break;
+      case 'v':
+        verbose = 1;
+        break;
+      default:
+        usage();
+    }
+  }
+  if (optind != argc - 1 || org >= Z80_MEM_SIZE ||
+      (trace != NULL && (record_path != NULL || translate)) ||
+      (report != NULL && (trace != NULL || record_path != NULL)) ||
+      (sym_path != NULL && report == NULL)) {
+    usage();
+  }
+
+  fp = fopen(argv[optind], "rb");
+  if (fp == NULL) {
+    perror(argv[optind]);
+    return 1;
+  }
+  n = fread(mem + org, 1, Z80_MEM_SIZE - org, fp);
+  fclose(fp);
+
+  setvbuf(stdout, outbuf, _IOFBF, sizeof(outbuf));
+  z80_cpu_init(&cpu, mem, NULL, NULL, NULL);
+  z80_con_init(&con, &cpu, stdinRead, stdoutWrite, NULL);
+  con.char_cycles = (uint32_t) char_cycles;
+  if (entry >= 0) cpu.pc = (uint16_t) entry;
+  z80_svc_init(&svc);
+  if (native_svc) z80_svc_attach(&svc, &cpu);
+  if (translate) {
+    xlat = (Z80_Xlat*) malloc(sizeof(Z80_Xlat));
+    if (xlat == NULL) {
+      fprintf(stderr, "z80run: out of memory\n");
+      return 1;
+    }
+    z80_xlat_init(xlat, mem);
+    z80_xlat_attach(xlat, &cpu);
+  }
+
+  if (record_path != NULL) {
+    record_fd = open(record_path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (record_fd < 0) {
+      perror(record_path);
+      return 1;
+    }
+    recorder = (Z80_Trace*) malloc(sizeof(Z80_Trace));
+    if (recorder == NULL || z80_trace_init(recorder, keep_blocks,
+        keep_blocks != 0 ? -1 : record_fd) != 0) {
+      perror(record_path);
+      return 1;
+    }
+  }
+
+  if (report != NULL) {
+    prof = (Z80_Prof*) malloc(sizeof(Z80_Prof));
+    if (prof == NULL || z80_sym_init(&syms) != 0) {
+      fprintf(stderr, "z80run: out of memory\n");
+      return 1;
+    }
+    z80_prof_init(prof);
+    if (sym_path != NULL && z80_sym_load(&syms, sym_path) < 0) {
+      perror(sym_path);
+      return 1;
+    }
+  }
+
+  start = now();
+  if (prof != NULL) runProfiled(&con, prof, max_cycles);
+  if (recorder != NULL &&
+      (runRecorded(&con, recorder, max_cycles) != 0 ||
+      (keep_blocks != 0 && z80_trace_save(recorder, record_fd) != 0))) {
+    perror(record_path);
+    return 1;
+  }
+  if (trace != NULL) {
+    cache = (Z80_ICache*) malloc(sizeof(Z80_ICache));
+    if (cache == NULL) {
+      fprintf(stderr, "z80run: out of memory\n");
+      return 1;
+    }
+    z80_icache_init(cache, mem);
+    if (runTraced(&con, cache, trace, max_cycles) != 0) {
+      fprintf(stderr, "z80run: out of memory\n");
+      return 1;
+    }
+  }
+  for (;;) {
+    uint64_t slice = SLICE_CYCLES;
+    if (max_cycles != 0) {
+      if (cpu.cycles >= max_cycles) break;
+      if (max_cycles - cpu.cycles < slice) slice = max_cycles - cpu.cycles;
+    }
+    if (z80_con_run(&con, slice) == 0) break;
+  }
+  elapsed = now() - start;
+  fflush(stdout);
+
+  if (verbose) {
+    fprintf(stderr, "z80run: %zu bytes at 0x%04lx, %s at PC 0x%04x after %llu T-states"
+        " (%.3f s, %.1f MHz)\n", n, org,
+        z80_cpu_stopped(&cpu) ? "halted" : "stopped", cpu.pc,
+        (unsigned long long) cpu.cycles, elapsed,
+        elapsed > 0 ? cpu.cycles / elapsed / 1e6 : 0.0);
+    fprintf(stderr, "z80run: AF=%04x BC=%04x DE=%04x HL=%04x IX=%04x IY=%04x "
+        "SP=%04x AF'=%04x BC'=%04x DE'=%04x HL'=%04x\n", cpu.af.w, cpu.bc.w,
+        cpu.de.w, cpu.hl.w, cpu.ix.w, cpu.iy.w, cpu.sp.w, cpu.af_.w,
+        cpu.bc_.w, cpu.de_.w, cpu.hl_.w);
+    if (native_svc) {
+      uint64_t calls = 0;
+      for (int i = 0; i < svc_Count; i++) calls += svc.calls[i];
+      fprintf(stderr, "z80run: %llu supervisor calls run natively, "
+          "%llu continued in ROM\n", (unsigned long long) calls,
+          (unsigned long long) svc.fallbacks);
+    }
+    if (recorder != NULL) {
+      fprintf(stderr, "z80run: traced %llu steps in %llu bytes (%.2f bytes/step)\n",
+          (unsigned long long) recorder->steps,
+          (unsigned long long) recorder->bytes,
+          recorder->steps != 0 ? (double) recorder->bytes / recorder->steps : 0.0);
+    }
+    if (xlat != NULL) {
+      fprintf(stderr, "z80run: translated %llu blocks, %llu invalidated, "
+          "%llu block runs, %llu instructions interpreted\n",
+          (unsigned long long) xlat->translated,
+          (unsigned long long) xlat->invalidated,
+          (unsigned long long) xlat->runs, (unsigned long long) xlat->steps);
+    }
+    if (cache != NULL) {
+      fprintf(stderr, "z80run: decode cache %llu hits, %llu misses, "
+          "%llu page invalidations\n", (unsigned long long) cache->hits,
+          (unsigned long long) cache->misses,
+          (unsigned long long) cache->invalidations);
+    }
+  }
+  if (prof != NULL) {
+    if (z80_prof_report(prof, mem, sym_path != NULL ? &syms : NULL, 20,
+        report) != 0) {
+      perror("z80run: report");
+    }
+    if (report != stderr) fclose(report);
+    z80_sym_free(&syms);
+    free(prof);
+  }
+  if (trace != NULL && trace != stderr) fclose(trace);
+  if (recorder != NULL) {
+    z80_trace_free(recorder);
+    free(recorder);
+    close(record_fd);
+  }
+  if (cache != NULL) {
+    z80_icache_free(cache);
+    free(cache);
+  }
+  if (xlat != NULL) {
+    z80_xlat_free(xlat);
+    free(xlat);
+  }
+  return z80_cpu_stopped(&cpu) ? 0 : 2;
+}
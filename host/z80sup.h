@@ -0,0 +1,30 @@
+#ifndef z80sup_h
+#define z80sup_h
+
+/*
+ * Addresses and values in the supervisor, sup/sup.asm, that host code
+ * relies on, each named after its symbol there. test/sup_test.c
+ * assembles the source and checks every one of them, so a change to the
+ * layout that is not made here too fails make check.
+ */
+#define Z80_SUP_CTRL_RST08 0x80     /* ctrl_rst08: RST 0x08 handler */
+#define Z80_SUP_CTRL_RST38 0x88     /* ctrl_rst38: RST 0x38 handler */
+#define Z80_SUP_EXIT_HALT 0x11d     /* __exit_halt: the HALT of @exit */
+#define Z80_SUP_CON_RXHEAD 0x204    /* con_rxhead */
+#define Z80_SUP_CON_RXTAIL 0x205    /* con_rxtail */
+#define Z80_SUP_CON_CTRLVAL 0x208   /* con_ctrlval: last value sent to con_ctrl */
+#define Z80_SUP_CON_RXBUF 0x300     /* con_rxbuf: the receive ring */
+
+/*
+ * User memory: the user stack and then the program, which runs from
+ * user_prog after reset. Both moved up by 0x300, from 0x200 and 0x240,
+ * when the console driver's vectors and rings took 0x200-0x4ff.
+ */
+#define Z80_SUP_USER_MEM 0x500      /* user_mem */
+#define Z80_SUP_USER_PROG 0x540     /* user_prog */
+
+/* the calls past svc_PutS, which always run in the ROM */
+#define Z80_SUP_SVC_WRITE 5         /* @write */
+#define Z80_SUP_SVC_READ 6          /* @read */
+
+#endif /* z80sup_h */
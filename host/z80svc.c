@@ -0,0 +1,189 @@
+#include <string.h>
+
+#include "z80con.h"
+#include "z80sup.h"
+#include "z80svc.h"
+
+#define A (cpu->af.b.h)
+#define F (cpu->af.b.l)
+
+static uint8_t szxy(uint8_t v) {
+  return (v & (zf_S | zf_X | zf_Y)) | (v == 0 ? zf_Z : 0);
+}
+
+static uint8_t parity(uint8_t v) {
+  v ^= v >> 4;
+  v ^= v >> 2;
+  v ^= v >> 1;
+  return (v & 1) != 0 ? 0 : zf_P;
+}
+
+/* the flags of AND, OR and shifts by their result */
+static uint8_t logicFlags(uint8_t v) {
+  return szxy(v) | parity(v);
+}
+
+static uint8_t addFlags(uint8_t a, uint8_t v) {
+  unsigned r = (unsigned) a + v;
+  return szxy((uint8_t) r) | ((a ^ v ^ r) & zf_H)
+      | (((a ^ ~v) & (a ^ r) & 0x80) >> 5) | ((r >> 8) & zf_C);
+}
+
+static uint8_t cpFlags(uint8_t a, uint8_t v) {
+  unsigned r = (unsigned) a - v;
+  return (szxy((uint8_t) r) & ~(zf_X | zf_Y)) | (v & (zf_X | zf_Y)) | zf_N
+      | ((a ^ v ^ r) & zf_H) | (((a ^ v) & (a ^ r) & 0x80) >> 5)
+      | ((r >> 8) & zf_C);
+}
+
+static void wr(Z80_CPU* cpu, uint16_t addr, uint8_t v) {
+  cpu->mem[addr] = v;
+  if (cpu->dirty != NULL) cpu->dirty[addr >> 11] |= 1 << ((addr >> 8) & 7);
+}
+
+static void wr16(Z80_CPU* cpu, uint16_t addr, uint16_t v) {
+  wr(cpu, addr, (uint8_t) v);
+  wr(cpu, (uint16_t) (addr + 1), (uint8_t) (v >> 8));
+}
+
+/* IN A,(port) and OUT (port),A with high on the upper address lines */
+static uint8_t in(Z80_CPU* cpu, uint8_t high, uint8_t port) {
+  if (cpu->in == NULL) return 0xff;
+  return cpu->in(cpu->io_ctx, (uint16_t) (high << 8 | port));
+}
+
+static void out(Z80_CPU* cpu, uint8_t high, uint8_t port, uint8_t v) {
+  if (cpu->out != NULL) cpu->out(cpu->io_ctx, (uint16_t) (high << 8 | port), v);
+}
+
+/* true while the console driver has output queued */
+static int txQueued(const Z80_CPU* cpu) {
+  return (cpu->mem[Z80_SUP_CON_CTRLVAL] & con_TxInt) != 0;
+}
+
+/* completes the RST, as the dispatcher would, into the routine at entry */
+static void enterRom(Z80_CPU* cpu, uint16_t entry) {
+  cpu->sp.w -= 2;
+  wr16(cpu, cpu->sp.w, cpu->pc);
+  cpu->pc = entry;
+}
+
+static void setVec(Z80_CPU* cpu) {
+  uint8_t c = cpu->bc.b.l;
+  uint8_t a = c >> 3;
+  uint8_t f;
+  if (c == 0x38) {
+    wr16(cpu, Z80_SUP_CTRL_RST38, cpu->hl.w);
+    A = c;
+    F = cpFlags(c, 0x38);
+    return;
+  }
+  /* the third SRL shifts bit 2 into carry; vector 0 returns on its Z */
+  f = logicFlags(a) | ((c >> 2) & zf_C);
+  if (a != 0) {
+    a--;
+    f = cpFlags(a, 4);
+    /* RET P: only indexes 0-3 (vectors 0x8-0x20) are stored */
+    if ((f & zf_S) != 0) {
+      f = addFlags((uint8_t) (a + a), Z80_SUP_CTRL_RST08);
+      a = (uint8_t) (a + a + Z80_SUP_CTRL_RST08);
+      wr16(cpu, a, cpu->hl.w);
+    }
+  }
+  A = a;
+  F = f;
+}
+
+int z80_svc_trap(void* ctx, Z80_CPU* cpu, uint8_t vector) {
+  Z80_Svc* svc = (Z80_Svc*) ctx;
+  uint8_t index = A;
+  uint16_t entry;
+  uint8_t status;
+  if (vector != Z80_SVC_VECTOR || index >= svc_Count) return 0;
+  entry = (uint16_t) (cpu->mem[Z80_SVC_TABLE + 2 * index]
+      | cpu->mem[Z80_SVC_TABLE + 2 * index + 1] << 8);
+  svc->calls[index]++;
+
+  switch (index) {
+    case svc_Exit:
+      /* output still queued drains under the ROM's interrupt handler */
+      if (txQueued(cpu)) break;
+      if (cpu->mem[Z80_SUP_CON_CTRLVAL] != 0) {
+        out(cpu, 0, Z80_CON_CTRL, 0);
+        wr(cpu, Z80_SUP_CON_CTRLVAL, 0);
+      }
+      enterRom(cpu, Z80_SUP_EXIT_HALT + 1);
+      A = 0;
+      F = logicFlags(0);
+      cpu->halted = 1;
+      return 1;
+    case svc_SetVec:
+      setVec(cpu);
+      return 1;
+    case svc_GetC: {
+      uint8_t head = cpu->mem[Z80_SUP_CON_RXHEAD];
+      uint8_t tail = cpu->mem[Z80_SUP_CON_RXTAIL];
+      if (head != tail) {
+        A = cpu->mem[Z80_SUP_CON_RXBUF + tail];
+        F = cpFlags(A, A);
+        wr(cpu, Z80_SUP_CON_RXTAIL, (uint8_t) (tail + 1));
+      }
+      else if ((cpu->mem[Z80_SUP_CON_CTRLVAL] & con_RxInt) != 0) {
+        A = con_RxInt;
+        F = logicFlags(A) | zf_H;
+      }
+      else if ((in(cpu, head, Z80_CON_STATUS) & con_InputReady) != 0) {
+        A = con_InputReady;
+        F = logicFlags(A) | zf_H;
+      }
+      else {
+        A = in(cpu, 0, Z80_CON_IO);
+        F = logicFlags(0) | zf_H;
+      }
+      return 1;
+    }
+    case svc_PutC:
+      if (txQueued(cpu)) break;
+      status = in(cpu, 0, Z80_CON_STATUS);
+      if ((status & con_OutputReady) != 0) break;
+      out(cpu, cpu->bc.b.l, Z80_CON_IO, cpu->bc.b.l);
+      A = cpu->bc.b.l;
+      F = logicFlags(0) | zf_H;
+      return 1;
+    default:
+      if (txQueued(cpu)) break;
+      for (;;) {
+        uint8_t c = cpu->mem[cpu->hl.w];
+        cpu->bc.b.l = c;
+        if (c == 0) break;
+        status = in(cpu, c, Z80_CON_STATUS);
+        if ((status & con_OutputReady) != 0) {
+          svc->fallbacks++;
+          enterRom(cpu, entry);
+          return 1;
+        }
+        out(cpu, c, Z80_CON_IO, c);
+        cpu->hl.w++;
+      }
+      A = 0;
+      F = logicFlags(0);
+      return 1;
+  }
+  svc->fallbacks++;
+  enterRom(cpu, entry);
+  return 1;
+}
+
+void z80_svc_init(Z80_Svc* svc) {
+  memset(svc, 0, sizeof(*svc));
+}
+
+void z80_svc_attach(Z80_Svc* svc, Z80_CPU* cpu) {
+  cpu->rst_trap = z80_svc_trap;
+  cpu->trap_ctx = svc;
+}
+
+void z80_svc_detach(Z80_CPU* cpu) {
+  cpu->rst_trap = NULL;
+  cpu->trap_ctx = NULL;
+}
@@ -0,0 +1,52 @@
+#ifndef z80svc_h
+#define z80svc_h
+
+#include "z80emu.h"
+
+/* The supervisor call vector and table of sup/sup.asm. */
+#define Z80_SVC_VECTOR 0x28
+#define Z80_SVC_TABLE 0x100
+
+typedef enum {
+  svc_Exit,
+  svc_SetVec,
+  svc_GetC,
+  svc_PutC,
+  svc_PutS,
+  svc_Count
+} Z80_SvcIndex;
+
+/*
+ * Runs the supervisor calls of sup/sup.asm natively. Attached to a CPU,
+ * it traps RST 0x28 when A holds a known index and does the work of the
+ * ROM routine through the CPU's I/O callbacks, leaving the registers,
+ * flags and memory as the ROM code would, except for R, the T-states
+ * (only the RST's are counted) and the dead stack below SP. A call that
+ * cannot complete at once, such as output while the console is busy or
+ * the console driver still has output queued, continues in the ROM
+ * routine, as do @write and @read. Detach to run every call in the ROM.
+ */
+typedef struct {
+  uint64_t calls[svc_Count];
+  uint64_t fallbacks;
+} Z80_Svc;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void z80_svc_init(Z80_Svc* svc);
+
+/* Sets svc as cpu's RST trap. */
+void z80_svc_attach(Z80_Svc* svc, Z80_CPU* cpu);
+
+void z80_svc_detach(Z80_CPU* cpu);
+
+/* The Z80_TrapFn installed by z80_svc_attach(), with svc as ctx. */
+int z80_svc_trap(void* ctx, Z80_CPU* cpu, uint8_t vector);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80svc_h */
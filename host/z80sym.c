@@ -0,0 +1,216 @@
+#include <stdio.h>
+#include <string.h>
+
+#include "z80sym.h"
+
+int z80_sym_init(Z80_Symbols* syms) {
+  memset(syms, 0, sizeof(*syms));
+  syms->slot = (uint32_t*) calloc(Z80_SYM_SLOTS, sizeof(uint32_t));
+  syms->names = (char*) malloc(4096);
+  if (syms->slot == NULL || syms->names == NULL) {
+    z80_sym_free(syms);
+    return -1;
+  }
+  syms->names[0] = '\0';
+  syms->names_len = 1;
+  syms->names_cap = 4096;
+  return 0;
+}
+
+void z80_sym_free(Z80_Symbols* syms) {
+  free(syms->slot);
+  free(syms->names);
+  memset(syms, 0, sizeof(*syms));
+}
+
+int z80_sym_define(Z80_Symbols* syms, const char* name, size_t len,
+    uint16_t addr) {
+  if (syms->slot[addr] != 0) return 0;
+  if (syms->names_cap - syms->names_len < len + 1) {
+    size_t cap = syms->names_cap;
+    char* names;
+    while (cap - syms->names_len < len + 1) cap *= 2;
+    names = (char*) realloc(syms->names, cap);
+    if (names == NULL) return -1;
+    syms->names = names;
+    syms->names_cap = cap;
+  }
+  syms->count++;
+  syms->slot[addr] = (uint32_t) syms->names_len;
+  memcpy(syms->names + syms->names_len, name, len);
+  syms->names_len += len;
+  syms->names[syms->names_len++] = '\0';
+  return 0;
+}
+
+const char* z80_sym_lookup(const void* ctx, uint16_t addr) {
+  return z80_sym_name((const Z80_Symbols*) ctx, addr);
+}
+
+typedef struct {
+  const char* s;
+  size_t len;
+} Token;
+
+static int isNameStart(char c) {
+  return (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z')
+      || c == '_' || c == '.' || c == '@' || c == '?';
+}
+
+static int isNameChar(char c) {
+  return isNameStart(c) || (c >= '0' && c <= '9') || c == '$';
+}
+
+static int digitValue(char c) {
+  if (c >= '0' && c <= '9') return c - '0';
+  if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+  return -1;
+}
+
+static int sameWord(const Token* t, const char* word) {
+  size_t i;
+  for (i = 0; i < t->len && word[i] != '\0'; i++) {
+    char c = t->s[i];
+    if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+    if (c != word[i]) return 0;
+  }
+  return i == t->len && word[i] == '\0';
+}
+
+static int isName(const Token* t) {
+  if (t->len == 0 || !isNameStart(t->s[0])) return 0;
+  for (size_t i = 1; i < t->len; i++) {
+    if (!isNameChar(t->s[i])) return 0;
+  }
+  return 1;
+}
+
+static int digits(const char* s, size_t len, int base, long* value) {
+  long v = 0;
+  if (len == 0) return 0;
+  for (size_t i = 0; i < len; i++) {
+    int d = digitValue(s[i]);
+    if (d < 0 || d >= base) return 0;
+    v = v * base + d;
+    if (v > 0xffff) return 0;
+  }
+  *value = v;
+  return 1;
+}
+
+/* Parses an assembler number: decimal, 0x1F, $1F, #1F or 01FH. */
+static int number(const Token* t, long* value) {
+  const char* s = t->s;
+  size_t len = t->len;
+  if (len == 0 || (digitValue(s[0]) < 0 && s[0] != '$' && s[0] != '#')) return 0;
+  if (len > 2 && s[0] == '0' && (s[1] == 'x' || s[1] == 'X')) {
+    return digits(s + 2, len - 2, 16, value);
+  }
+  if (s[0] == '$' || s[0] == '#') return digits(s + 1, len - 1, 16, value);
+  if (s[len - 1] == 'h' || s[len - 1] == 'H') {
+    return s[0] >= '0' && s[0] <= '9' && digits(s, len - 1, 16, value);
+  }
+  return digits(s, len, 10, value);
+}
+
+/* Parses a bare hexadecimal column, also accepting the forms number() does. */
+static int hexColumn(const Token* t, long* value) {
+  if (t->len == 0 || !((t->s[0] >= '0' && t->s[0] <= '9') || t->s[0] == '$'
+      || t->s[0] == '#')) {
+    return 0;
+  }
+  return digits(t->s, t->len, 16, value) || number(t, value);
+}
+
+/* Splits a line into at most max tokens at blanks, ':' and '='. */
+static int tokenize(const char* p, const char* end, Token* tokens, int max) {
+  int n = 0;
+  while (p < end && *p != ';') {
+    const char* start;
+    if (*p == ' ' || *p == '\t' || *p == '\r' || *p == ':') {
+      p++;
+      continue;
+    }
+    if (n == max) return -1;
+    start = p;
+    if (*p == '=') {
+      p++;
+    }
+    else {
+      while (p < end && *p != ' ' && *p != '\t' && *p != '\r' && *p != ':'
+          && *p != '=' && *p != ';') {
+        p++;
+      }
+    }
+    tokens[n].s = start;
+    tokens[n].len = (size_t) (p - start);
+    n++;
+  }
+  return n;
+}
+
+static int parseLine(const char* p, const char* end, Token* name, long* value) {
+  Token t[3];
+  int n = tokenize(p, end, t, 3);
+  if (n == 3 && isName(&t[0]) && (sameWord(&t[1], "equ")
+      || sameWord(&t[1], ".equ") || sameWord(&t[1], "defl")
+      || sameWord(&t[1], "="))) {
+    *name = t[0];
+    return number(&t[2], value);
+  }
+  if (n == 2 && isName(&t[1]) && hexColumn(&t[0], value)) {
+    *name = t[1];
+    return 1;
+  }
+  if (n == 2 && isName(&t[0]) && hexColumn(&t[1], value)) {
+    *name = t[0];
+    return 1;
+  }
+  return 0;
+}
+
+long z80_sym_parse(Z80_Symbols* syms, const char* text, size_t len) {
+  const char* p = text;
+  const char* end = text + len;
+  long count = 0;
+  while (p < end) {
+    const char* eol = (const char*) memchr(p, '\n', (size_t) (end - p));
+    Token name;
+    long value;
+    if (eol == NULL) eol = end;
+    if (parseLine(p, eol, &name, &value)) {
+      if (z80_sym_define(syms, name.s, name.len, (uint16_t) value) != 0) return -1;
+      count++;
+    }
+    p = eol + 1;
+  }
+  return count;
+}
+
+long z80_sym_load(Z80_Symbols* syms, const char* path) {
+  FILE* fp = fopen(path, "rb");
+  char* text = NULL;
+  size_t len = 0;
+  size_t cap = 0;
+  long count = -1;
+  if (fp == NULL) return -1;
+  for (;;) {
+    size_t n;
+    if (cap - len < 4096) {
+      char* grown = (char*) realloc(text, cap != 0 ? cap * 2 : 65536);
+      if (grown == NULL) goto done;
+      text = grown;
+      cap = cap != 0 ? cap * 2 : 65536;
+    }
+    n = fread(text + len, 1, cap - len, fp);
+    len += n;
+    if (n == 0) break;
+  }
+  if (!ferror(fp)) count = z80_sym_parse(syms, text, len);
+
+done:
+  free(text);
+  fclose(fp);
+  return count;
+}
@@ -0,0 +1,70 @@
+#ifndef z80sym_h
+#define z80sym_h
+
+#include "z80dasm.h"
+
+#define Z80_SYM_SLOTS 65536
+
+/*
+ * Symbols indexed directly by address. slot[addr] is the offset of the
+ * name for addr in the name pool, or 0 if addr has none; the pool starts
+ * with a NUL so that offset 0 is never a name.
+ */
+typedef struct {
+  uint32_t* slot;
+  char* names;
+  size_t names_len;
+  size_t names_cap;
+  size_t count;
+} Z80_Symbols;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+int z80_sym_init(Z80_Symbols* syms);
+
+void z80_sym_free(Z80_Symbols* syms);
+
+/*
+ * Names addr with the len characters at name, unless addr already has a
+ * name: the first definition of an address is kept, so a later constant
+ * that happens to equal a code address does not replace its label.
+ * Returns 0, or -1 if memory is exhausted.
+ */
+int z80_sym_define(Z80_Symbols* syms, const char* name, size_t len,
+    uint16_t addr);
+
+/*
+ * Defines the symbols found in the len characters of a symbol file or
+ * listing. Recognized lines are
+ *
+ *   name[:] equ value      name[:] = value      name: defl value
+ *   value name             name value
+ *
+ * where an equ or = value may be decimal, 0x1F, $1F, #1F or 01FH, and a
+ * value in a two-column line is always hexadecimal (as in map files and
+ * listing symbol tables). Anything from ';' on is a comment. Other lines,
+ * including those whose value is an expression, are skipped. When an
+ * address is named more than once the first definition wins, as with
+ * z80_sym_define(). Returns the number of definitions read, or -1 if
+ * memory is exhausted.
+ */
+long z80_sym_parse(Z80_Symbols* syms, const char* text, size_t len);
+
+/* As z80_sym_parse() on the contents of a file; -1 also on I/O errors. */
+long z80_sym_load(Z80_Symbols* syms, const char* path);
+
+/* A Z80_SymbolLookup over a Z80_Symbols passed as ctx. */
+const char* z80_sym_lookup(const void* ctx, uint16_t addr);
+
+static inline const char* z80_sym_name(const Z80_Symbols* syms, uint16_t addr) {
+  uint32_t offset = syms->slot[addr];
+  return offset != 0 ? syms->names + offset : NULL;
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80sym_h */
@@ -0,0 +1,210 @@
+/*
+ * Lists a binary trace written by z80run -T: one line per step with its
+ * index, address, bytes and instruction, which is disassembled straight
+ * from the mapped trace file. -r adds the registers each step changed
+ * and -R every register after it. -f and -n select a range of steps.
+ *
+ *   cc -O2 -I.. -o z80tdump z80tdump.c z80list.c z80trace.c ../z80dasm.c
+ *   z80tdump [-f first] [-n count] [-r | -R] [-l] [-d | -H] trace-file
+ */
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "z80list.h"
+#include "z80trace.h"
+
+#define FLUSH_SIZE (1 << 20)
+#define MAX_LINE 256
+
+static const char* const s_names[13] = {
+  "AF", "BC", "DE", "HL", "IX", "IY", "SP", NULL,
+  "AF'", "BC'", "DE'", "HL'", "I"
+};
+
+static int flushOut(Z80_Buf* out) {
+  size_t done = 0;
+  while (done < out->len) {
+    ssize_t n = write(STDOUT_FILENO, out->data + done, out->len - done);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      perror("z80tdump: write");
+      return -1;
+    }
+    done += (size_t) n;
+  }
+  out->len = 0;
+  return 0;
+}
+
+/* writes the digits of v, most significant first, as printf's %0*X */
+static char* putHex(char* p, unsigned v, int digits) {
+  static const char hex[] = "0123456789ABCDEF";
+  for (int i = 0; i < digits; i++) p[i] = hex[(v >> 4 * (digits - 1 - i)) & 0xf];
+  return p + digits;
+}
+
+/* writes v right aligned in width columns, as printf's %*llu */
+static char* putDecimal(char* p, uint64_t v, int width) {
+  char digits[20];
+  int n = 0;
+  do {
+    digits[n++] = (char) ('0' + v % 10);
+    v /= 10;
+  } while (v != 0);
+  for (; width > n; width--) *p++ = ' ';
+  while (n > 0) *p++ = digits[--n];
+  return p;
+}
+
+static char* appendRegs(char* p, const Z80_TraceRegs* regs, unsigned mask) {
+  for (int i = 0; i < 13; i++) {
+    if ((mask & 1u << i) == 0 || s_names[i] == NULL) continue;
+    *p++ = ' ';
+    p = stpcpy(p, s_names[i]);
+    *p++ = '=';
+    p = putHex(p, regs->r[i], i < 12 ? 4 : 2);
+  }
+  if (mask & trc_Misc) {
+    unsigned misc = regs->r[13];
+    p += sprintf(p, " IFF=%u/%u IM=%u%s", misc & trc_Iff1,
+        (misc & trc_Iff2) >> 1, (misc >> trc_ImShift) & 3,
+        (misc & trc_Halted) ? " HALT" : "");
+  }
+  return p;
+}
+
+/* appends the line for step to out, with regs of after, the step's result */
+static int listStep(Z80_Buf* out, const Z80_TraceStep* step,
+    const Z80_TraceStep* after, int syntax, int regs) {
+  char* p = z80_buf_reserve(out, MAX_LINE);
+  Z80_Line line;
+  char text[64];
+  char* q;
+  size_t len;
+  int n;
+
+  if (p == NULL) return -1;
+  q = putDecimal(p, step->index, 10);
+  *q++ = ' ';
+  *q++ = ' ';
+  q = putHex(q, step->pc, 4);
+  *q++ = ' ';
+  *q++ = ' ';
+  for (int i = 0; i < 4; i++) {
+    if (i < step->len) q = putHex(q, step->bytes[i], 2);
+    else q = stpcpy(q, "  ");
+    *q++ = ' ';
+  }
+  n = (int) (q - p);
+  if (step->len == 0) {
+    strcpy(text, step->interrupt ? "(interrupt)"
+        : (step->regs.r[13] & trc_Halted) ? "(halted)" : "(end)");
+  }
+  else if (z80_disassemble_range(step->bytes, step->len, step->pc, &line, 1,
+      NULL) == 1 && line.status == ds_Ok) {
+    z80_format_syntax(&line.opcode, syntax, text, sizeof(text));
+  }
+  else {
+    z80_format_data(step->bytes, step->len, syntax, text, sizeof(text));
+  }
+  len = strlen(text);
+  p[n++] = ' ';
+  memcpy(p + n, text, len);
+  n += (int) len;
+  for (; len < 20; len++) p[n++] = ' ';
+  /* the last step has no result; -R shows the registers it ended with */
+  if (regs > 0) {
+    n = (int) (appendRegs(p + n, after != NULL ? &after->regs : &step->regs,
+        (unsigned) regs) - p);
+  }
+  else if (regs < 0 && after != NULL) {
+    n = (int) (appendRegs(p + n, &after->regs, after->changed) - p);
+  }
+  while (n > 0 && p[n - 1] == ' ') n--;
+  p[n++] = '\n';
+  out->len += (size_t) n;
+  return 0;
+}
+
+static void usage(void) {
+  fprintf(stderr, "usage: z80tdump [-f first] [-n count] [-r | -R] [-l] "
+      "[-d | -H] trace-file\n");
+  exit(1);
+}
+
+int main(int argc, char** argv) {
+  Z80_TraceReader reader;
+  Z80_TraceStep step;
+  Z80_TraceStep prev = { 0 };
+  Z80_Buf out;
+  unsigned long long first = 0;
+  unsigned long long count = 0;
+  int syntax = fmt_Zilog;
+  int regs = 0;
+  unsigned long long listed = 0;
+  int have_prev = 0;
+  int failed = 0;
+  int rc;
+  int opt;
+
+  while ((opt = getopt(argc, argv, "f:n:rRldH")) != -1) {
+    switch (opt) {
+      case 'f':
+        first = strtoull(optarg, NULL, 0);
+        break;
+      case 'n':
+        count = strtoull(optarg, NULL, 0);
+        break;
+      case 'r':
+        regs = -1;
+        break;
+      case 'R':
+        regs = 0x3f7f;
+        break;
+      case 'l':
+        syntax |= fmt_Lower;
+        break;
+      case 'd':
+        syntax |= fmt_HexDollar;
+        break;
+      case 'H':
+        syntax |= fmt_HexSuffix;
+        break;
+      default:
+        usage();
+    }
+  }
+  if (optind != argc - 1) usage();
+
+  if (z80_trace_open(&reader, argv[optind]) != 0) {
+    perror(argv[optind]);
+    return 1;
+  }
+  z80_buf_init(&out);
+  rc = first != 0 ? z80_trace_seek(&reader, first) : 1;
+  /* a step is listed once the next shows its effect on the registers */
+  while (rc > 0 && !failed) {
+    rc = z80_trace_next(&reader, &step);
+    if (have_prev && listStep(&out, &prev, rc > 0 ? &step : NULL, syntax,
+        regs) != 0) {
+      fprintf(stderr, "z80tdump: out of memory\n");
+      failed = 1;
+    }
+    else if (out.len >= FLUSH_SIZE && flushOut(&out) != 0) {
+      failed = 1;
+    }
+    if (rc <= 0 || (count != 0 && listed++ == count)) break;
+    prev = step;
+    have_prev = 1;
+  }
+  if (rc < 0 && !failed) {
+    fprintf(stderr, "z80tdump: %s: malformed trace\n", argv[optind]);
+  }
+  if (flushOut(&out) != 0) failed = 1;
+  z80_buf_free(&out);
+  z80_trace_close(&reader);
+  return rc < 0 || failed ? 1 : 0;
+}
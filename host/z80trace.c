@@ -0,0 +1,430 @@
+#include <errno.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "z80dasm.h"
+#include "z80trace.h"
+
+#define ALL_REGS 0x3f7f
+
+static const char s_magic[8] = { 'Z', '8', '0', 'T', 'R', 'A', 'C', 'E' };
+
+static void put16(uint8_t* p, uint16_t v) {
+  p[0] = (uint8_t) v;
+  p[1] = (uint8_t) (v >> 8);
+}
+
+static void put32(uint8_t* p, uint32_t v) {
+  put16(p, (uint16_t) v);
+  put16(p + 2, (uint16_t) (v >> 16));
+}
+
+static uint16_t get16(const uint8_t* p) {
+  return (uint16_t) (p[0] | p[1] << 8);
+}
+
+static uint32_t get32(const uint8_t* p) {
+  return get16(p) | (uint32_t) get16(p + 2) << 16;
+}
+
+static int writeAll(int fd, const uint8_t* p, size_t len) {
+  while (len != 0) {
+    ssize_t n = write(fd, p, len);
+    if (n < 0) {
+      if (errno == EINTR) continue;
+      return -1;
+    }
+    p += n;
+    len -= (size_t) n;
+  }
+  return 0;
+}
+
+static int writeHeader(int fd) {
+  uint8_t header[Z80_TRACE_HEADER] = { 0 };
+  memcpy(header, s_magic, sizeof(s_magic));
+  put16(header + 8, Z80_TRACE_VERSION);
+  put32(header + 10, Z80_TRACE_BLOCK);
+  return writeAll(fd, header, sizeof(header));
+}
+
+static void snapshot(const Z80_CPU* cpu, Z80_TraceRegs* regs) {
+  regs->r[0] = cpu->af.w;
+  regs->r[1] = cpu->bc.w;
+  regs->r[2] = cpu->de.w;
+  regs->r[3] = cpu->hl.w;
+  regs->r[4] = cpu->ix.w;
+  regs->r[5] = cpu->iy.w;
+  regs->r[6] = cpu->sp.w;
+  regs->r[7] = 0;
+  regs->r[8] = cpu->af_.w;
+  regs->r[9] = cpu->bc_.w;
+  regs->r[10] = cpu->de_.w;
+  regs->r[11] = cpu->hl_.w;
+  regs->r[12] = cpu->i;
+  regs->r[13] = (uint16_t) ((cpu->iff1 ? trc_Iff1 : 0) | (cpu->iff2 ? trc_Iff2 : 0)
+      | cpu->im << trc_ImShift | (cpu->halted ? trc_Halted : 0));
+  regs->r[14] = 0;
+  regs->r[15] = 0;
+}
+
+/* the mask of registers that differ, comparing four at a time */
+static unsigned changed(const Z80_TraceRegs* a, const Z80_TraceRegs* b) {
+  const uint64_t low = 0x7fff7fff7fff7fffull;
+  unsigned mask = 0;
+  for (int i = 0; i < 4; i++) {
+    uint64_t x, y;
+    memcpy(&x, a->r + 4 * i, sizeof(x));
+    memcpy(&y, b->r + 4 * i, sizeof(y));
+    x ^= y;
+    /* bit 15 of each nonzero lane, gathered into bits 48-51 */
+    x = (((x & low) + low) | x) & ~low;
+    mask |= (unsigned) ((x >> 15) * 0x0001000200040008ull >> 48) << 4 * i;
+  }
+  return mask;
+}
+
+/* writes the registers in mask, in bit order: I and Misc take one byte */
+static uint8_t* putRegs(uint8_t* p, const Z80_TraceRegs* regs, unsigned mask) {
+  while (mask != 0) {
+    int i = __builtin_ctz(mask);
+    mask &= mask - 1;
+    *p++ = (uint8_t) regs->r[i];
+    if (i < 12) *p++ = (uint8_t) (regs->r[i] >> 8);
+  }
+  return p;
+}
+
+static const uint8_t* getRegs(const uint8_t* p, const uint8_t* end,
+    Z80_TraceRegs* regs, unsigned mask) {
+  for (int i = 0; mask != 0; i++, mask >>= 1) {
+    if ((mask & 1) == 0) continue;
+    if (i < 12) {
+      if (end - p < 2) return NULL;
+      regs->r[i] = get16(p);
+      p += 2;
+    }
+    else {
+      if (p == end) return NULL;
+      regs->r[i] = *p++;
+    }
+  }
+  return p;
+}
+
+static uint8_t* curBlock(const Z80_Trace* trace) {
+  return trace->ring + trace->cur * Z80_TRACE_BLOCK;
+}
+
+/* starts a block in the current slot with a keyframe of cpu's registers */
+static void startBlock(Z80_Trace* trace, const Z80_CPU* cpu) {
+  uint8_t* block = curBlock(trace);
+  if (trace->fd < 0 && trace->held == trace->nblocks) trace->held--;
+  put32(block + 8, (uint32_t) trace->steps);
+  put32(block + 12, (uint32_t) (trace->steps >> 32));
+  snapshot(cpu, &trace->regs);
+  trace->used = (size_t) (putRegs(block + Z80_TRACE_BLOCK_HEADER, &trace->regs,
+      ALL_REGS) - block);
+  trace->block_steps = 0;
+  trace->pc_known = 0;
+}
+
+/* completes the current block, writing it out or keeping it in the ring */
+static void endBlock(Z80_Trace* trace) {
+  uint8_t* block = curBlock(trace);
+  put32(block, (uint32_t) trace->used);
+  put32(block + 4, trace->block_steps);
+  trace->bytes += trace->used;
+  if (trace->fd >= 0) {
+    if (writeAll(trace->fd, block, trace->used) != 0) trace->error = 1;
+  }
+  else {
+    trace->cur = (trace->cur + 1) % trace->nblocks;
+    trace->held++;
+  }
+  trace->used = 0;
+}
+
+int z80_trace_init(Z80_Trace* trace, size_t nblocks, int fd) {
+  memset(trace, 0, sizeof(*trace));
+  trace->nblocks = nblocks != 0 ? nblocks : 1;
+  trace->fd = fd;
+  trace->ring = (uint8_t*) malloc(trace->nblocks * Z80_TRACE_BLOCK);
+  if (trace->ring == NULL) return -1;
+  if (fd >= 0) {
+    if (writeHeader(fd) != 0) return -1;
+    trace->bytes = Z80_TRACE_HEADER;
+  }
+  return 0;
+}
+
+void z80_trace_free(Z80_Trace* trace) {
+  free(trace->ring);
+  trace->ring = NULL;
+}
+
+/*
+ * Copies the instruction at pc, a prefix run too long for the four bytes
+ * record() looks at, into run. Returns its length, cut to
+ * Z80_TRACE_MAX_BYTES, or 0 if it is not valid.
+ */
+static int prefixRun(const uint8_t* mem, uint16_t pc, uint8_t* run) {
+  int len;
+  for (int i = 0; i < Z80_TRACE_MAX_BYTES; i++) run[i] = mem[(uint16_t) (pc + i)];
+  len = z80_length_avail(run, Z80_TRACE_MAX_BYTES);
+  return len < 0 ? Z80_TRACE_MAX_BYTES : len;
+}
+
+/*
+ * Appends a record for the instruction at cpu->pc, or for none without
+ * fetch. Everything is worked out before the first store to the ring,
+ * which as a byte store could alias the state it was computed from.
+ */
+static void record(Z80_Trace* trace, const Z80_CPU* cpu, int fetch,
+    uint8_t flags) {
+  const uint8_t* mem = cpu->mem;
+  uint16_t pc = cpu->pc;
+  uint16_t next_pc = trace->next_pc;
+  uint8_t tag = flags;
+  uint8_t op[4] = { 0 };
+  uint8_t run[Z80_TRACE_MAX_BYTES];
+  Z80_TraceRegs now;
+  unsigned mask;
+  uint8_t* p;
+  int len = 0;
+
+  if (Z80_TRACE_BLOCK - trace->used < Z80_TRACE_MAX_RECORD) endBlock(trace);
+  if (trace->used == 0) startBlock(trace, cpu);
+
+  if (fetch) {
+    if (pc <= Z80_MEM_SIZE - 4) {
+      memcpy(op, mem + pc, 4);
+    }
+    else {
+      for (int i = 0; i < 4; i++) op[i] = mem[(uint16_t) (pc + i)];
+    }
+    len = z80_length_avail(op, 4);
+    if (len < 0) len = prefixRun(mem, pc, run);
+    /* the CPU runs an invalid opcode as one byte */
+    if (len == 0) len = 1;
+  }
+  tag |= (uint8_t) (len <= 4 ? len : trc_LenLong);
+  if (!trace->pc_known) {
+    tag |= trc_PcAbs;
+  }
+  else if (pc != next_pc) {
+    tag |= (uint16_t) (pc - next_pc + 128) < 256 ? trc_PcRel : trc_PcAbs;
+  }
+
+  snapshot(cpu, &now);
+  mask = changed(&now, &trace->regs);
+  if (mask != 0) {
+    tag |= trc_Regs;
+    if (mask > 0xff) mask |= trc_Ext;
+    trace->regs = now;
+  }
+
+  p = curBlock(trace) + trace->used;
+  *p++ = tag;
+  if ((tag & trc_PcMask) == trc_PcRel) {
+    *p++ = (uint8_t) (pc - next_pc);
+  }
+  else if ((tag & trc_PcMask) == trc_PcAbs) {
+    put16(p, pc);
+    p += 2;
+  }
+  if (len <= 4) {
+    /* there is always room for four */
+    memcpy(p, op, 4);
+  }
+  else {
+    *p++ = (uint8_t) len;
+    memcpy(p, run, (size_t) len);
+  }
+  p += len;
+  if (mask != 0) {
+    *p++ = (uint8_t) mask;
+    if (mask & trc_Ext) *p++ = (uint8_t) (mask >> 8);
+    p = putRegs(p, &now, mask & ~trc_Ext);
+  }
+
+  trace->used = (size_t) (p - curBlock(trace));
+  trace->next_pc = (uint16_t) (pc + len);
+  trace->pc_known = 1;
+  trace->block_steps++;
+  trace->steps++;
+}
+
+void z80_trace_step(Z80_Trace* trace, const Z80_CPU* cpu) {
+  /* as z80_cpu_step() decides between an interrupt and the next opcode */
+  if ((cpu->nmi || (cpu->irq && cpu->iff1)) && !cpu->ei_shadow) {
+    record(trace, cpu, 0, trc_Int);
+  }
+  else {
+    record(trace, cpu, !cpu->halted, 0);
+  }
+}
+
+int z80_trace_finish(Z80_Trace* trace, const Z80_CPU* cpu) {
+  record(trace, cpu, 0, 0);
+  endBlock(trace);
+  return trace->error ? -1 : 0;
+}
+
+int z80_trace_save(const Z80_Trace* trace, int fd) {
+  size_t slot = (trace->cur + trace->nblocks - trace->held) % trace->nblocks;
+  if (writeHeader(fd) != 0) return -1;
+  for (size_t i = 0; i < trace->held; i++) {
+    const uint8_t* block = trace->ring + slot * Z80_TRACE_BLOCK;
+    if (writeAll(fd, block, get32(block)) != 0) return -1;
+    slot = (slot + 1) % trace->nblocks;
+  }
+  return 0;
+}
+
+int z80_trace_open(Z80_TraceReader* reader, const char* path) {
+  struct stat st;
+  void* map;
+  int fd;
+
+  memset(reader, 0, sizeof(*reader));
+  fd = open(path, O_RDONLY);
+  if (fd < 0) return -1;
+  if (fstat(fd, &st) != 0) {
+    close(fd);
+    return -1;
+  }
+  if (st.st_size < Z80_TRACE_HEADER) {
+    close(fd);
+    errno = EINVAL;
+    return -1;
+  }
+  map = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED) return -1;
+  madvise(map, (size_t) st.st_size, MADV_SEQUENTIAL);
+
+  reader->map = (const uint8_t*) map;
+  reader->size = (size_t) st.st_size;
+  reader->block_size = get32(reader->map + 10);
+  /* version 1 lacks only trc_LenLong, so reads as it is */
+  if (memcmp(reader->map, s_magic, sizeof(s_magic)) != 0 ||
+      get16(reader->map + 8) == 0 || get16(reader->map + 8) > Z80_TRACE_VERSION) {
+    z80_trace_close(reader);
+    errno = EINVAL;
+    return -1;
+  }
+  reader->next_block = reader->map + Z80_TRACE_HEADER;
+  return 0;
+}
+
+void z80_trace_close(Z80_TraceReader* reader) {
+  if (reader->map != NULL) munmap((void*) reader->map, reader->size);
+  reader->map = NULL;
+}
+
+/* moves to the next block; returns 0 at the end of the file */
+static int nextBlock(Z80_TraceReader* reader) {
+  const uint8_t* block = reader->next_block;
+  size_t left = reader->size - (size_t) (block - reader->map);
+  uint32_t len;
+
+  if (left == 0) return 0;
+  if (left < Z80_TRACE_BLOCK_HEADER) return -1;
+  len = get32(block);
+  if (len < Z80_TRACE_BLOCK_HEADER || len > left || len > reader->block_size) {
+    return -1;
+  }
+  reader->end = block + len;
+  reader->p = getRegs(block + Z80_TRACE_BLOCK_HEADER, reader->end,
+      &reader->regs, ALL_REGS);
+  if (reader->p == NULL) return -1;
+  reader->left = get32(block + 4);
+  reader->index = get32(block + 8) | (uint64_t) get32(block + 12) << 32;
+  reader->next_block = reader->end;
+  return 1;
+}
+
+int z80_trace_next(Z80_TraceReader* reader, Z80_TraceStep* step) {
+  const uint8_t* p;
+  const uint8_t* end;
+  unsigned mask = 0;
+  uint16_t pc;
+  uint8_t tag;
+  int len;
+
+  while (reader->left == 0) {
+    int rc = nextBlock(reader);
+    if (rc <= 0) return rc;
+  }
+  p = reader->p;
+  end = reader->end;
+  if (p == end) return -1;
+  tag = *p++;
+  len = tag & trc_LenMask;
+  if ((len > 4 && len != trc_LenLong) || (tag & trc_Reserved) != 0) return -1;
+  switch (tag & trc_PcMask) {
+    case trc_PcNext:
+      pc = reader->next_pc;
+      break;
+    case trc_PcRel:
+      if (p == end) return -1;
+      pc = (uint16_t) (reader->next_pc + (int8_t) *p++);
+      break;
+    case trc_PcAbs:
+      if (end - p < 2) return -1;
+      pc = get16(p);
+      p += 2;
+      break;
+    default:
+      return -1;
+  }
+  if (len == trc_LenLong) {
+    if (p == end || *p <= 4) return -1;
+    len = *p++;
+  }
+  if (end - p < len) return -1;
+  step->bytes = p;
+  p += len;
+  if (tag & trc_Regs) {
+    if (p == end) return -1;
+    mask = *p++;
+    if (mask & trc_Ext) {
+      if (p == end) return -1;
+      mask = (mask & ~trc_Ext) | (unsigned) *p++ << 8;
+    }
+    p = getRegs(p, end, &reader->regs, mask);
+    if (p == NULL) return -1;
+  }
+
+  step->index = reader->index++;
+  step->pc = pc;
+  step->len = (uint8_t) len;
+  step->interrupt = (tag & trc_Int) != 0;
+  step->changed = (uint16_t) mask;
+  step->regs = reader->regs;
+  reader->next_pc = (uint16_t) (pc + len);
+  reader->left--;
+  reader->p = p;
+  return 1;
+}
+
+int z80_trace_seek(Z80_TraceReader* reader, uint64_t index) {
+  Z80_TraceStep step;
+  reader->next_block = reader->map + Z80_TRACE_HEADER;
+  reader->left = 0;
+  /* whole blocks are skipped by their headers; each starts with a keyframe */
+  do {
+    int rc = nextBlock(reader);
+    if (rc <= 0) return rc;
+  } while (index >= reader->index + reader->left);
+  while (reader->index < index) {
+    int rc = z80_trace_next(reader, &step);
+    if (rc <= 0) return rc;
+  }
+  return 1;
+}
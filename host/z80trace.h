@@ -0,0 +1,192 @@
+#ifndef z80trace_h
+#define z80trace_h
+
+#include <stddef.h>
+
+#include "z80emu.h"
+
+/*
+ * A compact binary execution trace. A trace file is a 16-byte header
+ * ("Z80TRACE", a 16-bit version and the 32-bit block size, little endian)
+ * followed by blocks of at most Z80_TRACE_BLOCK bytes. Each block starts
+ * with its length, step count and the index of its first step, then a
+ * keyframe holding every register, so that it can be read on its own.
+ * Records follow, one per step, each describing the instruction about to
+ * execute and the registers it sees:
+ *
+ *   tag      bits 0-2: instruction length, 0 if the step fetched none,
+ *                      or trc_LenLong for a longer one
+ *            bits 3-4: trc_PcNext, trc_PcRel (8-bit offset from the next
+ *                      address) or trc_PcAbs (16-bit address)
+ *            bit 5:    a register mask follows
+ *            bit 6:    the step accepted an interrupt
+ *   pc       0, 1 or 2 bytes as the tag says
+ *   count    with trc_LenLong only, the instruction length, 5 to
+ *            Z80_TRACE_MAX_BYTES
+ *   bytes    the instruction's bytes
+ *   mask     trc_AF..trc_SP, with trc_Ext if a second mask byte of
+ *            trc_AF_..trc_Misc follows
+ *   values   the new value of each register in the masks, in bit order:
+ *            16 bits for a pair, 8 for I and for Misc
+ *
+ * A step without an instruction is a halted CPU's NOP (Misc has
+ * trc_Halted), an interrupt or, last in the trace, the final registers. R
+ * is not recorded; it counts opcode fetches and can be rebuilt from them.
+ * Misc packs IFF1, IFF2, the interrupt mode and the halt state.
+ *
+ * Only runs of redundant DD/FD prefixes, which the CPU executes as one
+ * step, make an instruction longer than four bytes. A run longer than
+ * Z80_TRACE_MAX_BYTES is cut to its first Z80_TRACE_MAX_BYTES bytes, and
+ * the step after it then records its PC.
+ */
+#define Z80_TRACE_VERSION 2
+#define Z80_TRACE_BLOCK 65536
+#define Z80_TRACE_HEADER 16
+#define Z80_TRACE_BLOCK_HEADER 16
+#define Z80_TRACE_MAX_BYTES 255
+#define Z80_TRACE_MAX_RECORD 288
+
+typedef enum {
+  trc_PcNext = 0x00,
+  trc_PcRel = 0x08,
+  trc_PcAbs = 0x10,
+  trc_PcMask = 0x18,
+  trc_Regs = 0x20,
+  trc_Int = 0x40,
+  trc_Reserved = 0x80,
+  trc_LenMask = 0x07,
+  trc_LenLong = 0x07
+} Z80_TraceTag;
+
+/* register mask bits; the second mask byte's bits are shifted up by 8 */
+typedef enum {
+  trc_AF = 0x0001,
+  trc_BC = 0x0002,
+  trc_DE = 0x0004,
+  trc_HL = 0x0008,
+  trc_IX = 0x0010,
+  trc_IY = 0x0020,
+  trc_SP = 0x0040,
+  trc_Ext = 0x0080,
+  trc_AF_ = 0x0100,
+  trc_BC_ = 0x0200,
+  trc_DE_ = 0x0400,
+  trc_HL_ = 0x0800,
+  trc_I = 0x1000,
+  trc_Misc = 0x2000
+} Z80_TraceReg;
+
+/* bits of Misc, r[13] of Z80_TraceRegs */
+typedef enum {
+  trc_Iff1 = 0x01,
+  trc_Iff2 = 0x02,
+  trc_ImShift = 2,
+  trc_Halted = 0x10
+} Z80_TraceMisc;
+
+/*
+ * The recorded registers, indexed in mask bit order: r[0] is AF. r[7],
+ * for trc_Ext, and the last two pad to four 64-bit words and are unused.
+ */
+typedef struct {
+  uint16_t r[16];
+} Z80_TraceRegs;
+
+/*
+ * Capture state. Records are built in a ring of nblocks blocks. With an
+ * fd, each block is written out as it fills and the ring only buffers;
+ * without one, filling a block drops the oldest once the ring is full,
+ * keeping the most recent steps for z80_trace_save().
+ */
+typedef struct {
+  uint8_t* ring;
+  size_t nblocks;
+  size_t cur;
+  size_t held;
+  size_t used;
+  uint32_t block_steps;
+  int fd;
+  int error;
+  int pc_known;
+  uint16_t next_pc;
+  uint64_t steps;
+  uint64_t bytes;
+  Z80_TraceRegs regs;
+} Z80_Trace;
+
+/* One step read back from a trace. bytes points into the mapped file. */
+typedef struct {
+  uint64_t index;
+  uint16_t pc;
+  uint8_t len;
+  uint8_t interrupt;
+  const uint8_t* bytes;
+  uint16_t changed;
+  Z80_TraceRegs regs;
+} Z80_TraceStep;
+
+typedef struct {
+  const uint8_t* map;
+  size_t size;
+  const uint8_t* next_block;
+  const uint8_t* p;
+  const uint8_t* end;
+  uint32_t block_size;
+  uint32_t left;
+  uint64_t index;
+  uint16_t next_pc;
+  Z80_TraceRegs regs;
+} Z80_TraceReader;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+ * Allocates a ring of nblocks blocks (at least one). With fd >= 0, writes
+ * the file header there and streams blocks to it. Returns -1 if memory is
+ * exhausted or the write fails.
+ */
+int z80_trace_init(Z80_Trace* trace, size_t nblocks, int fd);
+
+void z80_trace_free(Z80_Trace* trace);
+
+/*
+ * Records the step cpu is about to take: call it before each
+ * z80_cpu_step(), with the registers as the previous step left them.
+ */
+void z80_trace_step(Z80_Trace* trace, const Z80_CPU* cpu);
+
+/*
+ * Records cpu's final registers as a step without an instruction and
+ * completes the last block, writing it out when streaming. Returns -1 if
+ * any write failed.
+ */
+int z80_trace_finish(Z80_Trace* trace, const Z80_CPU* cpu);
+
+/* Writes the header and the blocks held in the ring, oldest first, to fd. */
+int z80_trace_save(const Z80_Trace* trace, int fd);
+
+/* Maps the trace file at path. Returns -1 with errno set on failure. */
+int z80_trace_open(Z80_TraceReader* reader, const char* path);
+
+void z80_trace_close(Z80_TraceReader* reader);
+
+/*
+ * Reads the next step into step. Returns 1, 0 at the end of the trace or
+ * -1 if the file is malformed.
+ */
+int z80_trace_next(Z80_TraceReader* reader, Z80_TraceStep* step);
+
+/*
+ * Positions reader so that the next step read is the one numbered index,
+ * or the first in the trace if that comes later. Returns 1, 0 if the
+ * trace ends first or -1 if the file is malformed.
+ */
+int z80_trace_seek(Z80_TraceReader* reader, uint64_t index);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80trace_h */
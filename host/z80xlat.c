@@ -0,0 +1,1068 @@
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "z80dasm.h"
+#include "z80xlat.h"
+#include "z80core.h"
+
+/* the furthest a block reaches: Z80_XLAT_MAX_OPS instructions of 4 bytes */
+#define MAX_BYTES (Z80_XLAT_MAX_OPS * 4)
+
+/* where the last instruction a block decodes may start, so as to stay in memory */
+#define LAST_START (Z80_MEM_SIZE - 4)
+
+/* handler addresses are taken once and must not differ between copies */
+#if defined(__clang__)
+#define NOINLINE __attribute__((noinline))
+#else
+#define NOINLINE __attribute__((noinline, noclone))
+#endif
+
+#define R8(off) (((uint8_t*) cpu)[off])
+#define R16(off) (*(uint16_t*) ((uint8_t*) cpu + (off)))
+
+/* the handlers; those from xk_Jp on end a block */
+typedef enum {
+  xk_Nop,
+  xk_LdRR,
+  xk_LdRN,
+  xk_LdRM,
+  xk_LdMR,
+  xk_LdMN,
+  xk_LdAExt,
+  xk_LdExtA,
+  xk_LdPN,
+  xk_LdPExt,
+  xk_LdExtP,
+  xk_LdPP,
+  xk_AluR,
+  xk_AluN = xk_AluR + 8,
+  xk_AluM = xk_AluN + 8,
+  /* ADD to OR without flags, for when nothing sees them */
+  xk_AluRNf = xk_AluM + 8,
+  xk_AluNNf = xk_AluRNf + 7,
+  xk_AluMNf = xk_AluNNf + 7,
+  xk_Inc8 = xk_AluMNf + 7,
+  xk_Dec8,
+  xk_Inc8Nf,
+  xk_Dec8Nf,
+  xk_IncM,
+  xk_DecM,
+  xk_Inc16,
+  xk_Dec16,
+  xk_Add16,
+  xk_Push,
+  xk_Pop,
+  xk_ExDeHl,
+  xk_ExAf,
+  xk_Exx,
+  xk_ExSp,
+  xk_Rlca,
+  xk_Rrca,
+  xk_Rla,
+  xk_Rra,
+  xk_Cpl,
+  xk_Scf,
+  xk_Ccf,
+  xk_Daa,
+  xk_Di,
+  xk_RotR,
+  xk_RotM,
+  xk_BitR,
+  xk_BitM,
+  xk_ResR,
+  xk_ResM,
+  xk_SetR,
+  xk_SetM,
+  xk_Step,
+  xk_Jp,
+  xk_JpCc,
+  xk_JpInd,
+  xk_Djnz,
+  xk_Call,
+  xk_CallCc,
+  xk_Ret,
+  xk_RetCc,
+  xk_Rst,
+  xk_Halt,
+  xk_OutNA,
+  xk_InAN,
+  xk_Exit,
+  xk_Count
+} XKind;
+
+/*
+ * One translated instruction. a and b are registers as offsets into
+ * Z80_CPU, a memory operand being at b's value plus d; nn is an
+ * immediate, address or branch target and n a condition, bit mask or
+ * operation. t_end and r_end count T-states and opcode fetches from the
+ * start of the block to the end of the instruction, not branching.
+ */
+typedef struct {
+  const void* handler;
+  uint16_t nn;
+  uint16_t next;
+  uint16_t t_end;
+  uint8_t r_end;
+  uint8_t t_self;
+  uint8_t r_self;
+  uint8_t t_taken;
+  uint8_t a;
+  uint8_t b;
+  uint8_t n;
+  int8_t d;
+} XOp;
+
+/*
+ * A translated block and a copy of the bytes it came from. lead is the
+ * T-states before its last instruction starts.
+ */
+struct Z80_Block {
+  uint16_t start;
+  uint16_t len;
+  uint16_t lead;
+  uint16_t count;
+  const uint8_t* bytes;
+  XOp ops[];
+};
+
+static const void* const* s_handlers;
+
+/* Z80_CPU offsets of reg_A..reg_L and of reg_AF..reg_IY */
+static const uint8_t s_reg8[7] = {
+  offsetof(Z80_CPU, af.b.h), offsetof(Z80_CPU, bc.b.h),
+  offsetof(Z80_CPU, bc.b.l), offsetof(Z80_CPU, de.b.h),
+  offsetof(Z80_CPU, de.b.l), offsetof(Z80_CPU, hl.b.h),
+  offsetof(Z80_CPU, hl.b.l)
+};
+
+static const uint8_t s_reg16[7] = {
+  offsetof(Z80_CPU, af), offsetof(Z80_CPU, bc), offsetof(Z80_CPU, de),
+  offsetof(Z80_CPU, hl), offsetof(Z80_CPU, sp), offsetof(Z80_CPU, ix),
+  offsetof(Z80_CPU, iy)
+};
+
+/* writes by a block; one to translated code ends the block after it */
+static inline void xwr(Z80_Xlat* x, Z80_CPU* cpu, uint16_t addr, uint8_t v) {
+  cpu->mem[addr] = v;
+  if (x->cover[addr] != 0) {
+    z80_xlat_touch(x, addr);
+    x->hit = 1;
+  }
+}
+
+static inline void xwr16(Z80_Xlat* x, Z80_CPU* cpu, uint16_t addr, uint16_t v) {
+  xwr(x, cpu, addr, (uint8_t) v);
+  xwr(x, cpu, (uint16_t) (addr + 1), (uint8_t) (v >> 8));
+}
+
+static inline void xpush(Z80_Xlat* x, Z80_CPU* cpu, uint16_t v) {
+  cpu->sp.w -= 2;
+  xwr16(x, cpu, cpu->sp.w, v);
+}
+
+static inline uint16_t xpop(Z80_CPU* cpu) {
+  uint16_t v = rd16(cpu, cpu->sp.w);
+  cpu->sp.w += 2;
+  return v;
+}
+
+/* ALU operation k, but CP, on A without setting the flags */
+static inline void aluResult(Z80_CPU* cpu, int k, uint8_t v) {
+  switch (k) {
+    case 0:
+      A += v;
+      break;
+    case 1:
+      A += v + (F & zf_C);
+      break;
+    case 2:
+      A -= v;
+      break;
+    case 3:
+      A -= v + (F & zf_C);
+      break;
+    case 4:
+      A &= v;
+      break;
+    case 5:
+      A ^= v;
+      break;
+    default:
+      A |= v;
+      break;
+  }
+}
+
+/* true if a page has been written since translated code was last checked */
+static inline int anyDirty(const Z80_Xlat* x) {
+  uint64_t dirty = 0;
+  for (size_t i = 0; i < sizeof(x->dirty); i += sizeof(dirty)) {
+    uint64_t v;
+    memcpy(&v, x->dirty + i, sizeof(v));
+    dirty |= v;
+  }
+  return dirty != 0;
+}
+
+/*
+ * Runs block, leaving PC, R and the cycle count as the interpreter would
+ * after its last instruction. A branch goes straight on into the block at
+ * its target, if translated and to be run whole: nothing a block does
+ * without a callback can raise an interrupt or move run_end, and after a
+ * callback it goes on only if none was raised. Called with
+ * a NULL block, publishes the handler addresses in s_handlers instead.
+ */
+static NOINLINE void execBlock(Z80_Xlat* x, Z80_CPU* cpu, const Z80_Block* block) {
+#define ALU_LABELS(k) [xk_AluR + k] = &&alu_r##k, [xk_AluN + k] = &&alu_n##k, \
+    [xk_AluM + k] = &&alu_m##k
+#define NF_LABELS(k) [xk_AluRNf + k] = &&alu_rnf##k, \
+    [xk_AluNNf + k] = &&alu_nnf##k, [xk_AluMNf + k] = &&alu_mnf##k
+  static const void* const handlers[xk_Count] = {
+    [xk_Nop] = &&nop, [xk_LdRR] = &&ld_rr, [xk_LdRN] = &&ld_rn,
+    [xk_LdRM] = &&ld_rm, [xk_LdMR] = &&ld_mr, [xk_LdMN] = &&ld_mn,
+    [xk_LdAExt] = &&ld_aext, [xk_LdExtA] = &&ld_exta, [xk_LdPN] = &&ld_pn,
+    [xk_LdPExt] = &&ld_pext, [xk_LdExtP] = &&ld_extp, [xk_LdPP] = &&ld_pp,
+    ALU_LABELS(0), ALU_LABELS(1), ALU_LABELS(2), ALU_LABELS(3),
+    ALU_LABELS(4), ALU_LABELS(5), ALU_LABELS(6), ALU_LABELS(7),
+    NF_LABELS(0), NF_LABELS(1), NF_LABELS(2), NF_LABELS(3), NF_LABELS(4),
+    NF_LABELS(5), NF_LABELS(6),
+    [xk_Inc8] = &&inc_r, [xk_Dec8] = &&dec_r, [xk_Inc8Nf] = &&inc_rnf,
+    [xk_Dec8Nf] = &&dec_rnf, [xk_IncM] = &&inc_m,
+    [xk_DecM] = &&dec_m, [xk_Inc16] = &&inc_p, [xk_Dec16] = &&dec_p,
+    [xk_Add16] = &&add_p, [xk_Push] = &&push, [xk_Pop] = &&pop,
+    [xk_ExDeHl] = &&ex_dehl, [xk_ExAf] = &&ex_af, [xk_Exx] = &&exx,
+    [xk_ExSp] = &&ex_sp, [xk_Rlca] = &&rlca, [xk_Rrca] = &&rrca,
+    [xk_Rla] = &&rla, [xk_Rra] = &&rra, [xk_Cpl] = &&cpl, [xk_Scf] = &&scf,
+    [xk_Ccf] = &&ccf, [xk_Daa] = &&daa, [xk_Di] = &&di,
+    [xk_RotR] = &&rot_r, [xk_RotM] = &&rot_m, [xk_BitR] = &&bit_r,
+    [xk_BitM] = &&bit_m, [xk_ResR] = &&res_r, [xk_ResM] = &&res_m,
+    [xk_SetR] = &&set_r, [xk_SetM] = &&set_m, [xk_Step] = &&step,
+    [xk_Jp] = &&jp, [xk_JpCc] = &&jp_cc, [xk_JpInd] = &&jp_ind,
+    [xk_Djnz] = &&djnz, [xk_Call] = &&call, [xk_CallCc] = &&call_cc,
+    [xk_Ret] = &&ret, [xk_RetCc] = &&ret_cc, [xk_Rst] = &&rst,
+    [xk_Halt] = &&halt, [xk_OutNA] = &&out_na, [xk_InAN] = &&in_an,
+    [xk_Exit] = &&exit
+  };
+#undef ALU_LABELS
+#undef NF_LABELS
+  const XOp* op;
+  uint64_t base;
+  uint16_t pc;
+  uint8_t r0;
+
+  if (block == NULL) {
+    s_handlers = handlers;
+    return;
+  }
+  op = block->ops;
+  base = cpu->cycles;
+  r0 = cpu->r;
+  x->hit = 0;
+
+#define NEXT goto *(++op)->handler
+#define ADDR ((uint16_t) (R16(op->b) + op->d))
+#define EXIT(to, taken) do { \
+    cpu->pc = (to); \
+    cpu->cycles = base + op->t_end + (taken); \
+    cpu->r = (uint8_t) (r0 + op->r_end); \
+    return; \
+  } while (0)
+#define CHAIN(to, taken) do { \
+    pc = (to); \
+    base += op->t_end + (taken); \
+    r0 = (uint8_t) (r0 + op->r_end); \
+    goto chain; \
+  } while (0)
+#define WROTE do { \
+    if (x->hit) EXIT(op->next, 0); \
+    NEXT; \
+  } while (0)
+#define ALU_HANDLERS(k) \
+  alu_r##k: alu(cpu, k, R8(op->b)); NEXT; \
+  alu_n##k: alu(cpu, k, (uint8_t) op->nn); NEXT; \
+  alu_m##k: alu(cpu, k, rd(cpu, ADDR)); NEXT;
+#define NF_HANDLERS(k) \
+  alu_rnf##k: aluResult(cpu, k, R8(op->b)); NEXT; \
+  alu_nnf##k: aluResult(cpu, k, (uint8_t) op->nn); NEXT; \
+  alu_mnf##k: aluResult(cpu, k, rd(cpu, ADDR)); NEXT;
+
+  goto *op->handler;
+
+nop:
+  NEXT;
+ld_rr:
+  R8(op->a) = R8(op->b);
+  NEXT;
+ld_rn:
+  R8(op->a) = (uint8_t) op->nn;
+  NEXT;
+ld_rm:
+  R8(op->a) = rd(cpu, ADDR);
+  NEXT;
+ld_mr:
+  xwr(x, cpu, ADDR, R8(op->a));
+  WROTE;
+ld_mn:
+  xwr(x, cpu, ADDR, (uint8_t) op->nn);
+  WROTE;
+ld_aext:
+  A = rd(cpu, op->nn);
+  NEXT;
+ld_exta:
+  xwr(x, cpu, op->nn, A);
+  WROTE;
+ld_pn:
+  R16(op->a) = op->nn;
+  NEXT;
+ld_pext:
+  R16(op->a) = rd16(cpu, op->nn);
+  NEXT;
+ld_extp:
+  xwr16(x, cpu, op->nn, R16(op->a));
+  WROTE;
+ld_pp:
+  R16(op->a) = R16(op->b);
+  NEXT;
+  ALU_HANDLERS(0)
+  ALU_HANDLERS(1)
+  ALU_HANDLERS(2)
+  ALU_HANDLERS(3)
+  ALU_HANDLERS(4)
+  ALU_HANDLERS(5)
+  ALU_HANDLERS(6)
+  ALU_HANDLERS(7)
+  NF_HANDLERS(0)
+  NF_HANDLERS(1)
+  NF_HANDLERS(2)
+  NF_HANDLERS(3)
+  NF_HANDLERS(4)
+  NF_HANDLERS(5)
+  NF_HANDLERS(6)
+inc_r:
+  R8(op->a) = inc8(cpu, R8(op->a));
+  NEXT;
+dec_r:
+  R8(op->a) = dec8(cpu, R8(op->a));
+  NEXT;
+inc_rnf:
+  R8(op->a)++;
+  NEXT;
+dec_rnf:
+  R8(op->a)--;
+  NEXT;
+inc_m: {
+    uint16_t addr = ADDR;
+    xwr(x, cpu, addr, inc8(cpu, rd(cpu, addr)));
+  }
+  WROTE;
+dec_m: {
+    uint16_t addr = ADDR;
+    xwr(x, cpu, addr, dec8(cpu, rd(cpu, addr)));
+  }
+  WROTE;
+inc_p:
+  R16(op->a)++;
+  NEXT;
+dec_p:
+  R16(op->a)--;
+  NEXT;
+add_p:
+  R16(op->a) = add16(cpu, R16(op->a), R16(op->b));
+  NEXT;
+push:
+  xpush(x, cpu, R16(op->a));
+  WROTE;
+pop:
+  R16(op->a) = xpop(cpu);
+  NEXT;
+ex_dehl: {
+    uint16_t v = cpu->de.w;
+    cpu->de.w = cpu->hl.w;
+    cpu->hl.w = v;
+  }
+  NEXT;
+ex_af: {
+    uint16_t v = cpu->af.w;
+    cpu->af.w = cpu->af_.w;
+    cpu->af_.w = v;
+  }
+  NEXT;
+exx: {
+    uint16_t v;
+    v = cpu->bc.w; cpu->bc.w = cpu->bc_.w; cpu->bc_.w = v;
+    v = cpu->de.w; cpu->de.w = cpu->de_.w; cpu->de_.w = v;
+    v = cpu->hl.w; cpu->hl.w = cpu->hl_.w; cpu->hl_.w = v;
+  }
+  NEXT;
+ex_sp: {
+    uint16_t v = rd16(cpu, cpu->sp.w);
+    xwr16(x, cpu, cpu->sp.w, R16(op->a));
+    R16(op->a) = v;
+  }
+  WROTE;
+rlca:
+  rotateA(cpu, 0);
+  NEXT;
+rrca:
+  rotateA(cpu, 1);
+  NEXT;
+rla:
+  rotateA(cpu, 2);
+  NEXT;
+rra:
+  rotateA(cpu, 3);
+  NEXT;
+cpl:
+  cpl(cpu);
+  NEXT;
+scf:
+  scf(cpu);
+  NEXT;
+ccf:
+  ccf(cpu);
+  NEXT;
+daa:
+  daa(cpu);
+  NEXT;
+di:
+  cpu->iff1 = cpu->iff2 = 0;
+  NEXT;
+rot_r:
+  R8(op->a) = rotate(cpu, op->n, R8(op->a));
+  NEXT;
+rot_m: {
+    uint16_t addr = ADDR;
+    xwr(x, cpu, addr, rotate(cpu, op->n, rd(cpu, addr)));
+  }
+  WROTE;
+bit_r:
+  bit(cpu, op->n, R8(op->a), R8(op->a));
+  NEXT;
+bit_m: {
+    uint16_t addr = ADDR;
+    bit(cpu, op->n, rd(cpu, addr), (uint8_t) (addr >> 8));
+  }
+  NEXT;
+res_r:
+  R8(op->a) &= ~op->n;
+  NEXT;
+res_m: {
+    uint16_t addr = ADDR;
+    xwr(x, cpu, addr, rd(cpu, addr) & ~op->n);
+  }
+  WROTE;
+set_r:
+  R8(op->a) |= op->n;
+  NEXT;
+set_m: {
+    uint16_t addr = ADDR;
+    xwr(x, cpu, addr, rd(cpu, addr) | op->n);
+  }
+  WROTE;
+step:
+  /* the interpreter runs it; n is set if the block must end after it */
+  cpu->pc = op->nn;
+  cpu->cycles = base + op->t_end - op->t_self;
+  cpu->r = (uint8_t) (r0 + op->r_end - op->r_self);
+  z80_cpu_step(cpu);
+  x->steps++;
+  if (op->n || cpu->pc != op->next || anyDirty(x)) goto resume;
+  base = cpu->cycles - op->t_end;
+  r0 = (uint8_t) (cpu->r - op->r_end);
+  NEXT;
+jp:
+  CHAIN(op->nn, 0);
+jp_cc:
+  if (condition(cpu, op->n)) CHAIN(op->nn, op->t_taken);
+  CHAIN(op->next, 0);
+jp_ind:
+  CHAIN(R16(op->a), 0);
+djnz:
+  if (--B != 0) CHAIN(op->nn, op->t_taken);
+  CHAIN(op->next, 0);
+call:
+  xpush(x, cpu, op->next);
+  if (x->hit) EXIT(op->nn, 0);
+  CHAIN(op->nn, 0);
+call_cc:
+  if (condition(cpu, op->n)) {
+    xpush(x, cpu, op->next);
+    if (x->hit) EXIT(op->nn, op->t_taken);
+    CHAIN(op->nn, op->t_taken);
+  }
+  CHAIN(op->next, 0);
+ret:
+  CHAIN(xpop(cpu), 0);
+ret_cc:
+  if (condition(cpu, op->n)) CHAIN(xpop(cpu), op->t_taken);
+  CHAIN(op->next, 0);
+rst:
+  /* callbacks see the state the interpreter would give them */
+  cpu->pc = op->next;
+  cpu->cycles = base + op->t_end - op->t_self;
+  cpu->r = (uint8_t) (r0 + op->r_end);
+  if (cpu->rst_trap == NULL ||
+      !cpu->rst_trap(cpu->trap_ctx, cpu, (uint8_t) op->nn)) {
+    xpush(x, cpu, cpu->pc);
+    cpu->pc = op->nn;
+  }
+  cpu->cycles += op->t_self;
+  goto resume;
+halt:
+  cpu->halted = 1;
+  EXIT(op->next, 0);
+out_na:
+  cpu->pc = op->next;
+  cpu->cycles = base + op->t_end - op->t_self;
+  cpu->r = (uint8_t) (r0 + op->r_end);
+  out(cpu, (uint16_t) (A << 8 | op->nn), A);
+  cpu->cycles += op->t_self;
+  goto resume;
+in_an:
+  cpu->pc = op->next;
+  cpu->cycles = base + op->t_end - op->t_self;
+  cpu->r = (uint8_t) (r0 + op->r_end);
+  A = in(cpu, (uint16_t) (A << 8 | op->nn));
+  cpu->cycles += op->t_self;
+  goto resume;
+exit:
+  CHAIN(op->nn, 0);
+
+resume:
+  /* with the CPU state written back, as a callback or the interpreter left it */
+  if (cpu->nmi || (cpu->irq && cpu->iff1) || cpu->halted || cpu->ei_shadow ||
+      anyDirty(x)) {
+    return;
+  }
+  pc = cpu->pc;
+  base = cpu->cycles;
+  r0 = cpu->r;
+chain:
+  if (base < cpu->run_end && pc <= LAST_START) {
+    block = x->blocks[pc];
+    if (block != NULL && base + block->lead < cpu->run_end) {
+      x->runs++;
+      op = block->ops;
+      goto *op->handler;
+    }
+  }
+  cpu->pc = pc;
+  cpu->cycles = base;
+  cpu->r = r0;
+  return;
+
+#undef NEXT
+#undef ADDR
+#undef EXIT
+#undef CHAIN
+#undef WROTE
+#undef ALU_HANDLERS
+#undef NF_HANDLERS
+}
+
+/* the offset of an 8-bit register operand, or -1 */
+static int reg8(const Z80_Arg* arg) {
+  return arg->flags == am_Register && arg->v <= reg_L ? s_reg8[arg->v] : -1;
+}
+
+/* the offset of a register pair operand, or -1 */
+static int reg16(const Z80_Arg* arg) {
+  return arg->flags == am_Register && arg->v >= reg_AF && arg->v <= reg_IY
+      ? s_reg16[arg->v - reg_AF] : -1;
+}
+
+/* for a (rr) or (IX+d) operand, sets op's b and d and returns 1 */
+static int memory(XOp* op, const Z80_Arg* arg) {
+  if ((arg->flags & ~am_Indexed) != (am_Register | am_Indirect) ||
+      arg->v < reg_AF || arg->v > reg_IY) {
+    return 0;
+  }
+  op->b = s_reg16[arg->v - reg_AF];
+  op->d = (arg->flags & am_Indexed) != 0 ? (int8_t) arg->displacement : 0;
+  return 1;
+}
+
+static int isExtended(const Z80_Arg* arg) {
+  return arg->flags == (am_Immediate | am_Extended | am_Indirect);
+}
+
+/* the condition code of a flag operand, 0-7 as in the opcodes */
+static int cc(const Z80_Arg* arg) {
+  return arg->v - fl_NZ;
+}
+
+/* the opcode fetches (M1 cycles) of the instruction at p */
+static int fetches(const uint8_t* p) {
+  int n = 1;
+  if (*p == 0xdd || *p == 0xfd) {
+    n++;
+    p++;
+  }
+  if (*p == 0xed || (*p == 0xcb && n == 1)) n++;
+  return n;
+}
+
+static int aluIndex(Z80_Operation operation) {
+  switch (operation) {
+    case op_ADD: return 0;
+    case op_ADC: return 1;
+    case op_SUB: return 2;
+    case op_SBC: return 3;
+    case op_AND: return 4;
+    case op_XOR: return 5;
+    case op_OR: return 6;
+    default: return 7;
+  }
+}
+
+static int rotateIndex(Z80_Operation operation) {
+  switch (operation) {
+    case op_RLC: return 0;
+    case op_RRC: return 1;
+    case op_RL: return 2;
+    case op_RR: return 3;
+    case op_SLA: return 4;
+    case op_SRA: return 5;
+    default: return 7;
+  }
+}
+
+/*
+ * Chooses the handler for the instruction o, decoded from p, and fills in
+ * op's operands. Anything unusual is left to the interpreter.
+ */
+static int classify(XOp* op, const Z80_OpCode* o, const uint8_t* p) {
+  const Z80_Arg* a0 = &o->args[0];
+  const Z80_Arg* a1 = &o->args[1];
+  const Z80_Arg* src = &o->args[o->argc > 0 ? o->argc - 1 : 0];
+
+  if (p[0] == 0xdd || p[0] == 0xfd) {
+    /* the decoder shows IXH and IXL as H and L */
+    for (int i = 0; i < o->argc; i++) {
+      if (o->args[i].flags == am_Register &&
+          (o->args[i].v == reg_H || o->args[i].v == reg_L)) {
+        return xk_Step;
+      }
+    }
+    /* DD CB d op also copies the result to a register unless op is (HL) */
+    if (p[1] == 0xcb && (p[3] & 7) != 6) return xk_Step;
+  }
+
+  switch (o->operation) {
+    case op_NOP:
+      return xk_Nop;
+    case op_LD:
+      if (reg8(a0) >= 0) {
+        op->a = (uint8_t) reg8(a0);
+        if (reg8(a1) >= 0) {
+          op->b = (uint8_t) reg8(a1);
+          return xk_LdRR;
+        }
+        if (a1->flags == am_Immediate) {
+          op->nn = a1->v;
+          return xk_LdRN;
+        }
+        if (memory(op, a1)) return xk_LdRM;
+        if (isExtended(a1)) {
+          op->nn = a1->v;
+          return xk_LdAExt;
+        }
+        return xk_Step;
+      }
+      if (memory(op, a0)) {
+        if (reg8(a1) >= 0) {
+          op->a = (uint8_t) reg8(a1);
+          return xk_LdMR;
+        }
+        op->nn = a1->v;
+        return xk_LdMN;
+      }
+      if (isExtended(a0)) {
+        op->nn = a0->v;
+        if (reg8(a1) >= 0) return xk_LdExtA;
+        if (reg16(a1) < 0) return xk_Step;
+        op->a = (uint8_t) reg16(a1);
+        return xk_LdExtP;
+      }
+      if (reg16(a0) >= 0) {
+        op->a = (uint8_t) reg16(a0);
+        if (isExtended(a1)) {
+          op->nn = a1->v;
+          return xk_LdPExt;
+        }
+        if (reg16(a1) >= 0) {
+          op->b = (uint8_t) reg16(a1);
+          return xk_LdPP;
+        }
+        op->nn = a1->v;
+        return xk_LdPN;
+      }
+      return xk_Step;
+    case op_ADD: case op_ADC: case op_SUB: case op_SBC:
+    case op_AND: case op_XOR: case op_OR: case op_CP:
+      if (reg16(a0) >= 0) {
+        if (o->operation != op_ADD || reg16(a1) < 0) return xk_Step;
+        op->a = (uint8_t) reg16(a0);
+        op->b = (uint8_t) reg16(a1);
+        return xk_Add16;
+      }
+      if (reg8(src) >= 0) {
+        op->b = (uint8_t) reg8(src);
+        return xk_AluR + aluIndex(o->operation);
+      }
+      if (memory(op, src)) return xk_AluM + aluIndex(o->operation);
+      op->nn = src->v;
+      return xk_AluN + aluIndex(o->operation);
+    case op_INC: case op_DEC: {
+      int inc = o->operation == op_INC;
+      if (reg8(a0) >= 0) {
+        op->a = (uint8_t) reg8(a0);
+        return inc ? xk_Inc8 : xk_Dec8;
+      }
+      if (memory(op, a0)) return inc ? xk_IncM : xk_DecM;
+      if (reg16(a0) < 0) return xk_Step;
+      op->a = (uint8_t) reg16(a0);
+      return inc ? xk_Inc16 : xk_Dec16;
+    }
+    case op_PUSH: case op_POP:
+      if (reg16(a0) < 0) return xk_Step;
+      op->a = (uint8_t) reg16(a0);
+      return o->operation == op_PUSH ? xk_Push : xk_Pop;
+    case op_EX:
+      if (a0->v == reg_DE) return xk_ExDeHl;
+      if (a0->v == reg_AF) return xk_ExAf;
+      if (reg16(a1) < 0) return xk_Step;
+      op->a = (uint8_t) reg16(a1);
+      return xk_ExSp;
+    case op_EXX:
+      return xk_Exx;
+    case op_RLCA:
+      return xk_Rlca;
+    case op_RRCA:
+      return xk_Rrca;
+    case op_RLA:
+      return xk_Rla;
+    case op_RRA:
+      return xk_Rra;
+    case op_CPL:
+      return xk_Cpl;
+    case op_SCF:
+      return xk_Scf;
+    case op_CCF:
+      return xk_Ccf;
+    case op_DAA:
+      return xk_Daa;
+    case op_DI:
+      return xk_Di;
+    case op_RLC: case op_RRC: case op_RL: case op_RR:
+    case op_SLA: case op_SRA: case op_SRL:
+      op->n = (uint8_t) rotateIndex(o->operation);
+      if (reg8(a0) >= 0) {
+        op->a = (uint8_t) reg8(a0);
+        return xk_RotR;
+      }
+      return memory(op, a0) ? xk_RotM : xk_Step;
+    case op_BIT: case op_RES: case op_SET: {
+      int kind = o->operation == op_BIT ? xk_BitR
+          : o->operation == op_RES ? xk_ResR : xk_SetR;
+      op->n = (uint8_t) (kind == xk_BitR ? a0->v : 1 << a0->v);
+      if (reg8(a1) >= 0) {
+        op->a = (uint8_t) reg8(a1);
+        return kind;
+      }
+      /* each memory form follows its register form */
+      return memory(op, a1) ? kind + 1 : xk_Step;
+    }
+    case op_JP:
+      if (o->argc == 2) {
+        op->n = (uint8_t) cc(a0);
+        op->nn = a1->v;
+        return xk_JpCc;
+      }
+      if (a0->flags & am_Indirect) {
+        if (!memory(op, a0)) return xk_Step;
+        op->a = op->b;
+        return xk_JpInd;
+      }
+      op->nn = a0->v;
+      return xk_Jp;
+    case op_JR:
+      op->nn = (uint16_t) (op->next + (int8_t) src->v);
+      if (o->argc == 2) {
+        op->n = (uint8_t) cc(a0);
+        return xk_JpCc;
+      }
+      return xk_Jp;
+    case op_DJNZ:
+      op->nn = (uint16_t) (op->next + (int8_t) a0->v);
+      return xk_Djnz;
+    case op_CALL:
+      op->nn = src->v;
+      if (o->argc == 2) {
+        op->n = (uint8_t) cc(a0);
+        return xk_CallCc;
+      }
+      return xk_Call;
+    case op_RET:
+      if (o->argc == 1) {
+        op->n = (uint8_t) cc(a0);
+        return xk_RetCc;
+      }
+      return xk_Ret;
+    case op_RST:
+      op->nn = a0->v;
+      return xk_Rst;
+    case op_HALT:
+      return xk_Halt;
+    case op_OUT:
+      if (a0->flags == am_Immediate) {
+        op->nn = a0->v;
+        return xk_OutNA;
+      }
+      op->n = 1;
+      return xk_Step;
+    case op_IN:
+      if (a1->flags == am_Immediate) {
+        op->nn = a1->v;
+        return xk_InAN;
+      }
+      op->n = 1;
+      return xk_Step;
+    /* I/O may change what the CPU must do next; EI delays interrupts */
+    case op_EI: case op_INI: case op_INIR: case op_IND: case op_INDR:
+    case op_OUTI: case op_OTIR: case op_OUTD: case op_OTDR:
+      op->n = 1;
+      return xk_Step;
+    default:
+      return xk_Step;
+  }
+}
+
+/* the flags an operation uses, all of them for those that may end a block */
+static unsigned flagsRead(int kind, const XOp* op) {
+  switch (kind) {
+    case xk_AluR + 1: case xk_AluN + 1: case xk_AluM + 1:
+    case xk_AluR + 3: case xk_AluN + 3: case xk_AluM + 3:
+    case xk_Rla: case xk_Rra: case xk_Ccf:
+      return zf_C;
+    case xk_RotR:
+      return op->n == 2 || op->n == 3 ? zf_C : 0;
+    case xk_Daa:
+      return zf_C | zf_H | zf_N;
+    case xk_Nop: case xk_LdRR: case xk_LdRN: case xk_LdRM: case xk_LdAExt:
+    case xk_LdPN: case xk_LdPExt: case xk_LdPP: case xk_Inc8: case xk_Dec8:
+    case xk_Inc16: case xk_Dec16: case xk_Add16: case xk_Pop: case xk_ExDeHl:
+    case xk_Exx: case xk_Rlca: case xk_Rrca: case xk_Cpl: case xk_Scf:
+    case xk_Di: case xk_BitR: case xk_BitM: case xk_ResR: case xk_SetR:
+      return 0;
+    default:
+      if (kind >= xk_AluR && kind < xk_AluRNf) return 0;
+      return 0xff;
+  }
+}
+
+/* the flags an operation sets whatever they were before */
+static unsigned flagsSet(int kind, const XOp* op) {
+  switch (kind) {
+    case xk_Inc8: case xk_Dec8: case xk_IncM: case xk_DecM:
+    case xk_BitR: case xk_BitM:
+      return 0xff & ~zf_C;
+    case xk_Add16: case xk_Rlca: case xk_Rrca: case xk_Rla: case xk_Rra:
+    case xk_Scf: case xk_Ccf:
+      return 0xff & ~(zf_S | zf_Z | zf_P);
+    case xk_Cpl:
+      return zf_H | zf_N | zf_X | zf_Y;
+    case xk_Daa: case xk_ExAf: case xk_RotR: case xk_RotM:
+      return 0xff;
+    case xk_Pop:
+      return op->a == offsetof(Z80_CPU, af) ? 0xff : 0;
+    default:
+      return kind >= xk_AluR && kind < xk_AluRNf ? 0xff : 0;
+  }
+}
+
+/* the handler for kind when nothing sees the flags it sets */
+static int withoutFlags(int kind) {
+  switch (kind) {
+    case xk_AluR + 7: case xk_AluN + 7: case xk_AluM + 7:
+      return xk_Nop;
+    case xk_Inc8:
+      return xk_Inc8Nf;
+    case xk_Dec8:
+      return xk_Dec8Nf;
+    default:
+      if (kind >= xk_AluR && kind < xk_AluN) return kind - xk_AluR + xk_AluRNf;
+      if (kind >= xk_AluN && kind < xk_AluM) return kind - xk_AluN + xk_AluNNf;
+      if (kind >= xk_AluM && kind < xk_AluRNf) return kind - xk_AluM + xk_AluMNf;
+      return kind;
+  }
+}
+
+/*
+ * Sets the handlers of a block's count ops of the given kinds, going back
+ * from its end, where every flag is seen, to drop the flags of arithmetic
+ * and logic that a later instruction replaces before anything looks.
+ */
+static void setHandlers(XOp* ops, const uint8_t* kinds, size_t count) {
+  unsigned live = 0xff;
+  for (size_t i = count; i-- > 0;) {
+    int kind = kinds[i];
+    unsigned set = flagsSet(kind, &ops[i]);
+    if (flagsRead(kind, &ops[i]) == 0xff) live = 0xff;
+    ops[i].handler = s_handlers[(set & live) == 0 ? withoutFlags(kind) : kind];
+    live = (live & ~set) | flagsRead(kind, &ops[i]);
+  }
+}
+
+static Z80_Block* translate(Z80_Xlat* x, uint16_t start) {
+  XOp ops[Z80_XLAT_MAX_OPS];
+  uint8_t kinds[Z80_XLAT_MAX_OPS];
+  Z80_Block* block;
+  unsigned addr = start;
+  unsigned t = 0;
+  unsigned r = 0;
+  unsigned lead = 0;
+  size_t count = 0;
+  size_t len;
+  int kind;
+
+  do {
+    XOp* op = &ops[count++];
+    const uint8_t* p = x->mem + addr;
+    Z80_OpCode opcode;
+    int n = 0;
+
+    memset(op, 0, sizeof(*op));
+    if (count == Z80_XLAT_MAX_OPS || addr > LAST_START) {
+      kind = xk_Exit;
+      op->nn = (uint16_t) addr;
+    }
+    else {
+      /* a run of prefixes is left to the interpreter, as is invalid code */
+      if (!((p[0] == 0xdd || p[0] == 0xfd) &&
+          (p[1] == 0xdd || p[1] == 0xfd || p[1] == 0xed))) {
+        n = z80_decode(p, &opcode);
+      }
+      op->nn = (uint16_t) addr;
+      if (n == 0) {
+        kind = xk_Step;
+        op->n = 1;
+        n = 1;
+      }
+      else {
+        op->next = (uint16_t) (addr + n);
+        op->t_self = opcode.timing.t;
+        op->t_taken = (uint8_t) (opcode.timing.t_taken - opcode.timing.t);
+        op->r_self = (uint8_t) fetches(p);
+        kind = classify(op, &opcode, p);
+      }
+      lead = t;
+    }
+    kinds[count - 1] = (uint8_t) kind;
+    t += op->t_self;
+    r += op->r_self;
+    op->t_end = (uint16_t) t;
+    op->r_end = (uint8_t) r;
+    addr += (unsigned) n;
+  } while (kind < xk_Jp && !(kind == xk_Step && ops[count - 1].n));
+
+  setHandlers(ops, kinds, count);
+  len = addr - start;
+  block = (Z80_Block*) malloc(sizeof(Z80_Block) + count * sizeof(XOp) + len);
+  if (block == NULL) return NULL;
+  block->start = start;
+  block->len = (uint16_t) len;
+  block->lead = (uint16_t) lead;
+  block->count = (uint16_t) count;
+  memcpy(block->ops, ops, count * sizeof(XOp));
+  block->bytes = (const uint8_t*) (block->ops + count);
+  memcpy(block->ops + count, x->mem + start, len);
+  for (unsigned a = start; a < addr; a++) {
+    x->cover[a]++;
+    x->page_cover[a >> 8]++;
+  }
+  x->blocks[start] = block;
+  x->translated++;
+  return block;
+}
+
+static void drop(Z80_Xlat* x, Z80_Block* block) {
+  for (unsigned a = block->start; a < (unsigned) block->start + block->len; a++) {
+    x->cover[a]--;
+    x->page_cover[a >> 8]--;
+  }
+  x->blocks[block->start] = NULL;
+  free(block);
+  x->invalidated++;
+}
+
+/* drops the blocks reaching into page whose bytes have changed */
+static void checkPage(Z80_Xlat* x, unsigned page) {
+  unsigned first = page << 8;
+  unsigned from = first >= MAX_BYTES ? first - MAX_BYTES + 1 : 0;
+  for (unsigned a = from; a < first + 256; a++) {
+    Z80_Block* block = x->blocks[a];
+    if (block != NULL && a + block->len > first &&
+        memcmp(x->mem + a, block->bytes, block->len) != 0) {
+      drop(x, block);
+    }
+  }
+}
+
+static void checkDirty(Z80_Xlat* x) {
+  for (unsigned i = 0; i < sizeof(x->dirty); i++) {
+    unsigned bits = x->dirty[i];
+    if (bits == 0) continue;
+    x->dirty[i] = 0;
+    for (unsigned page = i * 8; bits != 0; page++, bits >>= 1) {
+      if ((bits & 1) != 0 && x->page_cover[page] != 0) checkPage(x, page);
+    }
+  }
+}
+
+static void run(void* ctx, Z80_CPU* cpu) {
+  Z80_Xlat* x = (Z80_Xlat*) ctx;
+  while (cpu->cycles < cpu->run_end && !z80_cpu_stopped(cpu)) {
+    Z80_Block* block = NULL;
+    if (anyDirty(x)) checkDirty(x);
+    /* the interpreter takes interrupts, halts and the step after EI */
+    if (!cpu->halted && !cpu->ei_shadow && !cpu->nmi &&
+        !(cpu->irq && cpu->iff1) && cpu->pc <= LAST_START) {
+      block = x->blocks[cpu->pc];
+      if (block == NULL) block = translate(x, cpu->pc);
+    }
+    if (block != NULL && cpu->cycles + block->lead < cpu->run_end) {
+      execBlock(x, cpu, block);
+      x->runs++;
+    }
+    else {
+      z80_cpu_step(cpu);
+      x->steps++;
+    }
+  }
+}
+
+void z80_xlat_init(Z80_Xlat* x, const uint8_t* mem) {
+  if (s_handlers == NULL) execBlock(NULL, NULL, NULL);
+  memset(x, 0, sizeof(*x));
+  x->mem = mem;
+}
+
+void z80_xlat_free(Z80_Xlat* x) {
+  z80_xlat_flush(x);
+}
+
+void z80_xlat_attach(Z80_Xlat* x, Z80_CPU* cpu) {
+  cpu->dirty = x->dirty;
+  cpu->runner = run;
+  cpu->run_ctx = x;
+}
+
+void z80_xlat_flush(Z80_Xlat* x) {
+  for (unsigned a = 0; a < Z80_MEM_SIZE; a++) {
+    if (x->blocks[a] != NULL) drop(x, x->blocks[a]);
+  }
+  memset(x->dirty, 0, sizeof(x->dirty));
+}
@@ -0,0 +1,74 @@
+#ifndef z80xlat_h
+#define z80xlat_h
+
+#include "z80emu.h"
+
+/*
+ * Basic-block translation. The first time execution reaches an address,
+ * the straight-line code there is decoded once into a block: an array of
+ * operations, each holding the address of its handler and its operands
+ * already extracted, ended by the first JP, JR, CALL, RET, RST, DJNZ,
+ * HALT, IN A,(n) or OUT (n),A, or after Z80_XLAT_MAX_OPS instructions.
+ * Blocks run with threaded dispatch, handler to handler, updating PC, R
+ * and the cycle count only when they exit. Instructions without a handler
+ * of their own are run by z80_cpu_step() from within the block. The flags
+ * of 8-bit arithmetic and logic are not computed when a later instruction
+ * in the block replaces them before anything can look at them.
+ *
+ * Results match z80_cpu_run() exactly: interrupts are accepted between
+ * blocks, and a block whose last instruction would start at or past the
+ * end of the run is left to the interpreter, which also handles halts and
+ * the instruction after EI. A write to the bytes of a block, by a block
+ * or by anything else, drops it before it runs again.
+ */
+#define Z80_XLAT_MAX_OPS 64
+
+typedef struct Z80_Block Z80_Block;
+
+/*
+ * Translation state for one CPU and its memory. Attach it with
+ * z80_xlat_attach(); it takes over cpu->dirty to learn of writes made by
+ * the interpreter and by callbacks, and counts the blocks covering each
+ * byte to catch those made by blocks themselves.
+ */
+typedef struct {
+  const uint8_t* mem;
+  Z80_Block* blocks[Z80_MEM_SIZE];
+  uint16_t cover[Z80_MEM_SIZE];
+  uint32_t page_cover[Z80_PAGE_COUNT];
+  uint8_t dirty[Z80_PAGE_COUNT / 8];
+  int hit;
+  uint64_t translated;
+  uint64_t invalidated;
+  uint64_t runs;
+  uint64_t steps;
+} Z80_Xlat;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+void z80_xlat_init(Z80_Xlat* x, const uint8_t* mem);
+
+void z80_xlat_free(Z80_Xlat* x);
+
+/*
+ * Makes z80_cpu_run() on cpu, whose memory must be the mem passed to
+ * z80_xlat_init(), run translated blocks. z80_cpu_step() still
+ * interprets a single instruction.
+ */
+void z80_xlat_attach(Z80_Xlat* x, Z80_CPU* cpu);
+
+/* Marks addr's page changed, for writes made other than by the CPU. */
+static inline void z80_xlat_touch(Z80_Xlat* x, uint16_t addr) {
+  x->dirty[addr >> 11] |= 1 << ((addr >> 8) & 7);
+}
+
+/* Drops every block, e.g. after loading a new image. */
+void z80_xlat_flush(Z80_Xlat* x);
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80xlat_h */
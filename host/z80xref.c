@@ -0,0 +1,94 @@
+#include <string.h>
+
+#include "z80xref.h"
+
+#define LINE_BATCH 256
+
+/* a reference before it is placed in the index */
+typedef struct {
+  uint16_t to;
+  uint16_t from;
+  uint8_t kind;
+} Pending;
+
+/* the address opcode refers to and how, or -1 if it refers to none */
+static int classify(const Z80_OpCode* opcode, uint16_t* to) {
+  for (int i = 0; i < opcode->argc; i++) {
+    const Z80_Arg* arg = &opcode->args[i];
+    if ((arg->flags & (am_Extended | am_Implicit)) == 0) continue;
+    *to = arg->v;
+    switch (opcode->operation) {
+      case op_CALL:
+        return xr_Call;
+      case op_JP:
+      case op_JR:
+      case op_DJNZ:
+        return xr_Jump;
+      case op_RST:
+        return xr_Rst;
+      default:
+        if ((arg->flags & am_Implicit) != 0) continue;
+        if ((arg->flags & am_Indirect) == 0) return xr_Address;
+        return i == 0 ? xr_Write : xr_Read;
+    }
+  }
+  return -1;
+}
+
+int z80_xref_build(Z80_Xrefs* xrefs, const uint8_t* mem, size_t len,
+    uint16_t base_addr) {
+  Z80_Line lines[LINE_BATCH];
+  /* an instruction refers to one address at most, and takes a byte */
+  Pending* pending = (Pending*) malloc((len != 0 ? len : 1) * sizeof(Pending));
+  size_t offset = 0;
+  size_t n = 0;
+
+  memset(xrefs->first, 0, sizeof(xrefs->first));
+  xrefs->refs = NULL;
+  xrefs->count = 0;
+  if (pending == NULL) return -1;
+  while (offset < len) {
+    size_t consumed;
+    size_t count = z80_disassemble_range(mem + offset, len - offset,
+        (uint16_t) (base_addr + offset), lines, LINE_BATCH, &consumed);
+    for (size_t i = 0; i < count; i++) {
+      uint16_t to;
+      int kind;
+      if (lines[i].status != ds_Ok) continue;
+      kind = classify(&lines[i].opcode, &to);
+      if (kind < 0) continue;
+      pending[n].to = to;
+      pending[n].from = lines[i].addr;
+      pending[n++].kind = (uint8_t) kind;
+      xrefs->first[to + 1]++;
+    }
+    offset += consumed;
+  }
+
+  xrefs->refs = (Z80_Xref*) malloc((n != 0 ? n : 1) * sizeof(Z80_Xref));
+  if (xrefs->refs == NULL) {
+    free(pending);
+    return -1;
+  }
+  for (uint32_t addr = 0; addr < Z80_XREF_TARGETS; addr++) {
+    xrefs->first[addr + 1] += xrefs->first[addr];
+  }
+  /* place each in its target's run, counting first[to] up as it fills
+   * and restoring it after */
+  for (size_t i = 0; i < n; i++) {
+    Z80_Xref* ref = &xrefs->refs[xrefs->first[pending[i].to]++];
+    ref->from = pending[i].from;
+    ref->kind = pending[i].kind;
+  }
+  memmove(xrefs->first + 1, xrefs->first, Z80_XREF_TARGETS * sizeof(uint32_t));
+  xrefs->first[0] = 0;
+  xrefs->count = n;
+  free(pending);
+  return 0;
+}
+
+void z80_xref_free(Z80_Xrefs* xrefs) {
+  free(xrefs->refs);
+  xrefs->refs = NULL;
+  xrefs->count = 0;
+}
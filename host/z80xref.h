@@ -0,0 +1,65 @@
+#ifndef z80xref_h
+#define z80xref_h
+
+#include "z80dasm.h"
+
+#define Z80_XREF_TARGETS 65536
+
+/*
+ * How an instruction refers to an address: xr_Address is an LD of the
+ * address itself into a register pair, as when taking a pointer to data.
+ */
+typedef enum {
+  xr_Call,
+  xr_Jump,
+  xr_Read,
+  xr_Write,
+  xr_Rst,
+  xr_Address
+} Z80_XrefKind;
+
+/* A reference by the instruction at from. */
+typedef struct {
+  uint16_t from;
+  uint8_t kind;
+} Z80_Xref;
+
+/*
+ * The references a linear sweep finds, grouped by the address they
+ * refer to: those to addr are refs[first[addr]] .. refs[first[addr + 1] - 1],
+ * in order of the referring address.
+ */
+typedef struct {
+  uint32_t first[Z80_XREF_TARGETS + 1];
+  Z80_Xref* refs;
+  size_t count;
+} Z80_Xrefs;
+
+#if defined(__cplusplus)
+extern "C" {
+#endif
+
+/*
+ * Sweeps the len bytes at mem, located at base_addr, and indexes every
+ * jump, call and RST target, every address read or written through an
+ * (nn) operand and every address loaded as a value. JR and DJNZ count as
+ * jumps to the address they resolve to. Returns 0, or -1 if memory is
+ * exhausted.
+ */
+int z80_xref_build(Z80_Xrefs* xrefs, const uint8_t* mem, size_t len,
+    uint16_t base_addr);
+
+void z80_xref_free(Z80_Xrefs* xrefs);
+
+/* The references to addr, storing their number in *n. */
+static inline const Z80_Xref* z80_xref_to(const Z80_Xrefs* xrefs,
+    uint16_t addr, size_t* n) {
+  *n = xrefs->first[addr + 1] - xrefs->first[addr];
+  return xrefs->refs + xrefs->first[addr];
+}
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif /* z80xref_h */
@@ -1,8 +1,24 @@
+	;--------------------------------------------------------------
+	; Memory map
+	;
+	;   0x0000-0x007f	RST and NMI vectors, reset and dispatch
+	;   0x0080-0x00ff	handler vectors and register save areas
+	;   0x0100-0x01ff	supervisor call table and routines
+	;   0x0200-0x02ff	console driver, its vectors and ring indexes
+	;   0x0300-0x04ff	console receive and transmit rings
+	;   0x0500-0x053f	user stack
+	;   0x0540-		user program
+	;
+
 	;--------------------------------------------------------------
 	; Constants
 	;
 con_io		equ 0x80
 con_status	equ 0x81
+con_ctrl	equ 0x82		; interrupt enables
+con_vec		equ 0x83		; interrupt vector, RX; TX is vector+2
+con_rxint	equ 1			; con_ctrl: interrupt on input ready
+con_txint	equ 2			; con_ctrl: interrupt on output ready
 ustack_size	equ 64
 
 
@@ -80,6 +96,7 @@ sys_reset:
 		push hl			; set default RST 0x10 vector
 		push hl			; set default RST 0x08 vector
 		ld sp,user_prog		; set stack below the user program
+		call con_init		; reset the console driver
 		jp user_prog		; transfer control to the user program
 
 	;--------------------------------------------------------------
@@ -154,13 +171,28 @@ _putc		defw __putc
 _puts		defw __puts
 @puts		equ (_puts - svc_table)/2
 
+_write		defw __write
+@write		equ (_write - svc_table)/2
+
+_read		defw __read
+@read		equ (_read - svc_table)/2
+
 
 	;--------------------------------------------------------------
 	; SVC: exit
-	; Halts the CPU.
+	; Waits for queued console output to drain, masks console
+	; interrupts if the driver was started and halts the CPU.
 	; If an interrupt occurs the system restarts
 
 __exit:
+		call con_flush		; let queued output drain
+		ld a,(con_ctrlval)
+		or a			; has the driver been started?
+		jr z,__exit_halt
+		xor a
+		out (con_ctrl),a	; mask console interrupts
+		ld (con_ctrlval),a
+__exit_halt:
 		halt
 		jp 0x0
 
@@ -216,13 +248,35 @@ __setvec38:
 
 	;--------------------------------------------------------------
 	; SVC: getc
-	; Gets a character from console input.
+	; Gets a character from console input. Once interrupt-driven
+	; input has been started only the receive ring is read, since the
+	; port belongs to the ISR; until then the port is polled.
 	;
 	; On return:
         ;   	If NZ then no input was available, otherwise A is the
 	;	character that was read from the console.
 	;
 __getc:
+		push hl
+		ld hl,(con_rxhead)	; L = head, H = tail
+		ld a,l
+		cp h			; is the receive ring empty?
+		jr z,__getc_poll
+		ld l,h			; point to the oldest character
+		ld h,con_rxbuf/256
+		ld a,l
+		inc a
+		ld (con_rxtail),a	; advance the tail past it
+		ld a,(hl)		; get the character
+		pop hl
+		cp a			; Z: a character was read
+		ret
+
+__getc_poll:
+		pop hl
+		ld a,(con_ctrlval)
+		and con_rxint		; is the ISR taking input?
+		ret nz
 		in a,(con_status)	; get status flags
 		and 1			; bit 0 is input ready
 		ret nz			; input ready is active low
@@ -241,9 +295,11 @@ __getc:
 	;	Z flag set
 	;
 __putc:
+		call con_flush		; keep order with queued output
+__putc_poll:
 		in a,(con_status)	; get status flags
 		and 2			; bit 1 is output ready
-		jr nz,__putc		; output ready is active low
+		jr nz,__putc_poll	; output ready is active low
 		ld a,c			; get character to output
 		out (con_io),a		; write the character
 		ret
@@ -263,13 +319,104 @@ __putc:
 	;	Z flag set
 	;
 __puts:
+		call con_flush		; keep order with queued output
+__puts_next:
 		ld a,(hl)		; get next character from string
 		ld c,a			; prepare for call to _putc
 		or a			; is it the null terminator?
 		ret z
-		call __putc		; put the charactor
+		call __putc_poll	; put the charactor
 		inc hl			; point to next character
-		jr __puts
+		jr __puts_next
+
+	;--------------------------------------------------------------
+	; SVC: write
+	; Queues a buffer for interrupt-driven console output and
+	; returns as soon as it is queued, waiting only while the
+	; transmit ring is full. Interrupts are enabled on return.
+	;
+        ; On entry:
+	;   	HL points to the buffer
+	;	BC is the number of characters to write
+	;
+	; On return:
+	;	HL points past the end of the buffer
+	;	BC is zero
+	;	A is modified
+	;
+__write:
+		push de
+__write_next:
+		ld a,b			; anything left to queue?
+		or c
+		jr z,__write_done
+		ld de,(con_txhead)	; E = head, D = tail
+		ld a,e
+		inc a
+		cp d			; is the transmit ring full?
+		jr nz,__write_put
+		call con_txstart	; make sure it is draining
+		halt			; and wait for the transmitter
+		jr __write_next
+__write_put:
+		ld d,con_txbuf/256	; DE points at the head
+		ldi			; queue a character
+		ld a,e
+		ld (con_txhead),a	; advance the head past it
+		jr __write_next
+__write_done:
+		pop de
+		jp con_txstart		; start the transmitter
+
+	;--------------------------------------------------------------
+	; SVC: read
+	; Starts interrupt-driven console input if it is not running,
+	; waits for input to arrive and copies what has been received.
+	; Interrupts are enabled on return.
+	;
+        ; On entry:
+	;   	HL points to the buffer
+	;	BC is its size
+	;
+	; On return:
+	;	HL points past the last character stored
+	;	BC is the unused size, less than on entry unless it was
+	;	zero
+	;	A is modified
+	;
+__read:
+		call con_rxstart	; start receiving
+		ld a,b			; no room?
+		or c
+		ret z
+		push de
+__read_wait:
+		di			; as in con_flush, test and halt as one
+		ld de,(con_rxhead)	; E = head, D = tail
+		ld a,e
+		cp d			; is the receive ring empty?
+		jr nz,__read_ready
+		ei
+		halt			; wait for a character
+		jr __read_wait
+__read_ready:
+		ei
+__read_next:
+		ld e,d			; DE points at the tail
+		ld d,con_rxbuf/256
+		ex de,hl
+		ldi			; copy a character to the buffer
+		ex de,hl
+		ld a,e
+		ld (con_rxtail),a	; advance the tail past it
+		jp po,__read_done	; buffer full?
+		ld de,(con_rxhead)
+		ld a,e
+		cp d			; anything more received?
+		jr nz,__read_next
+__read_done:
+		pop de
+		ret
 
 	;--------------------------------------------------------------
 	; Controller register peek
@@ -344,10 +491,165 @@ reg_peek:
 
 		ret
 
+	;--------------------------------------------------------------
+	; Console driver
+	;
+	; Input and output are buffered in 256-byte rings, so that an
+	; index wraps by itself, filled and drained by IM 2 interrupts.
+	; A ring is empty when its head and tail are equal; each head is
+	; followed by its tail so that one LD rr,(nn) fetches both.
+	;
+	; The driver is opt-in: nothing touches the con_ctrl and con_vec
+	; ports, IM 2 or the interrupt enable until @write or @read first
+	; starts it, so programs that keep to @getc, @putc and @puts run
+	; as before on boards without those ports.
+
+		org 0x200
+con_vectors:
+		defw con_rxisr		; IM 2 vector for input ready
+		defw con_txisr		; IM 2 vector for output ready
+
+con_rxhead	defb 0			; next free slot in con_rxbuf
+con_rxtail	defb 0			; oldest character in con_rxbuf
+con_txhead	defb 0			; next free slot in con_txbuf
+con_txtail	defb 0			; oldest character in con_txbuf
+con_ctrlval	defb 0			; last value written to con_ctrl
+
+	; Resets the rings, masking console interrupts again if the
+	; driver was running.
+con_init:
+		ld a,(con_ctrlval)
+		or a			; was the driver running?
+		jr z,con_init_rings
+		xor a
+		out (con_ctrl),a	; mask console interrupts
+		ld (con_ctrlval),a
+con_init_rings:
+		ld h,a
+		ld l,a
+		ld (con_rxhead),hl	; empty both rings
+		ld (con_txhead),hl
+		ret
+
+	; Waits until the transmit ring is empty. Interrupts are disabled
+	; from the test to the halt, since EI takes effect only after the
+	; next instruction, so the last one cannot slip in between. The
+	; caller's interrupt state, IFF2 as LD A,I copies it to P/V, is
+	; restored on return. Modifies A.
+con_flush:
+		ld a,i			; P/V = IFF2
+		di
+		push af
+con_flush_wait:
+		ld a,(con_ctrlval)
+		and con_txint		; the transmitter stops once drained
+		jr z,con_flushed
+		ei
+		halt			; wait for it to take a character
+		di
+		jr con_flush_wait
+con_flushed:
+		pop af
+		ret po			; interrupts were disabled
+		ei
+		ret
+
+	; Unmasks the output ready interrupt. Modifies A.
+con_txstart:
+		ld a,con_txint
+		jr con_unmask
+
+	; Unmasks the input ready interrupt. Modifies A.
+con_rxstart:
+		ld a,con_rxint
+
+	; Unmasks the console interrupts in A, pointing the device and
+	; IM 2 at con_vectors first, which starts the driver. Modifies A;
+	; interrupts are enabled on return.
+con_unmask:
+		di
+		push hl
+		ld hl,con_ctrlval
+		or (hl)
+		ld (hl),a
+		ld l,a			; keep the new enables
+		ld a,con_vectors/256
+		ld i,a
+		ld a,con_vectors&0xff
+		out (con_vec),a
+		im 2
+		ld a,l
+		out (con_ctrl),a
+		pop hl
+		ei
+		ret
+
+	; Input ready: moves the character into the receive ring, or
+	; drops it if the ring is full.
+con_rxisr:
+		push af
+		push bc
+		push hl
+		ld hl,(con_rxhead)	; L = head, H = tail
+		ld a,l
+		inc a
+		cp h			; is the receive ring full?
+		jr z,con_rxdrop
+		ld h,con_rxbuf/256	; HL points at the head
+		ld c,con_io
+		ini			; receive into the ring
+		ld a,l
+		ld (con_rxhead),a	; advance the head
+		jr con_isrdone
+con_rxdrop:
+		in a,(con_io)		; take the character to clear the request
+		jr con_isrdone
+
+	; Output ready: sends the oldest character in the transmit ring,
+	; or masks the interrupt once the ring is empty.
+con_txisr:
+		push af
+		push bc
+		push hl
+		ld hl,(con_txhead)	; L = head, H = tail
+		ld a,l
+		cp h			; is the transmit ring empty?
+		jr z,con_txidle
+		ld l,h			; HL points at the tail
+		ld h,con_txbuf/256
+		ld c,con_io
+		outi			; send from the ring
+		ld a,l
+		ld (con_txtail),a	; advance the tail
+		jr con_isrdone
+con_txidle:
+		ld hl,con_ctrlval
+		ld a,(hl)
+		and ~con_txint&0xff
+		ld (hl),a
+		out (con_ctrl),a	; mask the output ready interrupt
+con_isrdone:
+		pop hl
+		pop bc
+		pop af
+		ei
+		reti
+
+		org 0x300
+con_rxbuf	defs 256		; receive ring
+con_txbuf	defs 256		; transmit ring
+
 	;-----------------------------------------------------------------
 	; Start of user memory
 	;
-		org 0x200
+	; The user stack grows down from user_prog, where a program is
+	; loaded and where reset enters it. These were 0x200 and 0x240
+	; until the console driver's vectors and rings took 0x200-0x4ff;
+	; a program built for the old layout must be reassembled at
+	; user_prog (0x540). host/z80sup.h carries the same addresses for
+	; host loaders.
+	;
+		org 0x500
 user_mem:
 		defs ustack_size
 user_prog:
@@ -0,0 +1,54 @@
+/*
+ * Checks z80_format_syntax() and z80_format_data() in each hex style,
+ * including fmt_HexDollar and fmt_HexSuffix given together, where
+ * fmt_HexDollar wins. Exits nonzero on the first mismatch.
+ *
+ *   cc -O2 -I.. -o format_test format_test.c ../z80dasm.c
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "z80dasm.h"
+
+typedef struct {
+  uint8_t bytes[4];
+  int syntax;
+  const char* text;
+} Case;
+
+static const Case s_cases[] = {
+  { { 0x3e, 0xff }, fmt_Zilog, "LD A,0xFF" },
+  { { 0x3e, 0xff }, fmt_HexDollar, "LD A,$FF" },
+  { { 0x3e, 0xff }, fmt_HexSuffix, "LD A,0FFH" },
+  { { 0x3e, 0xff }, fmt_HexDollar | fmt_HexSuffix, "LD A,$FF" },
+  { { 0x3e, 0xff }, fmt_Lower | fmt_HexSuffix, "ld a,0ffh" },
+  { { 0x3e, 0xff }, fmt_Lower | fmt_HexDollar | fmt_HexSuffix, "ld a,$ff" },
+  { { 0xc3, 0x34, 0x12 }, fmt_HexSuffix, "JP 1234H" },
+  { { 0xc3, 0x34, 0x12 }, fmt_HexDollar | fmt_HexSuffix, "JP $1234" },
+  { { 0xdb, 0xfe }, fmt_HexDollar | fmt_HexSuffix, "IN A,($FE)" }
+};
+
+static int check(const char* what, const char* got, const char* want) {
+  if (strcmp(got, want) == 0) return 0;
+  fprintf(stderr, "format_test: %s: got \"%s\", want \"%s\"\n", what, got, want);
+  return 1;
+}
+
+int main(void) {
+  static const uint8_t data[] = { 0xfe };
+  char text[64];
+  int failed = 0;
+  for (size_t i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); i++) {
+    const Case* c = &s_cases[i];
+    Z80_OpCode opcode;
+    if (z80_decode(c->bytes, &opcode) == 0) {
+      failed |= check("decode", "", c->text);
+      continue;
+    }
+    z80_format_syntax(&opcode, c->syntax, text, sizeof(text));
+    failed |= check("format", text, c->text);
+  }
+  z80_format_data(data, 1, fmt_HexDollar | fmt_HexSuffix, text, sizeof(text));
+  failed |= check("data", text, "DEFB $FE");
+  return failed;
+}
@@ -0,0 +1,123 @@
+/*
+ * Assembles sup/sup.asm and checks that each address and value the host
+ * code takes from it, in z80sup.h, z80svc.h and z80con.h, matches the
+ * symbol it is named after. Exits nonzero on the first mismatch.
+ *
+ *   cc -O2 -I.. -I../host -o sup_test sup_test.c ../host/z80asm.c \
+ *       ../host/z80list.c ../z80dasm.c
+ *   ./sup_test sup.asm
+ */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "z80asm.h"
+#include "z80con.h"
+#include "z80sup.h"
+#include "z80svc.h"
+
+typedef struct {
+  const char* symbol;
+  int32_t value;
+} Case;
+
+static const Case s_cases[] = {
+  { "ctrl_rst08", Z80_SUP_CTRL_RST08 },
+  { "ctrl_rst38", Z80_SUP_CTRL_RST38 },
+  { "__exit_halt", Z80_SUP_EXIT_HALT },
+  { "con_rxhead", Z80_SUP_CON_RXHEAD },
+  { "con_rxtail", Z80_SUP_CON_RXTAIL },
+  { "con_ctrlval", Z80_SUP_CON_CTRLVAL },
+  { "con_rxbuf", Z80_SUP_CON_RXBUF },
+  { "user_mem", Z80_SUP_USER_MEM },
+  { "user_prog", Z80_SUP_USER_PROG },
+  { "svc_table", Z80_SVC_TABLE },
+  { "@exit", svc_Exit },
+  { "@setvec", svc_SetVec },
+  { "@getc", svc_GetC },
+  { "@putc", svc_PutC },
+  { "@puts", svc_PutS },
+  { "@write", Z80_SUP_SVC_WRITE },
+  { "@read", Z80_SUP_SVC_READ },
+  { "con_io", Z80_CON_IO },
+  { "con_status", Z80_CON_STATUS },
+  { "con_ctrl", Z80_CON_CTRL },
+  { "con_vec", Z80_CON_VECTOR },
+  { "con_rxint", con_RxInt },
+  { "con_txint", con_TxInt }
+};
+
+static Z80_Asm s_as;
+static uint8_t s_image[Z80_MEM_SIZE];
+
+static char* readFile(const char* path, size_t* len) {
+  FILE* fp = fopen(path, "rb");
+  char* text = NULL;
+  long size;
+  if (fp == NULL) return NULL;
+  if (fseek(fp, 0, SEEK_END) == 0 && (size = ftell(fp)) >= 0 &&
+      fseek(fp, 0, SEEK_SET) == 0) {
+    text = (char*) malloc((size_t) size + 1);
+    if (text != NULL && fread(text, 1, (size_t) size, fp) != (size_t) size) {
+      free(text);
+      text = NULL;
+    }
+    *len = (size_t) size;
+  }
+  fclose(fp);
+  return text;
+}
+
+/* Returns the index of the symbol called name, or -1. */
+static long findSymbol(const Z80_Asm* as, const char* name) {
+  for (size_t i = 0; i < as->symbol_count; i++) {
+    if (strcmp(z80_asm_symbol_name(as, i), name) == 0) return (long) i;
+  }
+  return -1;
+}
+
+int main(int argc, char** argv) {
+  char* text;
+  size_t len;
+  int failed = 0;
+
+  if (argc != 2) {
+    fprintf(stderr, "usage: sup_test sup.asm\n");
+    return 1;
+  }
+  text = readFile(argv[1], &len);
+  if (text == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+  if (z80_asm_init(&s_as) != 0) {
+    fprintf(stderr, "sup_test: out of memory\n");
+    return 1;
+  }
+  if (z80_asm_assemble(&s_as, text, len, s_image) != 0) {
+    fprintf(stderr, "%s:%d: %s\n", argv[1], s_as.line, s_as.error);
+    return 1;
+  }
+
+  for (size_t i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); i++) {
+    const Case* c = &s_cases[i];
+    long at = findSymbol(&s_as, c->symbol);
+    if (at < 0) {
+      fprintf(stderr, "sup_test: %s is not defined\n", c->symbol);
+      failed = 1;
+    }
+    else if (s_as.symbols[at].value != c->value) {
+      fprintf(stderr, "sup_test: %s is 0x%04x, not 0x%04x\n", c->symbol,
+          (unsigned) s_as.symbols[at].value, (unsigned) c->value);
+      failed = 1;
+    }
+  }
+  /* the HALT that the native @exit leaves the CPU just past */
+  if (s_image[Z80_SUP_EXIT_HALT] != 0x76) {
+    fprintf(stderr, "sup_test: __exit_halt is not a HALT\n");
+    failed = 1;
+  }
+  z80_asm_free(&s_as);
+  free(text);
+  return failed;
+}
@@ -0,0 +1,266 @@
+/*
+ * Runs each supervisor call of the assembled sup/sup.asm twice from the
+ * same state, once through the ROM and once with z80svc attached, and
+ * checks that both leave the same registers, interrupt state and memory,
+ * less R, the T-states and the dead stack below SP, and send the same
+ * output. Each call is made with interrupts disabled and enabled, on an
+ * infinitely fast line and a slow one, the calls that wait for queued
+ * output also just after an @write, and getc also once @read has
+ * started receiving. Input arrives as the call is made. getc must also
+ * return what it is expected to. Exits nonzero on the first difference.
+ *
+ *   cc -O2 -I.. -I../host -o svc_test svc_test.c ../host/z80con.c \
+ *       ../host/z80emu.c ../host/z80svc.c ../z80dasm.c
+ *   ./svc_test sup.bin
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "z80con.h"
+#include "z80sup.h"
+#include "z80svc.h"
+
+#define STRING 0x7000
+#define MESSAGE 0x7100
+#define MESSAGE_LEN 24
+#define CHAR_CYCLES 150
+#define MAX_CYCLES 1000000
+#define DEAD_STACK 32
+
+typedef enum {
+  pre_None,
+  pre_Write,            /* leaves output queued on a slow line */
+  pre_Read              /* starts interrupt-driven input */
+} Prelude;
+
+typedef struct {
+  const char* name;
+  uint8_t index;
+  uint16_t hl;
+  uint16_t bc;
+  const char* input;
+  Prelude prelude;
+  int getc[2];          /* getc's character or -1 for NZ, under DI and EI */
+} Case;
+
+typedef struct {
+  int open;             /* input has arrived */
+  const char* input;
+  char output[256];
+  size_t sent;
+} Io;
+
+typedef struct {
+  Z80_CPU cpu;
+  uint8_t mem[Z80_MEM_SIZE];
+  Io io;
+} Machine;
+
+static const Case s_cases[] = {
+  { "exit", svc_Exit, 0, 0, "", pre_None, { 0 } },
+  { "exit after write", svc_Exit, 0, 0, "", pre_Write, { 0 } },
+  { "setvec 0x00", svc_SetVec, 0x1234, 0x00, "", pre_None, { 0 } },
+  { "setvec 0x07", svc_SetVec, 0x1234, 0x07, "", pre_None, { 0 } },
+  { "setvec 0x08", svc_SetVec, 0x1234, 0x08, "", pre_None, { 0 } },
+  { "setvec 0x20", svc_SetVec, 0x1234, 0x20, "", pre_None, { 0 } },
+  { "setvec 0x28", svc_SetVec, 0x1234, 0x28, "", pre_None, { 0 } },
+  { "setvec 0x38", svc_SetVec, 0x1234, 0x38, "", pre_None, { 0 } },
+  { "setvec 0xff", svc_SetVec, 0x1234, 0xff, "", pre_None, { 0 } },
+  { "getc", svc_GetC, 0, 0, "q", pre_None, { 'q', 'q' } },
+  { "getc without input", svc_GetC, 0, 0, "", pre_None, { -1, -1 } },
+  /* under DI the character waits at the port for the ISR */
+  { "getc after read", svc_GetC, 0, 0, "q", pre_Read, { -1, 'q' } },
+  { "getc after read without input", svc_GetC, 0, 0, "", pre_Read, { -1, -1 } },
+  { "putc", svc_PutC, 0, 'x', "", pre_None, { 0 } },
+  { "putc after write", svc_PutC, 0, 'x', "", pre_Write, { 0 } },
+  { "puts", svc_PutS, STRING, 0, "", pre_None, { 0 } },
+  { "puts after write", svc_PutS, STRING, 0, "", pre_Write, { 0 } }
+};
+
+static Machine s_rom;
+static Machine s_native;
+static uint8_t s_sup[Z80_MEM_SIZE];
+static uint32_t s_seed = 0x2545f491;
+
+static uint16_t random16(void) {
+  s_seed ^= s_seed << 13;
+  s_seed ^= s_seed >> 17;
+  s_seed ^= s_seed << 5;
+  return (uint16_t) s_seed;
+}
+
+static int ioRead(void* ctx, int wait) {
+  Io* io = (Io*) ctx;
+  (void) wait;
+  if (!io->open) return -1;
+  if (*io->input == '\0') return -2;
+  return (uint8_t) *io->input++;
+}
+
+static void ioWrite(void* ctx, uint8_t c) {
+  Io* io = (Io*) ctx;
+  if (io->sent < sizeof(io->output)) io->output[io->sent++] = (char) c;
+}
+
+static uint8_t* put16(uint8_t* p, uint8_t opcode, uint16_t v) {
+  *p++ = opcode;
+  *p++ = (uint8_t) v;
+  *p++ = (uint8_t) (v >> 8);
+  return p;
+}
+
+/*
+ * Writes the test program at user_prog: DI or EI, the prelude, the call
+ * and a HALT that marks its return. Returns the address of the HALT.
+ */
+static uint16_t build(uint8_t* mem, const Case* c, int ei) {
+  uint8_t* p = mem + Z80_SUP_USER_PROG;
+  *p++ = ei ? 0xfb : 0xf3;
+  if (c->prelude != pre_None) {
+    int write = c->prelude == pre_Write;
+    p = put16(p, 0x21, MESSAGE);            /* LD HL,MESSAGE */
+    p = put16(p, 0x01, write ? MESSAGE_LEN : 0);
+    *p++ = 0x3e;                            /* LD A,@write or @read */
+    *p++ = write ? Z80_SUP_SVC_WRITE : Z80_SUP_SVC_READ;
+    *p++ = 0xef;                            /* RST 0x28 */
+    /* both return with interrupts enabled */
+    *p++ = ei ? 0xfb : 0xf3;
+  }
+  p = put16(p, 0x21, c->hl);                /* LD HL,hl */
+  p = put16(p, 0x01, c->bc);                /* LD BC,bc */
+  *p++ = 0x3e;                              /* LD A,index */
+  *p++ = c->index;
+  *p++ = 0xef;                              /* RST 0x28 */
+  *p = 0x76;                                /* HALT */
+  return (uint16_t) (p - mem);
+}
+
+/*
+ * Runs m from reset to the end of the program, giving the registers the
+ * program does not set the values in regs once it starts. Returns -1 if
+ * it runs away.
+ */
+static int run(Machine* m, const Case* c, int ei, int slow, int native,
+    const uint16_t* regs) {
+  Z80_CPU* cpu = &m->cpu;
+  Z80_Console con;
+  Z80_Svc svc;
+  uint16_t end;
+
+  memcpy(m->mem, s_sup, sizeof(m->mem));
+  strcpy((char*) m->mem + STRING, "Hi!");
+  for (int i = 0; i < MESSAGE_LEN; i++) m->mem[MESSAGE + i] = (uint8_t) ('a' + i);
+  end = build(m->mem, c, ei);
+  memset(&m->io, 0, sizeof(m->io));
+  m->io.input = c->input;
+
+  z80_cpu_init(cpu, m->mem, NULL, NULL, NULL);
+  z80_con_init(&con, cpu, ioRead, ioWrite, &m->io);
+  con.char_cycles = slow ? CHAR_CYCLES : 0;
+  z80_svc_init(&svc);
+  if (native) z80_svc_attach(&svc, cpu);
+
+  while (cpu->pc != Z80_SUP_USER_PROG) {
+    if (cpu->cycles > MAX_CYCLES || z80_con_run(&con, 1) == 0) return -1;
+  }
+  cpu->af.b.l = (uint8_t) regs[0];
+  cpu->de.w = regs[1];
+  cpu->ix.w = regs[2];
+  cpu->iy.w = regs[3];
+  cpu->af_.w = regs[4];
+  cpu->bc_.w = regs[5];
+  cpu->de_.w = regs[6];
+  cpu->hl_.w = regs[7];
+  while (cpu->pc != end - 1) {
+    if (cpu->cycles > MAX_CYCLES) return -1;
+    z80_con_run(&con, 1);
+  }
+  m->io.open = 1;
+  z80_con_update(&con);
+  /* a CPU halted with no console interrupt enabled has stopped for good */
+  while (cpu->pc != end && !(cpu->halted && (con.ctrl == 0 || !cpu->iff1))) {
+    if (cpu->cycles > MAX_CYCLES) return -1;
+    z80_con_run(&con, 1);
+  }
+  return 0;
+}
+
+static const char* compare(const Machine* a, const Machine* b) {
+  const Z80_CPU* x = &a->cpu;
+  const Z80_CPU* y = &b->cpu;
+  uint16_t sp = x->sp.w;
+  if (x->af.w != y->af.w) return "AF differs";
+  if (x->bc.w != y->bc.w || x->de.w != y->de.w || x->hl.w != y->hl.w) {
+    return "BC, DE or HL differs";
+  }
+  if (x->ix.w != y->ix.w || x->iy.w != y->iy.w) return "IX or IY differs";
+  if (x->af_.w != y->af_.w || x->bc_.w != y->bc_.w || x->de_.w != y->de_.w ||
+      x->hl_.w != y->hl_.w) {
+    return "the alternate registers differ";
+  }
+  if (x->sp.w != y->sp.w || x->pc != y->pc) return "SP or PC differs";
+  if (x->iff1 != y->iff1 || x->iff2 != y->iff2) return "IFF1 or IFF2 differs";
+  if (x->im != y->im || x->i != y->i) return "IM or I differs";
+  if (x->halted != y->halted) return "the halt state differs";
+  for (uint32_t addr = 0; addr < Z80_MEM_SIZE; addr++) {
+    if ((uint16_t) (sp - addr - 1) < DEAD_STACK) continue;
+    if (a->mem[addr] != b->mem[addr]) return "memory differs";
+  }
+  if (a->io.sent != b->io.sent || memcmp(a->io.output, b->io.output, a->io.sent) != 0) {
+    return "the output differs";
+  }
+  return NULL;
+}
+
+int main(int argc, char** argv) {
+  FILE* fp;
+  int failed = 0;
+  size_t n;
+
+  if (argc != 2) {
+    fprintf(stderr, "usage: svc_test sup.bin\n");
+    return 1;
+  }
+  fp = fopen(argv[1], "rb");
+  if (fp == NULL) {
+    perror(argv[1]);
+    return 1;
+  }
+  n = fread(s_sup, 1, sizeof(s_sup), fp);
+  fclose(fp);
+  if (n <= Z80_SUP_USER_PROG) {
+    fprintf(stderr, "svc_test: %s: too short for a supervisor image\n", argv[1]);
+    return 1;
+  }
+
+  for (size_t i = 0; i < sizeof(s_cases) / sizeof(s_cases[0]); i++) {
+    const Case* c = &s_cases[i];
+    for (int slow = 0; slow <= 1; slow++) {
+      for (int ei = 0; ei <= 1; ei++) {
+        uint16_t regs[8];
+        const char* diff;
+        for (int r = 0; r < 8; r++) regs[r] = random16();
+        if (run(&s_rom, c, ei, slow, 0, regs) != 0 ||
+            run(&s_native, c, ei, slow, 1, regs) != 0) {
+          diff = "the call did not return";
+        }
+        else {
+          diff = compare(&s_rom, &s_native);
+        }
+        if (diff == NULL && c->index == svc_GetC) {
+          const Z80_CPU* cpu = &s_rom.cpu;
+          int z = (cpu->af.b.l & zf_Z) != 0;
+          if (c->getc[ei] < 0 ? z : !z || cpu->af.b.h != c->getc[ei]) {
+            diff = "getc returned the wrong result";
+          }
+        }
+        if (diff != NULL) {
+          fprintf(stderr, "svc_test: %s with interrupts %s on a %s line: %s\n",
+              c->name, ei ? "enabled" : "disabled", slow ? "slow" : "fast", diff);
+          failed = 1;
+        }
+      }
+    }
+  }
+  return failed;
+}
@@ -0,0 +1,126 @@
+/*
+ * Traces programs whose instructions carry runs of redundant DD/FD
+ * prefixes, which the CPU takes as one step, and checks what the trace
+ * reads back: a run of eight ahead of HALT on the very first step, one
+ * of three ahead of LD IX,nn and one longer than Z80_TRACE_MAX_BYTES,
+ * which is cut short. Exits nonzero on the first mismatch.
+ *
+ *   cc -O2 -I.. -I../host -o trace_test trace_test.c ../host/z80emu.c \
+ *       ../host/z80trace.c ../z80dasm.c
+ */
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "z80dasm.h"
+#include "z80trace.h"
+
+#define LONG_RUN 300
+
+typedef struct {
+  uint16_t pc;
+  int len;
+  const char* text;
+} Expected;
+
+static uint8_t s_mem[Z80_MEM_SIZE];
+static char s_path[] = "/tmp/trace_testXXXXXX";
+
+static int fail(const char* name, const char* what) {
+  fprintf(stderr, "trace_test: %s: %s\n", name, what);
+  unlink(s_path);
+  return 1;
+}
+
+/* the instruction the step's bytes decode to, or "" if they do not */
+static const char* text(const Z80_TraceStep* step) {
+  static char buf[64];
+  Z80_Line line;
+  buf[0] = '\0';
+  if (z80_disassemble_range(step->bytes, step->len, step->pc, &line, 1,
+      NULL) == 1 && line.status == ds_Ok && line.opcode.len == step->len) {
+    z80_format(&line.opcode, buf, sizeof(buf));
+  }
+  return buf;
+}
+
+/*
+ * Runs the program in s_mem from 0 to its halt under a trace and checks
+ * the steps read back against want, then the final registers.
+ */
+static int run(const char* name, const Expected* want, int nwant,
+    uint16_t ix, uint16_t iy) {
+  Z80_CPU cpu;
+  Z80_Trace trace;
+  Z80_TraceReader reader;
+  Z80_TraceStep step;
+  int fd = open(s_path, O_RDWR | O_TRUNC);
+  int n = 0;
+  int rc;
+
+  if (fd < 0) return fail(name, "cannot open the trace file");
+  z80_cpu_init(&cpu, s_mem, NULL, NULL, NULL);
+  if (z80_trace_init(&trace, 1, fd) != 0) return fail(name, "init failed");
+  while (!z80_cpu_stopped(&cpu)) {
+    z80_trace_step(&trace, &cpu);
+    z80_cpu_step(&cpu);
+  }
+  rc = z80_trace_finish(&trace, &cpu);
+  z80_trace_free(&trace);
+  close(fd);
+  if (rc != 0) return fail(name, "write failed");
+
+  if (z80_trace_open(&reader, s_path) != 0) return fail(name, "open failed");
+  while ((rc = z80_trace_next(&reader, &step)) > 0 && step.len != 0) {
+    if (n == nwant) return fail(name, "too many steps");
+    if (step.pc != want[n].pc) return fail(name, "wrong pc");
+    if (step.len != want[n].len) return fail(name, "wrong length");
+    if (strcmp(text(&step), want[n].text) != 0) return fail(name, "wrong bytes");
+    n++;
+  }
+  z80_trace_close(&reader);
+  if (rc <= 0) return fail(name, "malformed trace");
+  if (n != nwant) return fail(name, "too few steps");
+  if (step.regs.r[4] != ix || step.regs.r[5] != iy) {
+    return fail(name, "wrong final registers");
+  }
+  return 0;
+}
+
+int main(void) {
+  static const Expected halt[] = {
+    { 0x0000, 9, "HALT" }
+  };
+  static const Expected runs[] = {
+    { 0x0000, 6, "LD IX,0x1234" },
+    /* cut to Z80_TRACE_MAX_BYTES, which are all prefixes */
+    { 0x0006, Z80_TRACE_MAX_BYTES, "" },
+    { 0x0006 + LONG_RUN + 1, 1, "HALT" }
+  };
+  static const uint8_t ld_ix[] = { 0xdd, 0xdd, 0xdd, 0x21, 0x34, 0x12 };
+  int fd = mkstemp(s_path);
+  int rc;
+
+  if (fd < 0) {
+    perror("trace_test: mkstemp");
+    return 1;
+  }
+  close(fd);
+
+  memset(s_mem, 0xdd, 8);
+  s_mem[8] = 0x76;
+  rc = run("DD x8 HALT", halt, 1, 0, 0);
+
+  if (rc == 0) {
+    memset(s_mem, 0, sizeof(s_mem));
+    memcpy(s_mem, ld_ix, sizeof(ld_ix));
+    memset(s_mem + 6, 0xfd, LONG_RUN);
+    s_mem[6 + LONG_RUN] = 0x23;
+    s_mem[7 + LONG_RUN] = 0x76;
+    rc = run("long prefix runs", runs, 3, 0x1234, 0x0001);
+  }
+  unlink(s_path);
+  return rc;
+}
@@ -0,0 +1,348 @@
+/*
+ * Generates z80tables.h, the constant decode tables used by z80_decode()
+ * and the packed length tables used by z80_length(), by probing the
+ * switch decoder for every opcode on every prefix page. Timing comes from
+ * the rules in timing() rather than the decoder.
+ *
+ *   cc -O2 -DZ80DASM_SWITCH_ONLY -I.. -o z80gen z80gen.c ../z80dasm.c
+ *   ./z80gen > ../z80tables.h
+ */
+#include <stdio.h>
+#include <string.h>
+
+#include "z80dasm.h"
+
+enum { pg_Main, pg_CB, pg_ED, pg_DD, pg_FD, pg_DDCB, pg_FDCB, pg_Count };
+enum { pt_None = 0x00, pt_Byte = 0x10, pt_Word = 0x20, pt_Disp = 0x30 };
+
+static const char* s_pageNames[pg_Count] = {
+  "pg_Main", "pg_CB", "pg_ED", "pg_DD", "pg_FD", "pg_DDCB", "pg_FDCB"
+};
+
+static const uint8_t s_prefix[pg_Count][2] = {
+  { 0, 0 }, { 0xcb, 0 }, { 0xed, 0 }, { 0xdd, 0 }, { 0xfd, 0 },
+  { 0xdd, 0xcb }, { 0xfd, 0xcb }
+};
+
+static const int s_prefixLen[pg_Count] = { 0, 1, 1, 1, 1, 2, 2 };
+static const int s_opOffset[pg_Count] = { 0, 0, 0, 0, 0, 1, 1 };
+
+/* T-states and M-cycles of the unprefixed opcodes, not taken */
+static const uint8_t s_mainT[256] = {
+  4, 10,  7,  6,  4,  4,  7,  4,  4, 11,  7,  6,  4,  4,  7,  4,
+  8, 10,  7,  6,  4,  4,  7,  4, 12, 11,  7,  6,  4,  4,  7,  4,
+  7, 10, 16,  6,  4,  4,  7,  4,  7, 11, 16,  6,  4,  4,  7,  4,
+  7, 10, 13,  6, 11, 11, 10,  4,  7, 11, 13,  6,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  7,  7,  7,  7,  7,  7,  4,  7,  4,  4,  4,  4,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  4,  4,  4,  4,  4,  4,  7,  4,  4,  4,  4,  4,  4,  4,  7,  4,
+  5, 10, 10, 10, 10, 11,  7, 11,  5, 10, 10,  0, 10, 17,  7, 11,
+  5, 10, 10, 11, 10, 11,  7, 11,  5,  4, 10, 11, 10,  0,  7, 11,
+  5, 10, 10, 19, 10, 11,  7, 11,  5,  4, 10,  4, 10,  0,  7, 11,
+  5, 10, 10,  4, 10, 11,  7, 11,  5,  6, 10,  4, 10,  0,  7, 11
+};
+
+static const uint8_t s_mainM[256] = {
+  1, 3, 2, 1, 1, 1, 2, 1, 1, 3, 2, 1, 1, 1, 2, 1,
+  2, 3, 2, 1, 1, 1, 2, 1, 3, 3, 2, 1, 1, 1, 2, 1,
+  2, 3, 5, 1, 1, 1, 2, 1, 2, 3, 5, 1, 1, 1, 2, 1,
+  2, 3, 4, 1, 3, 3, 3, 1, 2, 3, 4, 1, 1, 1, 2, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  2, 2, 2, 2, 2, 2, 1, 2, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1,
+  1, 3, 3, 3, 3, 3, 2, 3, 1, 3, 3, 0, 3, 5, 2, 3,
+  1, 3, 3, 3, 3, 3, 2, 3, 1, 1, 3, 3, 3, 0, 2, 3,
+  1, 3, 3, 5, 3, 3, 2, 3, 1, 1, 3, 1, 3, 0, 2, 3,
+  1, 3, 3, 1, 3, 3, 2, 3, 1, 1, 3, 1, 3, 0, 2, 3
+};
+
+typedef struct {
+  int t;
+  int t_taken;
+  int m;
+  int m_taken;
+} Timing;
+
+static const uint8_t s_probes[2][4] = {
+  { 0x11, 0x22, 0x33, 0x44 },
+  { 0x9a, 0xbc, 0xde, 0xf1 }
+};
+
+static int nextPage(int page, uint8_t op) {
+  if (page == pg_Main || page == pg_DD || page == pg_FD) {
+    switch (op) {
+      case 0xcb:
+        return page == pg_DD ? pg_DDCB : page == pg_FD ? pg_FDCB : pg_CB;
+      case 0xdd:
+        return pg_DD;
+      case 0xed:
+        return pg_ED;
+      case 0xfd:
+        return pg_FD;
+    }
+  }
+  return pg_Main;
+}
+
+/*
+ * Lays out the prefix bytes, the probe operand bytes and the opcode at
+ * its page offset, returning a pointer to the page's view of memory.
+ */
+static uint8_t* probe(uint8_t* buf, int page, uint8_t op, int set) {
+  uint8_t* mem = buf + s_prefixLen[page];
+  memcpy(buf, s_prefix[page], s_prefixLen[page]);
+  memcpy(mem, s_probes[set], sizeof(s_probes[set]));
+  mem[s_opOffset[page]] = op;
+  return mem;
+}
+
+static int findPatch(const Z80_Arg* arg, const uint8_t* mem, int page) {
+  for (int k = 0; k < 3; k++) {
+    if (k == s_opOffset[page]) continue;
+    if ((arg->flags & am_Indexed) != 0) {
+      if (arg->displacement == mem[k]) return pt_Disp | k;
+    }
+    else if ((arg->flags & am_Extended) != 0) {
+      if (arg->v == (mem[k] | (mem[k + 1] << 8))) return pt_Word | k;
+    }
+    else if (arg->v == mem[k]) {
+      return pt_Byte | k;
+    }
+  }
+  return -1;
+}
+
+static int patchFor(const Z80_Arg* arg, const Z80_Arg* alt,
+    const uint8_t* mem, const uint8_t* alt_mem, int page) {
+  int patch, alt_patch;
+  if ((arg->flags & (am_Immediate | am_Indexed)) == 0) return pt_None;
+  patch = findPatch(arg, mem, page);
+  alt_patch = findPatch(alt, alt_mem, page);
+  if (patch < 0 || patch != alt_patch) {
+    fprintf(stderr, "z80gen: cannot locate operand (flags 0x%02x)\n", arg->flags);
+    exit(1);
+  }
+  return patch;
+}
+
+static int usesMemoryHL(uint8_t op) {
+  int y = (op >> 3) & 7;
+  int z = op & 7;
+  if (op == 0x34 || op == 0x35 || op == 0x36) return 1;
+  if (op >= 0x40 && op < 0x80 && op != 0x76) return y == 6 || z == 6;
+  return op >= 0x80 && op < 0xc0 && z == 6;
+}
+
+static void mainTiming(uint8_t op, Timing* tm) {
+  tm->t = tm->t_taken = s_mainT[op];
+  tm->m = tm->m_taken = s_mainM[op];
+  if (op == 0x10 || (op & 0xe7) == 0x20) {
+    tm->t_taken = tm->t + 5;
+    tm->m_taken = 3;
+  }
+  else if ((op & 0xc7) == 0xc0) {
+    tm->t_taken = 11;
+    tm->m_taken = 3;
+  }
+  else if ((op & 0xc7) == 0xc4) {
+    tm->t_taken = 17;
+    tm->m_taken = 5;
+  }
+}
+
+/*
+ * Timing of an instruction, including its prefixes. Taken values are for
+ * a conditional JR/JP/CALL/RET or DJNZ whose branch is taken, or a block
+ * instruction that repeats; they equal the others for anything else.
+ */
+static void timing(int page, uint8_t op, Timing* tm) {
+  int x = op >> 6;
+  int y = (op >> 3) & 7;
+  int z = op & 7;
+  int t, m;
+  switch (page) {
+    case pg_Main:
+      mainTiming(op, tm);
+      return;
+    case pg_DD:
+    case pg_FD:
+      /* the prefix, plus d and the address calculation for (IX+d) */
+      mainTiming(op, tm);
+      t = op == 0x36 ? 9 : usesMemoryHL(op) ? 12 : 4;
+      m = op == 0x36 ? 2 : usesMemoryHL(op) ? 3 : 1;
+      tm->t += t;
+      tm->t_taken += t;
+      tm->m += m;
+      tm->m_taken += m;
+      return;
+    case pg_CB:
+      t = z != 6 ? 8 : x == 1 ? 12 : 15;
+      m = z != 6 ? 2 : x == 1 ? 3 : 4;
+      break;
+    case pg_DDCB:
+    case pg_FDCB:
+      t = x == 1 ? 20 : 23;
+      m = x == 1 ? 5 : 6;
+      break;
+    default:
+      if (x == 2) {
+        /* block instructions; the repeating forms go round again */
+        t = 16;
+        m = 4;
+      }
+      else if (z == 7 && (y == 4 || y == 5)) {
+        t = 18;
+        m = 5;
+      }
+      else {
+        static const uint8_t edT[8] = { 12, 12, 15, 20, 8, 14, 8, 9 };
+        static const uint8_t edM[8] = { 3, 3, 4, 6, 2, 4, 2, 2 };
+        t = edT[z];
+        m = edM[z];
+      }
+      break;
+  }
+  tm->t = tm->t_taken = t;
+  tm->m = tm->m_taken = m;
+  if (page == pg_ED && x == 2 && y >= 6) {
+    tm->t_taken = 21;
+    tm->m_taken = 5;
+  }
+}
+
+static void describeArg(char* buf, const Z80_OpCode* opcode, int i, int patch) {
+  const Z80_Arg* arg = &opcode->args[i];
+  Z80_OpCode single;
+  if ((patch & 0xf0) == pt_Disp) {
+    sprintf(buf, "(%s+d)", arg->v == reg_IX ? "IX" : "IY");
+  }
+  else if ((patch & 0xf0) == pt_Word) {
+    strcpy(buf, (arg->flags & am_Indirect) != 0 ? "(nn)" : "nn");
+  }
+  else if ((patch & 0xf0) == pt_Byte) {
+    strcpy(buf, (arg->flags & am_Displacement) != 0 ? "e" : "n");
+  }
+  else {
+    single = *opcode;
+    single.argc = 1;
+    single.args[0] = *arg;
+    strcpy(buf, strchr(z80_to_string(&single), ' ') + 1);
+  }
+}
+
+static void emitEntry(int page, int op) {
+  uint8_t buf[2][8];
+  const uint8_t* mem[2];
+  Z80_OpCode opcode[2];
+  char mnemonic[80];
+  char text[40];
+  int next = nextPage(page, op);
+  int len;
+  Timing tm;
+
+  if (next != pg_Main) {
+    printf("    { 0, 0, 0, %s, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } },"
+        " /* %02X prefix */\n", s_pageNames[next], op);
+    return;
+  }
+
+  mem[0] = probe(buf[0], page, op, 0);
+  mem[1] = probe(buf[1], page, op, 1);
+  len = z80_decode(buf[0], &opcode[0]);
+  if (len == 0 || z80_decode(buf[1], &opcode[1]) != len) {
+    printf("    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } },"
+        " /* %02X invalid */\n", op);
+    return;
+  }
+  strcpy(mnemonic, z80_to_string(&opcode[0]));
+  timing(page, (uint8_t) op, &tm);
+
+  printf("    { %u, %d, %d, 0, {", opcode[0].operation,
+      len - s_prefixLen[page], opcode[0].argc);
+  text[0] = '\0';
+  for (int i = 0; i < 2; i++) {
+    const Z80_Arg* arg = &opcode[0].args[i];
+    int patch = pt_None;
+    uint16_t v = 0;
+    uint8_t flags = 0;
+    if (i < opcode[0].argc) {
+      flags = arg->flags;
+      patch = patchFor(arg, &opcode[1].args[i], mem[0], mem[1], page);
+      v = (patch & 0xf0) == pt_Byte || (patch & 0xf0) == pt_Word ? 0 : arg->v;
+    }
+    printf(" { 0x%02x, %u, 0x%02x }%s", flags, v, patch, i == 0 ? "," : "");
+    if (i < opcode[0].argc) {
+      strcat(text, i == 0 ? " " : ",");
+      describeArg(text + strlen(text), &opcode[0], i, patch);
+    }
+  }
+  /* the table leaves out the prefixes; z80_decode() adds 4T and 1M each */
+  printf(" }, { %d, %d, %d, %d } }", tm.t - 4 * s_prefixLen[page],
+      tm.t_taken - 4 * s_prefixLen[page], tm.m - s_prefixLen[page],
+      tm.m_taken - s_prefixLen[page]);
+  mnemonic[strcspn(mnemonic, " ")] = '\0';
+  printf(", /* %02X %s%s */\n", op, mnemonic, text);
+}
+
+/*
+ * Length nibble for an opcode: 0 if invalid, the length counted from the
+ * page's opcode byte, or 8 + page for a prefix that continues on page.
+ */
+static int lengthNibble(int page, int op) {
+  uint8_t buf[8];
+  Z80_OpCode opcode;
+  int next = nextPage(page, op);
+  int len;
+  if (next != pg_Main) return 8 + next;
+  probe(buf, page, op, 0);
+  len = z80_decode(buf, &opcode);
+  return len == 0 ? 0 : len - s_prefixLen[page];
+}
+
+int main(void) {
+  printf("/* Generated by tools/z80gen.c; do not edit. */\n");
+  printf("#ifndef z80tables_h\n#define z80tables_h\n\n");
+  printf("enum { pg_Main, pg_CB, pg_ED, pg_DD, pg_FD, pg_DDCB, pg_FDCB, pg_Count };\n");
+  printf("enum { pt_None = 0x00, pt_Byte = 0x10, pt_Word = 0x20, pt_Disp = 0x30 };\n\n");
+  printf("typedef struct {\n  uint8_t flags;\n  uint8_t v;\n  uint8_t patch;\n} Z80_ArgTemplate;\n\n");
+  printf("typedef struct {\n  uint8_t operation;\n  uint8_t len;\n  uint8_t argc;\n"
+      "  uint8_t next;\n  Z80_ArgTemplate args[2];\n  Z80_Timing timing;\n"
+      "} Z80_TableEntry;\n\n");
+
+  printf("static const uint8_t s_opOffset[pg_Count] = {");
+  for (int page = 0; page < pg_Count; page++) {
+    printf(" %d%s", s_opOffset[page], page < pg_Count - 1 ? "," : " };\n\n");
+  }
+
+  printf("static const Z80_TableEntry s_page[pg_Count][256] = {\n");
+  for (int page = 0; page < pg_Count; page++) {
+    printf("  { /* %s */\n", s_pageNames[page]);
+    for (int op = 0; op < 256; op++) {
+      emitEntry(page, op);
+    }
+    printf("  }%s\n", page < pg_Count - 1 ? "," : "");
+  }
+  printf("};\n\n");
+
+  printf("static const uint8_t s_length[pg_Count][128] = {\n");
+  for (int page = 0; page < pg_Count; page++) {
+    printf("  { /* %s */", s_pageNames[page]);
+    for (int op = 0; op < 256; op += 2) {
+      printf("%s0x%x%x%s", op % 32 == 0 ? "\n    " : " ", lengthNibble(page, op + 1),
+          lengthNibble(page, op), op < 254 ? "," : "\n");
+    }
+    printf("  }%s\n", page < pg_Count - 1 ? "," : "");
+  }
+  printf("};\n\n#endif /* z80tables_h */\n");
+  return 0;
+}
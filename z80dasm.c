@@ -3,6 +3,10 @@
 
 #include "z80dasm.h"
 
+#if !defined(Z80DASM_SWITCH_ONLY)
+#include "z80tables.h"
+#endif
+
 static const char* s_mnemonics[] = {
   "ADC", "ADD", "AND", "BIT", "CALL", "CCF", "CP", "CPD",
   "CPDR", "CPI", "CPIR", "CPL", "DAA", "DEC", "DI", "DJNZ",
@@ -35,25 +39,25 @@ static int argLength(Z80_Arg arg) {
   return 0; 
 }
 
-static Z80_OpCode* opCode0(int level, Z80_Operation op) {
-  Z80_OpCode* opcode = (Z80_OpCode *) malloc(sizeof(Z80_OpCode));
+static Z80_OpCode* opCode0(Z80_OpCode* opcode, int level, Z80_Operation op) {
   opcode->len = level + 1;
   opcode->argc = 0;
   opcode->operation = op;
   return opcode;
 }
 
-static Z80_OpCode* opCode1(int level, Z80_Operation op, Z80_Arg arg) {
-  Z80_OpCode* opcode = opCode0(level, op);
+static Z80_OpCode* opCode1(Z80_OpCode* opcode, int level, Z80_Operation op, 
+    Z80_Arg arg) {
+  opCode0(opcode, level, op);
   opcode->len += argLength(arg);
   opcode->argc = 1;
   opcode->args[0] = arg;
   return opcode;
 }
 
-static Z80_OpCode* opCode2(int level, Z80_Operation op, 
+static Z80_OpCode* opCode2(Z80_OpCode* opcode, int level, Z80_Operation op, 
     Z80_Arg arg_a, Z80_Arg arg_b) {
-  Z80_OpCode* opcode = opCode0(level, op);
+  opCode0(opcode, level, op);
   opcode->len += argLength(arg_a) + argLength(arg_b);
   opcode->argc = 2;
   opcode->args[0] = arg_a;
@@ -155,305 +159,308 @@ static Z80_Arg literal(uint8_t b) {
   return arg;  
 }
 
-static Z80_OpCode* disassemblePageXX(int level, Z80_Operand ireg, uint8_t* mem);
-static Z80_OpCode* disassemblePageCB(int level, Z80_Operand ireg, uint8_t* mem);
-static Z80_OpCode* disassemblePageED(int level, Z80_Operand ireg, uint8_t* mem);
+static Z80_OpCode* disassemblePageXX(Z80_OpCode* opcode, int level, Z80_Operand ireg, const uint8_t* mem);
+static Z80_OpCode* disassemblePageCB(Z80_OpCode* opcode, int level, Z80_Operand ireg, const uint8_t* mem);
+static Z80_OpCode* disassemblePageED(Z80_OpCode* opcode, int level, Z80_Operand ireg, const uint8_t* mem);
 
-static Z80_OpCode* disassembleSection0(int level, Z80_Operand ireg, uint8_t* mem) {
+static Z80_OpCode* disassembleSection0(Z80_OpCode* opcode, int level, Z80_Operand ireg, const uint8_t* mem) {
   uint8_t op = mem[0];
   switch (op & 0x7) {
     case 0:
       switch ((op>>3) & 0x7) {
         case 0:
-          return opCode0(level, op_NOP);
+          return opCode0(opcode, level, op_NOP);
         case 1:
-          return opCode2(level, op_EX, register_explicit(reg_AF), register_explicit(reg_AAF));
+          return opCode2(opcode, level, op_EX, register_explicit(reg_AF), register_explicit(reg_AAF));
         case 2:
-          return opCode1(level, op_DJNZ, relative_address(mem[1]));
+          return opCode1(opcode, level, op_DJNZ, relative_address(mem[1]));
         case 3:
-          return opCode1(level, op_JR, relative_address(mem[1]));
+          return opCode1(opcode, level, op_JR, relative_address(mem[1]));
         default:
-          return opCode2(level, op_JR, flag_f((op>>3) & 0x3), relative_address(mem[1]));
+          return opCode2(opcode, level, op_JR, flag_f((op>>3) & 0x3), relative_address(mem[1]));
       }
     case 1:
       if (((op>>3) & 0x1) == 0) {
-        return opCode2(level, op_LD, register_ss(ireg, (op>>4) & 0x3), absolute_address(mem[1], mem[2]));
+        return opCode2(opcode, level, op_LD, register_ss(ireg, (op>>4) & 0x3), absolute_address(mem[1], mem[2]));
       }
       else {
-        return opCode2(level, op_ADD, register_explicit(ireg), register_ss(ireg, (op>>4) & 0x3));
+        return opCode2(opcode, level, op_ADD, register_explicit(ireg), register_ss(ireg, (op>>4) & 0x3));
       }
     case 2:
       switch ((op>>3) & 0x7) {
         case 0:
-          return opCode2(level, op_LD, register_indirect(reg_BC), register_explicit(reg_A));
+          return opCode2(opcode, level, op_LD, register_indirect(reg_BC), register_explicit(reg_A));
         case 1:
-          return opCode2(level, op_LD, register_explicit(reg_A), register_indirect(reg_BC));
+          return opCode2(opcode, level, op_LD, register_explicit(reg_A), register_indirect(reg_BC));
         case 2:
-          return opCode2(level, op_LD, register_indirect(reg_DE), register_explicit(reg_A));
+          return opCode2(opcode, level, op_LD, register_indirect(reg_DE), register_explicit(reg_A));
         case 3:
-          return opCode2(level, op_LD, register_explicit(reg_A), register_indirect(reg_DE));
+          return opCode2(opcode, level, op_LD, register_explicit(reg_A), register_indirect(reg_DE));
         case 4:
-          return opCode2(level, op_LD, indirect_address(mem[1], mem[2]), register_explicit(ireg));
+          return opCode2(opcode, level, op_LD, indirect_address(mem[1], mem[2]), register_explicit(ireg));
         case 5:
-          return opCode2(level, op_LD, register_explicit(ireg), indirect_address(mem[1], mem[2]));
+          return opCode2(opcode, level, op_LD, register_explicit(ireg), indirect_address(mem[1], mem[2]));
         case 6:
-          return opCode2(level, op_LD, indirect_address(mem[1], mem[2]), register_explicit(reg_A));
+          return opCode2(opcode, level, op_LD, indirect_address(mem[1], mem[2]), register_explicit(reg_A));
         case 7:
-          return opCode2(level, op_LD, register_explicit(reg_A), indirect_address(mem[1], mem[2]));
+          return opCode2(opcode, level, op_LD, register_explicit(reg_A), indirect_address(mem[1], mem[2]));
       }
     case 3:
-      return opCode1(level, ((op>>3) & 0x1) == 0 ? op_INC : op_DEC, register_ss(ireg, (op>>4) & 3));
+      return opCode1(opcode, level, ((op>>3) & 0x1) == 0 ? op_INC : op_DEC, register_ss(ireg, (op>>4) & 3));
     case 4:
-      return opCode1(level, op_INC, register_r(ireg, mem[1], (op>>3) & 0x7));
+      return opCode1(opcode, level, op_INC, register_r(ireg, mem[1], (op>>3) & 0x7));
     case 5:
-      return opCode1(level, op_DEC, register_r(ireg, mem[1], (op>>3) & 0x7));
+      return opCode1(opcode, level, op_DEC, register_r(ireg, mem[1], (op>>3) & 0x7));
     case 6:
-      return opCode2(level, op_LD, register_r(ireg, mem[1], (op>>3) & 0x7), immediate(mem[1]));
+      return opCode2(opcode, level, op_LD, register_r(ireg, mem[1], (op>>3) & 0x7), 
+          immediate(mem[((op>>3) & 0x7) == 6 && ireg != reg_HL ? 2 : 1]));
     case 7:
       switch ((op>>3) & 0x7) {
         case 0:
-          return opCode0(level, op_RLCA);
+          return opCode0(opcode, level, op_RLCA);
         case 1:
-          return opCode0(level, op_RRCA);
+          return opCode0(opcode, level, op_RRCA);
         case 2:
-          return opCode0(level, op_RLA);
+          return opCode0(opcode, level, op_RLA);
         case 3:
-          return opCode0(level, op_RRA);
+          return opCode0(opcode, level, op_RRA);
         case 4:
-          return opCode0(level, op_DAA);
+          return opCode0(opcode, level, op_DAA);
         case 5:
-          return opCode0(level, op_CPL);
+          return opCode0(opcode, level, op_CPL);
         case 6:
-          return opCode0(level, op_SCF);
+          return opCode0(opcode, level, op_SCF);
         case 7:
-          return opCode0(level, op_CCF);
+          return opCode0(opcode, level, op_CCF);
       }
   }
   return NULL;
 }
 
-static Z80_OpCode* disassembleSection1(int level, Z80_Operand ireg, uint8_t* mem) {
+static Z80_OpCode* disassembleSection1(Z80_OpCode* opcode, int level, Z80_Operand ireg, const uint8_t* mem) {
   uint8_t op = mem[0];
   if (op == 0x76) {
-    return opCode0(level, op_HALT);
+    return opCode0(opcode, level, op_HALT);
   }
-  return opCode2(level, op_LD, register_r(ireg, mem[1], (op>>3) & 0x7), 
+  return opCode2(opcode, level, op_LD, register_r(ireg, mem[1], (op>>3) & 0x7), 
       register_r(ireg, mem[1], op & 0x7));
 }
 
-static Z80_OpCode* disassembleSection2(int level, Z80_Operand ireg, uint8_t* mem) {
+static Z80_OpCode* disassembleSection2(Z80_OpCode* opcode, int level, Z80_Operand ireg, const uint8_t* mem) {
   uint8_t op = mem[0];
   switch ((op>>3) & 0x7) {
     case 0:
-      return opCode2(level, op_ADD, register_explicit(reg_A), register_r(ireg, mem[1], op & 0x7));
+      return opCode2(opcode, level, op_ADD, register_explicit(reg_A), register_r(ireg, mem[1], op & 0x7));
     case 1:
-      return opCode2(level, op_ADC, register_explicit(reg_A), register_r(ireg, mem[1], op & 0x7));
+      return opCode2(opcode, level, op_ADC, register_explicit(reg_A), register_r(ireg, mem[1], op & 0x7));
     case 2:
-      return opCode1(level, op_SUB, register_r(ireg, mem[1], op & 0x7));
+      return opCode1(opcode, level, op_SUB, register_r(ireg, mem[1], op & 0x7));
     case 3:
-      return opCode2(level, op_SBC, register_explicit(reg_A), register_r(ireg, mem[1], op & 0x7));
+      return opCode2(opcode, level, op_SBC, register_explicit(reg_A), register_r(ireg, mem[1], op & 0x7));
     case 4:
-      return opCode1(level, op_AND, register_r(ireg, mem[1], op & 0x7));
+      return opCode1(opcode, level, op_AND, register_r(ireg, mem[1], op & 0x7));
     case 5:
-      return opCode1(level, op_XOR, register_r(ireg, mem[1], op & 0x7));
+      return opCode1(opcode, level, op_XOR, register_r(ireg, mem[1], op & 0x7));
     case 6:
-      return opCode1(level, op_OR, register_r(ireg, mem[1], op & 0x7));
+      return opCode1(opcode, level, op_OR, register_r(ireg, mem[1], op & 0x7));
     case 7:
-      return opCode1(level, op_CP, register_r(ireg, mem[1], op & 0x7));
+      return opCode1(opcode, level, op_CP, register_r(ireg, mem[1], op & 0x7));
   }
   return NULL;
 }
 
-static Z80_OpCode* disassembleSection3(int level, Z80_Operand ireg, uint8_t* mem) {
+static Z80_OpCode* disassembleSection3(Z80_OpCode* opcode, int level, Z80_Operand ireg, const uint8_t* mem) {
   uint8_t op = mem[0];
   switch (op & 0x7) {
     case 0:
-      return opCode1(level, op_RET, flag_f((op>>3) & 0x7));
+      return opCode1(opcode, level, op_RET, flag_f((op>>3) & 0x7));
     case 1:
       if (((op>>3) & 0x1) == 0) {
-        return opCode1(level, op_POP, register_qq(ireg, (op>>4) & 0x3));
+        return opCode1(opcode, level, op_POP, register_qq(ireg, (op>>4) & 0x3));
       }
       else {
         switch ((op>>4) & 0x3) {
           case 0:
-            return opCode0(level, op_RET);
+            return opCode0(opcode, level, op_RET);
           case 1:
-            return opCode0(level, op_EXX);
+            return opCode0(opcode, level, op_EXX);
           case 2:
-            return opCode1(level, op_JP, register_indirect(ireg));
+            return opCode1(opcode, level, op_JP, register_indirect(ireg));
           case 3:
-            return opCode2(level, op_LD, register_explicit(reg_SP), register_explicit(ireg));
+            return opCode2(opcode, level, op_LD, register_explicit(reg_SP), register_explicit(ireg));
         }
       }
     case 2:
-      return opCode2(level, op_JP, flag_f((op>>3) & 0x7), absolute_address(mem[1], mem[2]));      
+      return opCode2(opcode, level, op_JP, flag_f((op>>3) & 0x7), absolute_address(mem[1], mem[2]));      
     case 3:
       switch ((op>>3) & 0x7) {
         case 0:
-          return opCode1(level, op_JP, absolute_address(mem[1], mem[2]));
+          return opCode1(opcode, level, op_JP, absolute_address(mem[1], mem[2]));
         case 1:
-          return disassemblePageCB(level + 1, ireg, mem + 1);
+          return disassemblePageCB(opcode, level + 1, ireg, mem + 1);
         case 2:
-          return opCode2(level, op_OUT, immediate(mem[1]), register_explicit(reg_A));
+          return opCode2(opcode, level, op_OUT, immediate(mem[1]), register_explicit(reg_A));
         case 3:
-          return opCode2(level, op_IN, register_explicit(reg_A), immediate(mem[1]));
+          return opCode2(opcode, level, op_IN, register_explicit(reg_A), immediate(mem[1]));
         case 4:
-          return opCode2(level, op_EX, register_indirect(reg_SP), register_explicit(ireg));
+          return opCode2(opcode, level, op_EX, register_indirect(reg_SP), register_explicit(ireg));
         case 5:
-          return opCode2(level, op_EX, register_explicit(reg_DE), register_explicit(reg_HL));
+          return opCode2(opcode, level, op_EX, register_explicit(reg_DE), register_explicit(reg_HL));
         case 6:
-          return opCode0(level, op_DI);
+          return opCode0(opcode, level, op_DI);
         case 7:
-          return opCode0(level, op_EI);
+          return opCode0(opcode, level, op_EI);
       }
     case 4:
-      return opCode2(level, op_CALL, flag_f((op>>3) & 0x7), absolute_address(mem[1], mem[2]));      
+      return opCode2(opcode, level, op_CALL, flag_f((op>>3) & 0x7), absolute_address(mem[1], mem[2]));      
     case 5:
       if (((op>>3) & 0x1) == 0) {
-        return opCode1(level, op_PUSH, register_qq(ireg, (op>>4) & 0x3));
+        return opCode1(opcode, level, op_PUSH, register_qq(ireg, (op>>4) & 0x3));
       }
       else {
         switch ((op>>4) & 0x3) {
           case 0:
-            return opCode1(level, op_CALL, absolute_address(mem[1], mem[2]));
+            return opCode1(opcode, level, op_CALL, absolute_address(mem[1], mem[2]));
           case 1:
-            return disassemblePageXX(level + 1, reg_IX, mem + 1);
+            return disassemblePageXX(opcode, level + 1, reg_IX, mem + 1);
           case 2:
-            return disassemblePageED(level + 1, ireg, mem + 1);
+            /* DD or FD leaves the ED page alone */
+            return disassemblePageED(opcode, level + 1, reg_HL, mem + 1);
           case 3:
-            return disassemblePageXX(level + 1, reg_IY, mem + 1);
+            return disassemblePageXX(opcode, level + 1, reg_IY, mem + 1);
         }
       }
     case 6:
       switch ((op>>3) & 0x7) {
         case 0:
-          return opCode2(level, op_ADD, register_explicit(reg_A), immediate(mem[1]));
+          return opCode2(opcode, level, op_ADD, register_explicit(reg_A), immediate(mem[1]));
         case 1:
-          return opCode2(level, op_ADC, register_explicit(reg_A), immediate(mem[1]));
+          return opCode2(opcode, level, op_ADC, register_explicit(reg_A), immediate(mem[1]));
         case 2:
-          return opCode1(level, op_SUB, immediate(mem[1]));
+          return opCode1(opcode, level, op_SUB, immediate(mem[1]));
         case 3:
-          return opCode2(level, op_SBC, register_explicit(reg_A), immediate(mem[1]));
+          return opCode2(opcode, level, op_SBC, register_explicit(reg_A), immediate(mem[1]));
         case 4:
-          return opCode1(level, op_AND, immediate(mem[1]));
+          return opCode1(opcode, level, op_AND, immediate(mem[1]));
         case 5:
-          return opCode1(level, op_XOR, immediate(mem[1]));
+          return opCode1(opcode, level, op_XOR, immediate(mem[1]));
         case 6:
-          return opCode1(level, op_OR, immediate(mem[1]));
+          return opCode1(opcode, level, op_OR, immediate(mem[1]));
         case 7:
-          return opCode1(level, op_CP, immediate(mem[1]));
+          return opCode1(opcode, level, op_CP, immediate(mem[1]));
       }
     case 7:
-      return opCode1(level, op_RST, zero_page_address(8 * ((op>>3) & 0x7)));
+      return opCode1(opcode, level, op_RST, zero_page_address(8 * ((op>>3) & 0x7)));
   }
   return NULL;
 }
 
-static Z80_OpCode* disassemblePageXX(int level, Z80_Operand ireg, uint8_t* mem) {
+static Z80_OpCode* disassemblePageXX(Z80_OpCode* opcode, int level, Z80_Operand ireg, const uint8_t* mem) {
   uint8_t op = mem[0];
   if ((op & 0xc0) == 0) {
-    return disassembleSection0(level, ireg, mem);
+    return disassembleSection0(opcode, level, ireg, mem);
   }
   else if ((op & 0xc0) == 0x40) {
-    return disassembleSection1(level, ireg, mem);    
+    return disassembleSection1(opcode, level, ireg, mem);    
   }
   else if ((op & 0xc0) == 0x80) {
-    return disassembleSection2(level, ireg, mem);        
+    return disassembleSection2(opcode, level, ireg, mem);        
   }
   else {
-    return disassembleSection3(level, ireg, mem);        
+    return disassembleSection3(opcode, level, ireg, mem);        
   }  
 }
 
-static Z80_OpCode* disassemblePageCB(int level, Z80_Operand ireg, uint8_t* mem) {
+static Z80_OpCode* disassemblePageCB(Z80_OpCode* opcode, int level, Z80_Operand ireg, const uint8_t* mem) {
   int indexed = ireg != reg_HL;
   uint8_t op = indexed ? mem[1] : mem[0];
+  uint8_t r = indexed ? 6 : op & 0x7;
   switch ((op >> 6) & 0x3) {
     case 0:
       switch ((op>>3) & 0x7) {
         case 0:
-          return opCode1(level, op_RLC, register_r(ireg, mem[0], op & 0x7));
+          return opCode1(opcode, level, op_RLC, register_r(ireg, mem[0], r));
         case 1:
-          return opCode1(level, op_RRC, register_r(ireg, mem[0], op & 0x7));
+          return opCode1(opcode, level, op_RRC, register_r(ireg, mem[0], r));
         case 2:
-          return opCode1(level, op_RL, register_r(ireg, mem[0], op & 0x7));
+          return opCode1(opcode, level, op_RL, register_r(ireg, mem[0], r));
         case 3:
-          return opCode1(level, op_RR, register_r(ireg, mem[0], op & 0x7));
+          return opCode1(opcode, level, op_RR, register_r(ireg, mem[0], r));
         case 4:
-          return opCode1(level, op_SLA, register_r(ireg, mem[0], op & 0x7));
+          return opCode1(opcode, level, op_SLA, register_r(ireg, mem[0], r));
         case 5:
-          return opCode1(level, op_SRA, register_r(ireg, mem[0], op & 0x7));
+          return opCode1(opcode, level, op_SRA, register_r(ireg, mem[0], r));
         case 6:
           return NULL;
         case 7:  
-          return opCode1(level, op_SRL, register_r(ireg, mem[0], op & 0x7));
+          return opCode1(opcode, level, op_SRL, register_r(ireg, mem[0], r));
       }
     case 1:
-      return opCode2(level, op_BIT, literal((op>>3) & 0x7), register_r(ireg, mem[0], op & 0x7));
+      return opCode2(opcode, level, op_BIT, literal((op>>3) & 0x7), register_r(ireg, mem[0], r));
     case 2:
-      return opCode2(level, op_RES, literal((op>>3) & 0x7), register_r(ireg, mem[0], op & 0x7));
+      return opCode2(opcode, level, op_RES, literal((op>>3) & 0x7), register_r(ireg, mem[0], r));
     case 3:
-      return opCode2(level, op_SET, literal((op>>3) & 0x7), register_r(ireg, mem[0], op & 0x7));
+      return opCode2(opcode, level, op_SET, literal((op>>3) & 0x7), register_r(ireg, mem[0], r));
   }
 
   return NULL;
 }
  
-static Z80_OpCode* disassemblePageED(int level, Z80_Operand ireg, uint8_t* mem) {
+static Z80_OpCode* disassemblePageED(Z80_OpCode* opcode, int level, Z80_Operand ireg, const uint8_t* mem) {
   uint8_t op = mem[0];
   switch ((op>>6) & 0x3) {
     case 1:
       switch (op & 0x7) {
         case 0:
           if (((op>>3) & 0x7) == 6) return NULL;
-          return opCode2(level, op_IN, register_r(ireg, 0, (op>>3) & 0x7), register_indirect(reg_C));
+          return opCode2(opcode, level, op_IN, register_r(ireg, 0, (op>>3) & 0x7), register_indirect(reg_C));
         case 1:
           if (((op>>3) & 0x7) == 6) return NULL;
-          return opCode2(level, op_OUT, register_indirect(reg_C), register_r(ireg, 0, (op>>3) & 0x7));
+          return opCode2(opcode, level, op_OUT, register_indirect(reg_C), register_r(ireg, 0, (op>>3) & 0x7));
         case 2:
           if (((op>>3) & 0x1) == 0) {
-            return opCode2(level, op_SBC, register_explicit(reg_HL), register_ss(ireg, (op>>4) & 0x3));
+            return opCode2(opcode, level, op_SBC, register_explicit(reg_HL), register_ss(ireg, (op>>4) & 0x3));
           }
           else {
-            return opCode2(level, op_ADC, register_explicit(reg_HL), register_ss(ireg, (op>>4) & 0x3));        
+            return opCode2(opcode, level, op_ADC, register_explicit(reg_HL), register_ss(ireg, (op>>4) & 0x3));        
           }
         case 3:
           if (((op>>3) & 0x1) == 0) {
-            return opCode2(level, op_LD, indirect_address(mem[1], mem[2]), register_ss(ireg, (op>>4) & 0x3));
+            return opCode2(opcode, level, op_LD, indirect_address(mem[1], mem[2]), register_ss(ireg, (op>>4) & 0x3));
           }
           else {
-            return opCode2(level, op_LD, register_ss(ireg, (op>>4) & 0x3), indirect_address(mem[1], mem[2]));        
+            return opCode2(opcode, level, op_LD, register_ss(ireg, (op>>4) & 0x3), indirect_address(mem[1], mem[2]));        
           }
         case 4:
-          return ((op>>3) & 0x7) == 0 ? opCode0(level, op_NEG) : NULL;
+          return ((op>>3) & 0x7) == 0 ? opCode0(opcode, level, op_NEG) : NULL;
         case 5:
           if (((op>>3) & 0x7) > 1) return NULL;
-          return ((op>>3) & 0x7) ? opCode0(level, op_RETI) : opCode0(level, op_RETN);
+          return ((op>>3) & 0x7) ? opCode0(opcode, level, op_RETI) : opCode0(opcode, level, op_RETN);
         case 6:
           switch ((op>>3) & 0x7) {
             case 0:
-              return opCode1(level, op_IM, literal(0));
+              return opCode1(opcode, level, op_IM, literal(0));
             case 2:
-              return opCode1(level, op_IM, literal(1));
+              return opCode1(opcode, level, op_IM, literal(1));
             case 3:
-              return opCode1(level, op_IM, literal(2));
+              return opCode1(opcode, level, op_IM, literal(2));
             default:
               return NULL;
           }
         case 7:
           switch ((op>>3) & 0x7) {
             case 0:
-              return opCode2(level, op_LD, register_explicit(reg_I), register_explicit(reg_A));
+              return opCode2(opcode, level, op_LD, register_explicit(reg_I), register_explicit(reg_A));
             case 1:
-              return opCode2(level, op_LD, register_explicit(reg_R), register_explicit(reg_A));
+              return opCode2(opcode, level, op_LD, register_explicit(reg_R), register_explicit(reg_A));
             case 2:
-              return opCode2(level, op_LD, register_explicit(reg_A), register_explicit(reg_I));
+              return opCode2(opcode, level, op_LD, register_explicit(reg_A), register_explicit(reg_I));
             case 3:
-              return opCode2(level, op_LD, register_explicit(reg_A), register_explicit(reg_R));
+              return opCode2(opcode, level, op_LD, register_explicit(reg_A), register_explicit(reg_R));
             case 4:
-              return opCode0(level, op_RRD);          
+              return opCode0(opcode, level, op_RRD);          
             case 5:
-              return opCode0(level, op_RLD);          
+              return opCode0(opcode, level, op_RLD);          
             default:
               return NULL;
           }
@@ -463,52 +470,52 @@ static Z80_OpCode* disassemblePageED(int level, Z80_Operand ireg, uint8_t* mem)
         case 0:
           switch ((op>>3) & 0x7) {
             case 4:
-              return opCode0(level, op_LDI);
+              return opCode0(opcode, level, op_LDI);
             case 5:
-              return opCode0(level, op_LDD);
+              return opCode0(opcode, level, op_LDD);
             case 6:
-              return opCode0(level, op_LDIR);
+              return opCode0(opcode, level, op_LDIR);
             case 7:
-              return opCode0(level, op_LDDR);
+              return opCode0(opcode, level, op_LDDR);
             default:
               return NULL;
           }                    
         case 1:
           switch ((op>>3) & 0x7) {
             case 4:
-              return opCode0(level, op_CPI);
+              return opCode0(opcode, level, op_CPI);
             case 5:
-              return opCode0(level, op_CPD);
+              return opCode0(opcode, level, op_CPD);
             case 6:
-              return opCode0(level, op_CPIR);
+              return opCode0(opcode, level, op_CPIR);
             case 7:
-              return opCode0(level, op_CPDR);
+              return opCode0(opcode, level, op_CPDR);
             default:
               return NULL;
           }
         case 2:
           switch ((op>>3) & 0x7) {
             case 4:
-              return opCode0(level, op_INI);
+              return opCode0(opcode, level, op_INI);
             case 5:
-              return opCode0(level, op_IND);
+              return opCode0(opcode, level, op_IND);
             case 6:
-              return opCode0(level, op_INIR);
+              return opCode0(opcode, level, op_INIR);
             case 7:
-              return opCode0(level, op_INDR);
+              return opCode0(opcode, level, op_INDR);
             default:
               return NULL;
           }
         case 3:
           switch ((op>>3) & 0x7) {
             case 4:
-              return opCode0(level, op_OUTI);
+              return opCode0(opcode, level, op_OUTI);
             case 5:
-              return opCode0(level, op_OUTD);
+              return opCode0(opcode, level, op_OUTD);
             case 6:
-              return opCode0(level, op_OTIR);
+              return opCode0(opcode, level, op_OTIR);
             case 7:
-              return opCode0(level, op_OTDR);
+              return opCode0(opcode, level, op_OTDR);
             default:
               return NULL;
           }
@@ -522,70 +529,369 @@ static Z80_OpCode* disassemblePageED(int level, Z80_Operand ireg, uint8_t* mem)
   return NULL;
 }
 
+int z80_decode_switch(const uint8_t* mem, Z80_OpCode* opcode) {
+  if (disassemblePageXX(opcode, 0, reg_HL, mem) == NULL) return 0;
+  memset(&opcode->timing, 0, sizeof(opcode->timing));
+  return opcode->len;
+}
+
+#if defined(Z80DASM_SWITCH_ONLY)
+
+int z80_decode(const uint8_t* mem, Z80_OpCode* opcode) {
+  return z80_decode_switch(mem, opcode);
+}
+
+#else
+
+static void patchArg(Z80_Arg* arg, const Z80_ArgTemplate* t, const uint8_t* mem) {
+  const uint8_t* p = mem + (t->patch & 0xf);
+  arg->flags = t->flags;
+  arg->v = t->v;
+  arg->displacement = 0;
+  switch (t->patch & 0xf0) {
+    case pt_Byte:
+      arg->v = p[0];
+      break;
+    case pt_Word:
+      arg->v = p[0] | (p[1] << 8);
+      break;
+    case pt_Disp:
+      arg->displacement = p[0];
+      break;
+  }
+}
+
+/*
+ * Follows prefix bytes to the table entry for the instruction at *mem,
+ * advancing *mem to the final page's view and counting prefixes in
+ * *level. Returns NULL if the instruction does not fit in avail bytes.
+ */
+static const Z80_TableEntry* lookup(const uint8_t** mem, int* level, size_t avail) {
+  const uint8_t* p = *mem;
+  const Z80_TableEntry* entry = &s_page[pg_Main][p[0]];
+  int n = 0;
+  while (entry->next != pg_Main) {
+    int page = entry->next;
+    p++;
+    n++;
+    if ((size_t) (n + s_opOffset[page]) >= avail) return NULL;
+    entry = &s_page[page][p[s_opOffset[page]]];
+  }
+  if ((size_t) (n + entry->len) > avail) return NULL;
+  *mem = p;
+  *level = n;
+  return entry;
+}
+
+static int fill(Z80_OpCode* opcode, const Z80_TableEntry* entry, 
+    const uint8_t* mem, int level) {
+  if (entry->len == 0) return 0;
+  opcode->len = level + entry->len;
+  opcode->operation = (Z80_Operation) entry->operation;
+  opcode->argc = entry->argc;
+  patchArg(&opcode->args[0], &entry->args[0], mem);
+  patchArg(&opcode->args[1], &entry->args[1], mem);
+  opcode->timing = entry->timing;
+  if (level != 0) {
+    /* each prefix byte is one more 4 T-state opcode fetch */
+    opcode->timing.t += 4 * level;
+    opcode->timing.t_taken += 4 * level;
+    opcode->timing.m += level;
+    opcode->timing.m_taken += level;
+  }
+  return opcode->len;
+}
+
+int z80_decode(const uint8_t* mem, Z80_OpCode* opcode) {
+  int level;
+  const Z80_TableEntry* entry = lookup(&mem, &level, (size_t) -1);
+  return fill(opcode, entry, mem, level);
+}
+
+static int lengthNibble(int page, uint8_t op) {
+  return (s_length[page][op >> 1] >> ((op & 1) << 2)) & 0xf;
+}
+
+int z80_length(const uint8_t* mem) {
+  int n = lengthNibble(pg_Main, mem[0]);
+  int level = 0;
+  while (n >= 8) {
+    int page = n - 8;
+    n = lengthNibble(page, mem[++level + s_opOffset[page]]);
+  }
+  return n == 0 ? 0 : level + n;
+}
+
+int z80_length_avail(const uint8_t* mem, size_t avail) {
+  int n;
+  int level = 0;
+  if (avail == 0) return -1;
+  n = lengthNibble(pg_Main, mem[0]);
+  while (n >= 8) {
+    int page = n - 8;
+    size_t at = (size_t) (++level + s_opOffset[page]);
+    if (at >= avail) return -1;
+    n = lengthNibble(page, mem[at]);
+  }
+  if (n == 0) return 0;
+  return (size_t) (level + n) > avail ? -1 : level + n;
+}
+
+static void resolveRelative(Z80_Arg* arg, uint16_t next) {
+  if (arg->flags == (am_Immediate | am_Displacement)) {
+    arg->flags |= am_Extended;
+    arg->displacement = (uint8_t) arg->v;
+    arg->v = (uint16_t) (next + (int8_t) arg->v);
+  }
+}
+
+size_t z80_disassemble_range(const uint8_t* mem, size_t len, uint16_t base_addr,
+    Z80_Line* lines, size_t max_lines, size_t* consumed) {
+  size_t offset = 0;
+  size_t n = 0;
+  while (offset < len && n < max_lines) {
+    Z80_Line* line = &lines[n++];
+    const uint8_t* p = mem + offset;
+    int level;
+    const Z80_TableEntry* entry = lookup(&p, &level, len - offset);
+    line->addr = (uint16_t) (base_addr + offset);
+    if (entry == NULL) {
+      line->status = ds_Truncated;
+      line->opcode.len = (uint8_t) (len - offset);
+      offset = len;
+    }
+    else if (fill(&line->opcode, entry, p, level) == 0) {
+      line->status = ds_Invalid;
+      line->opcode.len = 1;
+      offset++;
+    }
+    else {
+      line->status = ds_Ok;
+      offset += line->opcode.len;
+      resolveRelative(&line->opcode.args[0], (uint16_t) (base_addr + offset));
+      resolveRelative(&line->opcode.args[1], (uint16_t) (base_addr + offset));
+    }
+  }
+  if (consumed != NULL) *consumed = offset;
+  return n;
+}
+
+Z80_Cycles z80_block_cycles(const uint8_t* mem, uint16_t start, uint16_t end) {
+  Z80_Cycles cycles;
+  Z80_Line lines[64];
+  size_t len = end > start ? (size_t) (end - start) : 0;
+  size_t offset = 0;
+  memset(&cycles, 0, sizeof(cycles));
+  while (offset < len) {
+    size_t consumed;
+    size_t n = z80_disassemble_range(mem + start + offset, len - offset,
+        (uint16_t) (start + offset), lines, sizeof(lines) / sizeof(lines[0]),
+        &consumed);
+    for (size_t i = 0; i < n; i++) {
+      const Z80_Timing* t = &lines[i].opcode.timing;
+      if (lines[i].status != ds_Ok) {
+        cycles.invalid += lines[i].opcode.len;
+        continue;
+      }
+      cycles.insns++;
+      cycles.t_min += t->t < t->t_taken ? t->t : t->t_taken;
+      cycles.t_max += t->t > t->t_taken ? t->t : t->t_taken;
+      cycles.m_min += t->m < t->m_taken ? t->m : t->m_taken;
+      cycles.m_max += t->m > t->m_taken ? t->m : t->m_taken;
+    }
+    offset += consumed;
+  }
+  return cycles;
+}
+
+#endif
+
 Z80_OpCode* z80_disassemble(uint8_t* mem) {
-  Z80_OpCode *opcode = disassemblePageXX(0, reg_HL, mem);
+  Z80_OpCode* opcode = (Z80_OpCode *) malloc(sizeof(Z80_OpCode));
+  if (opcode != NULL && z80_decode(mem, opcode) == 0) {
+    free((void*) opcode);
+    return NULL;
+  }
   return opcode;
 }
 
-static const char* arg_to_string(Z80_Arg arg) {
-  static char buf[16];
-  memset(buf, 0, sizeof(buf));
-  if ((arg.flags & am_Register) != 0) {
-    if ((arg.flags & am_Indirect) != 0) {
-      if ((arg.flags & am_Indexed) != 0) {
-        snprintf(buf, sizeof(buf) -1, "(%s%+d)", s_operands[arg.v], 
-            (signed char) arg.displacement);
-      }
-      else {
-        snprintf(buf, sizeof(buf) -1, "(%s)", s_operands[arg.v]);
+static const char s_hexUpper[] = "0123456789ABCDEF";
+static const char s_hexLower[] = "0123456789abcdef";
+
+static char* putChar(char* p, char* end, char c) {
+  if (p < end) *p++ = c;
+  return p;
+}
+
+static char* putName(char* p, char* end, const char* s, int syntax) {
+  if ((syntax & fmt_Lower) != 0) {
+    for (; *s != '\0' && p < end; s++) {
+      *p++ = (*s >= 'A' && *s <= 'Z') ? *s + ('a' - 'A') : *s;
+    }
+  }
+  else {
+    for (; *s != '\0' && p < end; s++) {
+      *p++ = *s;
+    }
+  }
+  return p;
+}
+
+static char* putHex(char* p, char* end, uint16_t v, int syntax) {
+  const char* digits = (syntax & fmt_Lower) != 0 ? s_hexLower : s_hexUpper;
+  int shift = 12;
+  while (shift > 0 && ((v >> shift) & 0xf) == 0) shift -= 4;
+  if ((syntax & fmt_HexDollar) != 0) {
+    p = putChar(p, end, '$');
+  }
+  else if ((syntax & fmt_HexSuffix) != 0) {
+    if (((v >> shift) & 0xf) > 9) p = putChar(p, end, '0');
+  }
+  else {
+    p = putChar(p, end, '0');
+    p = putChar(p, end, 'x');
+  }
+  for (; shift >= 0; shift -= 4) {
+    p = putChar(p, end, digits[(v >> shift) & 0xf]);
+  }
+  /* fmt_HexDollar wins when both are given */
+  if ((syntax & (fmt_HexDollar | fmt_HexSuffix)) == fmt_HexSuffix) {
+    p = putChar(p, end, (syntax & fmt_Lower) != 0 ? 'h' : 'H');
+  }
+  return p;
+}
+
+static char* putDecimal(char* p, char* end, unsigned v) {
+  char digits[5];
+  int n = 0;
+  do {
+    digits[n++] = '0' + v % 10;
+    v /= 10;
+  } while (v != 0);
+  while (n > 0) p = putChar(p, end, digits[--n]);
+  return p;
+}
+
+static char* putSigned(char* p, char* end, uint8_t v) {
+  int d = (int8_t) v;
+  p = putChar(p, end, d < 0 ? '-' : '+');
+  return putDecimal(p, end, (unsigned) (d < 0 ? -d : d));
+}
+
+static char* putAddress(char* p, char* end, uint16_t v, int syntax,
+    Z80_SymbolLookup lookup, const void* ctx) {
+  const char* name = lookup != NULL ? lookup(ctx, v) : NULL;
+  if (name != NULL) {
+    for (; *name != '\0' && p < end; name++) *p++ = *name;
+    return p;
+  }
+  return putHex(p, end, v, syntax);
+}
+
+static char* putArg(char* p, char* end, const Z80_Arg* arg, int port, int syntax,
+    Z80_SymbolLookup lookup, const void* ctx) {
+  if ((arg->flags & am_Register) != 0) {
+    if ((arg->flags & am_Indirect) != 0) {
+      p = putChar(p, end, '(');
+      p = putName(p, end, s_operands[arg->v], syntax);
+      if ((arg->flags & am_Indexed) != 0) {
+        p = putSigned(p, end, arg->displacement);
       }
+      p = putChar(p, end, ')');
     }
     else {
-      strncpy(buf, s_operands[arg.v], sizeof(buf) - 1);
+      p = putName(p, end, s_operands[arg->v], syntax);
     }
   }
-  else if ((arg.flags & am_Immediate) != 0) {
-    if ((arg.flags & am_Extended) != 0) {
-      snprintf(buf, sizeof(buf) - 1, "0x%X", arg.v);
+  else if ((arg->flags & am_Immediate) != 0) {
+    if ((arg->flags & am_Extended) != 0) {
+      if ((arg->flags & am_Indirect) != 0) {
+        p = putChar(p, end, '(');
+        p = putAddress(p, end, arg->v, syntax, lookup, ctx);
+        p = putChar(p, end, ')');
+      }
+      else {
+        p = putAddress(p, end, arg->v, syntax, lookup, ctx);
+      }
+    }
+    else if ((arg->flags & am_Displacement) != 0) {
+      p = putSigned(p, end, (uint8_t) arg->v);
     }
-    else if ((arg.flags & am_Displacement) != 0) {
-      snprintf(buf, sizeof(buf) - 1, "%+d", (signed char) arg.v);
+    else if (port) {
+      p = putChar(p, end, '(');
+      p = putHex(p, end, arg->v, syntax);
+      p = putChar(p, end, ')');
     }
     else {
-      snprintf(buf, sizeof(buf) - 1, "0x%X", arg.v);
+      p = putHex(p, end, arg->v, syntax);
     }
   }
-  else if ((arg.flags & am_Flag) != 0) {
-    if ((arg.flags & am_Implicit) != 0) {
-      snprintf(buf, sizeof(buf) - 1, "0x%X", arg.v);
+  else if ((arg->flags & am_Flag) != 0) {
+    if ((arg->flags & am_Implicit) != 0) {
+      p = putHex(p, end, arg->v, syntax);
     }
     else {
-      strncpy(buf, s_operands[arg.v], sizeof(buf) - 1);
+      p = putName(p, end, s_operands[arg->v], syntax);
+    }
+  }
+  else if ((arg->flags & am_Implicit) != 0) {
+    p = putDecimal(p, end, arg->v);
+  }
+  return p;
+}
+
+size_t z80_format_sym(const Z80_OpCode* opcode, int syntax,
+    Z80_SymbolLookup lookup, const void* ctx, char* buf, size_t cap) {
+  char* p = buf;
+  char* end;
+  if (cap == 0) return 0;
+  end = buf + cap - 1;
+  if (opcode != NULL) {
+    int port = opcode->operation == op_IN || opcode->operation == op_OUT;
+    p = putName(p, end, s_mnemonics[opcode->operation], syntax);
+    for (int i = 0; i < opcode->argc; i++) {
+      p = putChar(p, end, i == 0 ? ' ' : ',');
+      p = putArg(p, end, &opcode->args[i], port, syntax, lookup, ctx);
     }
   }
-  else if ((arg.flags & am_Implicit) != 0) {
-    snprintf(buf, sizeof(buf) - 1, "%d", arg.v);
+  *p = '\0';
+  return (size_t) (p - buf);
+}
+
+size_t z80_format_syntax(const Z80_OpCode* opcode, int syntax, 
+    char* buf, size_t cap) {
+  return z80_format_sym(opcode, syntax, NULL, NULL, buf, cap);
+}
+
+size_t z80_format_data(const uint8_t* mem, size_t len, int syntax, 
+    char* buf, size_t cap) {
+  char* p = buf;
+  char* end;
+  if (cap == 0) return 0;
+  end = buf + cap - 1;
+  p = putName(p, end, "DEFB", syntax);
+  for (size_t i = 0; i < len; i++) {
+    p = putChar(p, end, i == 0 ? ' ' : ',');
+    p = putHex(p, end, mem[i], syntax);
   }
+  *p = '\0';
+  return (size_t) (p - buf);
+}
 
-  return buf;
+size_t z80_format(const Z80_OpCode* opcode, char* buf, size_t cap) {
+  return z80_format_syntax(opcode, fmt_Zilog, buf, cap);
 }
 
 const char* z80_to_string(Z80_OpCode* opcode) {
   static char buf[80];
-  memset(buf, 0, sizeof(buf));
-  if (opcode == NULL) return buf;
-
-  strncat(buf, s_mnemonics[opcode->operation], sizeof(buf) - 1);
-  strncat(buf, " ", sizeof(buf) - 1);
-  for (int i = 0; i < opcode->argc; i++) {
-    strncat(buf, arg_to_string(opcode->args[i]), sizeof(buf) - 1);
-    if (i < opcode->argc - 1) {
-      strncat(buf, ",", sizeof(buf) - 1);
-    }          
-  }
+  z80_format(opcode, buf, sizeof(buf));
   return buf;  
 }
 
+const char* z80_mnemonic(Z80_Operation operation) {
+  return s_mnemonics[operation];
+}
+
 void z80_free(Z80_OpCode *opcode) {
   free((void*) opcode);
 }
@@ -120,24 +120,232 @@ typedef struct {
   uint8_t displacement; 
 } Z80_Arg;
 
+/*
+ * T-states and M-cycles of an instruction. The taken values apply when a
+ * conditional JR/JP/CALL/RET or DJNZ branches, or a block instruction
+ * repeats; otherwise they equal t and m.
+ */
+typedef struct {
+  uint8_t t;
+  uint8_t t_taken;
+  uint8_t m;
+  uint8_t m_taken;
+} Z80_Timing;
+
 typedef struct {
   uint8_t len;
   Z80_Operation operation;
   int argc;
   Z80_Arg args[2];
+  Z80_Timing timing;
 } Z80_OpCode;
 
+typedef enum {
+  fmt_Zilog = 0x0,
+  fmt_Lower = 0x1,
+  fmt_HexDollar = 0x2,
+  fmt_HexSuffix = 0x4
+} Z80_Syntax;
+
+typedef enum {
+  ds_Ok,
+  ds_Invalid,
+  ds_Truncated
+} Z80_Status;
+
+typedef struct {
+  uint16_t addr;
+  uint8_t status;
+  Z80_OpCode opcode;
+} Z80_Line;
+
+/* Static cost of a run of instructions, as from z80_block_cycles(). */
+typedef struct {
+  uint32_t insns;
+  uint32_t invalid;
+  uint32_t t_min;
+  uint32_t t_max;
+  uint32_t m_min;
+  uint32_t m_max;
+} Z80_Cycles;
+
+/* Returns the symbol naming addr, or NULL to print it as a number. */
+typedef const char* (*Z80_SymbolLookup)(const void* ctx, uint16_t addr);
+
+
+/*
+ * A decoded instruction packed into 64 bits: operation (bits 0-6), len
+ * (7-9), argc (10-11), a Z80_ArgKind for each argument (12-15, 16-19),
+ * each argument's v (20-35, 36-51) and the one displacement an
+ * instruction can carry (52-59).
+ */
+typedef uint64_t Z80_Packed;
+
+typedef enum {
+  pk_None,
+  pk_Register,
+  pk_RegisterIndirect,
+  pk_Indexed,
+  pk_Immediate,
+  pk_Address,
+  pk_AddressIndirect,
+  pk_Relative,
+  pk_RelativeResolved,
+  pk_Flag,
+  pk_Literal,
+  pk_ZeroPage,
+  pk_Count
+} Z80_ArgKind;
+
+/*
+ * Structure-of-arrays form of a decoded region. kinds holds the
+ * Z80_ArgKind of the first argument in its low nibble and of the second
+ * in its high nibble; lines that are not ds_Ok have no arguments.
+ */
+typedef struct {
+  size_t count;
+  size_t cap;
+  uint16_t* addr;
+  uint8_t* len;
+  uint8_t* status;
+  uint8_t* operation;
+  uint8_t* kinds;
+  uint16_t* v0;
+  uint16_t* v1;
+  uint8_t* displacement;
+} Z80_Batch;
 
 #if defined(__cplusplus)
 extern "C" {
 #endif
 
+/*
+ * Decodes the instruction at mem into the caller's opcode without
+ * allocating. Returns the instruction length, or 0 if the bytes at mem
+ * are not a valid instruction (opcode is then unspecified).
+ */
+int z80_decode(const uint8_t* mem, Z80_OpCode* opcode);
+
+/*
+ * Returns the length of the instruction at mem, or 0 if it is not valid,
+ * without decoding its operands. Like z80_decode() it reads on through
+ * any run of DD/FD prefixes, so mem must not end early; use
+ * z80_length_avail() on a buffer of known size.
+ */
+int z80_length(const uint8_t* mem);
+
+/*
+ * As z80_length(), reading none of the bytes from mem + avail on.
+ * Returns -1 if the instruction, prefixes included, does not fit in
+ * avail bytes.
+ */
+int z80_length_avail(const uint8_t* mem, size_t avail);
+
+/*
+ * The switch-tree decoder that z80tables.h is generated from. Produces
+ * the same results as z80_decode() except that timing is left zero; kept
+ * for tools/z80gen.c and the benchmarks.
+ */
+int z80_decode_switch(const uint8_t* mem, Z80_OpCode* opcode);
+
+/*
+ * Linear sweep over the len bytes at mem, which are located at base_addr,
+ * writing at most max_lines decoded lines. Never reads past mem + len:
+ * an instruction cut off by the end of the region is reported as
+ * ds_Truncated with opcode.len set to the bytes remaining, and an invalid
+ * opcode as a one byte ds_Invalid line. JR and DJNZ targets are resolved
+ * to absolute addresses (am_Extended is added; displacement keeps the
+ * offset). Returns the number of lines written and stores the number of
+ * bytes they cover in *consumed when it is not NULL.
+ */
+size_t z80_disassemble_range(const uint8_t* mem, size_t len, uint16_t base_addr,
+    Z80_Line* lines, size_t max_lines, size_t* consumed);
+
+/*
+ * Sums the timing of the instructions a linear sweep finds from start up
+ * to end in the 64 KiB image at mem, as a static estimate for straight-line
+ * code: t_min/m_min take every conditional the cheaper way and t_max/m_max
+ * the dearer, counting one pass of each block instruction. Bytes that do
+ * not decode are counted in invalid and add no time.
+ */
+Z80_Cycles z80_block_cycles(const uint8_t* mem, uint16_t start, uint16_t end);
+
 Z80_OpCode* z80_disassemble(uint8_t* mem);
 
+/*
+ * Formats opcode into buf, writing at most cap - 1 characters and a
+ * terminating NUL. Returns the number of characters written. Safe to call
+ * concurrently. syntax combines Z80_Syntax flags: fmt_Zilog gives
+ * uppercase with 0x-prefixed hex, fmt_Lower selects lowercase, and
+ * fmt_HexDollar or fmt_HexSuffix select $FF or 0FFH style hex. Given
+ * both, fmt_HexDollar wins.
+ */
+size_t z80_format_syntax(const Z80_OpCode* opcode, int syntax, 
+    char* buf, size_t cap);
+
+/*
+ * As z80_format_syntax(), but 16-bit addresses (absolute, indirect and
+ * resolved relative operands) are printed as the name lookup returns for
+ * them, if any. Names are printed as given, whatever the syntax.
+ */
+size_t z80_format_sym(const Z80_OpCode* opcode, int syntax,
+    Z80_SymbolLookup lookup, const void* ctx, char* buf, size_t cap);
+
+size_t z80_format(const Z80_OpCode* opcode, char* buf, size_t cap);
+
+/* Formats len bytes as a DEFB directive, e.g. for ds_Invalid lines. */
+size_t z80_format_data(const uint8_t* mem, size_t len, int syntax, 
+    char* buf, size_t cap);
+
+/*
+ * As z80_format() into a static buffer; not reentrant. The text differs
+ * from that of earlier versions: an instruction without operands has no
+ * trailing space after the mnemonic, (nn) operands keep their parentheses
+ * and IN/OUT port immediates print as (n), so "IN A,(0x12)" rather than
+ * "IN A,0x12".
+ */
 const char* z80_to_string(Z80_OpCode* opcode);
 
+/* The mnemonic of operation, in uppercase. */
+const char* z80_mnemonic(Z80_Operation operation);
+
 void z80_free(Z80_OpCode* opcode);
 
+/*
+ * Packs opcode into *packed. Returns 0, or -1 if it cannot be packed
+ * (an instruction padded past 7 bytes by redundant prefixes).
+ */
+int z80_pack(const Z80_OpCode* opcode, Z80_Packed* packed);
+
+/* Unpacks into *opcode; timing is not packed and comes back zero. */
+void z80_unpack(Z80_Packed packed, Z80_OpCode* opcode);
+
+Z80_Arg z80_packed_arg(Z80_Packed packed, int i);
+
+static inline Z80_Operation z80_packed_operation(Z80_Packed packed) {
+  return (Z80_Operation) (packed & 0x7f);
+}
+
+static inline int z80_packed_len(Z80_Packed packed) {
+  return (int) (packed >> 7) & 0x7;
+}
+
+static inline int z80_packed_argc(Z80_Packed packed) {
+  return (int) (packed >> 10) & 0x3;
+}
+
+/* Allocates arrays for cap lines. Returns 0, or -1 if memory is exhausted. */
+int z80_batch_init(Z80_Batch* batch, size_t cap);
+
+void z80_batch_free(Z80_Batch* batch);
+
+/*
+ * Sweeps the len bytes at mem, located at base_addr, appending lines to
+ * batch until it is full. Returns the number of bytes consumed.
+ */
+size_t z80_batch_decode(Z80_Batch* batch, const uint8_t* mem, size_t len,
+    uint16_t base_addr);
+
 #if defined(__cplusplus)
 }
 #endif
@@ -0,0 +1,160 @@
+#include <string.h>
+
+#include "z80dasm.h"
+
+#define LINE_BATCH 128
+
+static const uint8_t s_kindFlags[pk_Count] = {
+  0,
+  am_Register,
+  am_Register | am_Indirect,
+  am_Register | am_Indirect | am_Indexed,
+  am_Immediate,
+  am_Immediate | am_Extended,
+  am_Immediate | am_Extended | am_Indirect,
+  am_Immediate | am_Displacement,
+  am_Immediate | am_Extended | am_Displacement,
+  am_Flag,
+  am_Implicit,
+  am_Implicit | am_Flag
+};
+
+static const uint8_t s_kindOf[256] = {
+  [am_Register] = pk_Register,
+  [am_Register | am_Indirect] = pk_RegisterIndirect,
+  [am_Register | am_Indirect | am_Indexed] = pk_Indexed,
+  [am_Immediate] = pk_Immediate,
+  [am_Immediate | am_Extended] = pk_Address,
+  [am_Immediate | am_Extended | am_Indirect] = pk_AddressIndirect,
+  [am_Immediate | am_Displacement] = pk_Relative,
+  [am_Immediate | am_Extended | am_Displacement] = pk_RelativeResolved,
+  [am_Flag] = pk_Flag,
+  [am_Implicit] = pk_Literal,
+  [am_Implicit | am_Flag] = pk_ZeroPage
+};
+
+static int kindOf(const Z80_Arg* arg) {
+  int kind = s_kindOf[arg->flags];
+  return s_kindFlags[kind] == arg->flags ? kind : -1;
+}
+
+static int hasDisplacement(int kind) {
+  return kind == pk_Indexed || kind == pk_RelativeResolved;
+}
+
+int z80_pack(const Z80_OpCode* opcode, Z80_Packed* packed) {
+  Z80_Packed p;
+  int kinds[2] = { pk_None, pk_None };
+  uint8_t displacement = 0;
+  if (opcode->len == 0 || opcode->len > 7 || opcode->argc > 2) return -1;
+  for (int i = 0; i < opcode->argc; i++) {
+    kinds[i] = kindOf(&opcode->args[i]);
+    if (kinds[i] < 0) return -1;
+    if (hasDisplacement(kinds[i])) displacement = opcode->args[i].displacement;
+  }
+  p = (Z80_Packed) opcode->operation
+      | (Z80_Packed) opcode->len << 7
+      | (Z80_Packed) opcode->argc << 10
+      | (Z80_Packed) kinds[0] << 12
+      | (Z80_Packed) kinds[1] << 16
+      | (Z80_Packed) (kinds[0] != pk_None ? opcode->args[0].v : 0) << 20
+      | (Z80_Packed) (kinds[1] != pk_None ? opcode->args[1].v : 0) << 36
+      | (Z80_Packed) displacement << 52;
+  *packed = p;
+  return 0;
+}
+
+Z80_Arg z80_packed_arg(Z80_Packed packed, int i) {
+  Z80_Arg arg;
+  int kind = (int) (packed >> (12 + 4 * i)) & 0xf;
+  arg.flags = s_kindFlags[kind];
+  arg.v = (uint16_t) (packed >> (20 + 16 * i));
+  arg.displacement = hasDisplacement(kind) ? (uint8_t) (packed >> 52) : 0;
+  return arg;
+}
+
+void z80_unpack(Z80_Packed packed, Z80_OpCode* opcode) {
+  opcode->len = z80_packed_len(packed);
+  opcode->operation = z80_packed_operation(packed);
+  opcode->argc = z80_packed_argc(packed);
+  opcode->args[0] = z80_packed_arg(packed, 0);
+  opcode->args[1] = z80_packed_arg(packed, 1);
+  memset(&opcode->timing, 0, sizeof(opcode->timing));
+}
+
+int z80_batch_init(Z80_Batch* batch, size_t cap) {
+  memset(batch, 0, sizeof(*batch));
+  batch->addr = (uint16_t*) malloc(cap * sizeof(uint16_t));
+  batch->len = (uint8_t*) malloc(cap);
+  batch->status = (uint8_t*) malloc(cap);
+  batch->operation = (uint8_t*) malloc(cap);
+  batch->kinds = (uint8_t*) malloc(cap);
+  batch->v0 = (uint16_t*) malloc(cap * sizeof(uint16_t));
+  batch->v1 = (uint16_t*) malloc(cap * sizeof(uint16_t));
+  batch->displacement = (uint8_t*) malloc(cap);
+  batch->cap = cap;
+  if (batch->addr == NULL || batch->len == NULL || batch->status == NULL
+      || batch->operation == NULL || batch->kinds == NULL
+      || batch->v0 == NULL || batch->v1 == NULL || batch->displacement == NULL) {
+    z80_batch_free(batch);
+    return -1;
+  }
+  return 0;
+}
+
+void z80_batch_free(Z80_Batch* batch) {
+  free(batch->addr);
+  free(batch->len);
+  free(batch->status);
+  free(batch->operation);
+  free(batch->kinds);
+  free(batch->v0);
+  free(batch->v1);
+  free(batch->displacement);
+  memset(batch, 0, sizeof(*batch));
+}
+
+static void store(Z80_Batch* batch, size_t i, const Z80_Line* line) {
+  const Z80_OpCode* opcode = &line->opcode;
+  uint8_t kinds = 0;
+  uint8_t displacement = 0;
+  batch->addr[i] = line->addr;
+  batch->status[i] = line->status;
+  batch->len[i] = line->status == ds_Invalid ? 1 : opcode->len;
+  batch->v0[i] = 0;
+  batch->v1[i] = 0;
+  if (line->status != ds_Ok) {
+    batch->operation[i] = op_NOP;
+    batch->kinds[i] = 0;
+    batch->displacement[i] = 0;
+    return;
+  }
+  batch->operation[i] = (uint8_t) opcode->operation;
+  for (int k = 0; k < opcode->argc; k++) {
+    int kind = s_kindOf[opcode->args[k].flags];
+    kinds |= kind << (4 * k);
+    if (hasDisplacement(kind)) displacement = opcode->args[k].displacement;
+  }
+  if (opcode->argc > 0) batch->v0[i] = opcode->args[0].v;
+  if (opcode->argc > 1) batch->v1[i] = opcode->args[1].v;
+  batch->kinds[i] = kinds;
+  batch->displacement[i] = displacement;
+}
+
+size_t z80_batch_decode(Z80_Batch* batch, const uint8_t* mem, size_t len,
+    uint16_t base_addr) {
+  Z80_Line lines[LINE_BATCH];
+  size_t offset = 0;
+  while (offset < len && batch->count < batch->cap) {
+    size_t room = batch->cap - batch->count;
+    size_t consumed;
+    size_t n = z80_disassemble_range(mem + offset, len - offset,
+        (uint16_t) (base_addr + offset), lines,
+        room < LINE_BATCH ? room : LINE_BATCH, &consumed);
+    for (size_t i = 0; i < n; i++) {
+      store(batch, batch->count++, &lines[i]);
+    }
+    offset += consumed;
+  }
+  return offset;
+}
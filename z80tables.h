@@ -0,0 +1,1907 @@
+/* Generated by tools/z80gen.c; do not edit. */
+#ifndef z80tables_h
+#define z80tables_h
+
+enum { pg_Main, pg_CB, pg_ED, pg_DD, pg_FD, pg_DDCB, pg_FDCB, pg_Count };
+enum { pt_None = 0x00, pt_Byte = 0x10, pt_Word = 0x20, pt_Disp = 0x30 };
+
+typedef struct {
+  uint8_t flags;
+  uint8_t v;
+  uint8_t patch;
+} Z80_ArgTemplate;
+
+typedef struct {
+  uint8_t operation;
+  uint8_t len;
+  uint8_t argc;
+  uint8_t next;
+  Z80_ArgTemplate args[2];
+  Z80_Timing timing;
+} Z80_TableEntry;
+
+static const uint8_t s_opOffset[pg_Count] = { 0, 0, 0, 0, 0, 1, 1 };
+
+static const Z80_TableEntry s_page[pg_Count][256] = {
+  { /* pg_Main */
+    { 35, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 00 NOP */
+    { 29, 3, 2, 0, { { 0x01, 8, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* 01 LD BC,nn */
+    { 29, 1, 2, 0, { { 0x09, 8, 0x00 }, { 0x01, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* 02 LD (BC),A */
+    { 22, 1, 1, 0, { { 0x01, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 03 INC BC */
+    { 22, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 04 INC B */
+    { 13, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 05 DEC B */
+    { 29, 2, 2, 0, { { 0x01, 1, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 06 LD B,n */
+    { 52, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 07 RLCA */
+    { 17, 1, 2, 0, { { 0x01, 7, 0x00 }, { 0x01, 14, 0x00 } }, { 4, 4, 1, 1 } }, /* 08 EX AF,AF' */
+    { 1, 1, 2, 0, { { 0x01, 10, 0x00 }, { 0x01, 8, 0x00 } }, { 11, 11, 3, 3 } }, /* 09 ADD HL,BC */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x09, 8, 0x00 } }, { 7, 7, 2, 2 } }, /* 0A LD A,(BC) */
+    { 13, 1, 1, 0, { { 0x01, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 0B DEC BC */
+    { 22, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0C INC C */
+    { 13, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0D DEC C */
+    { 29, 2, 2, 0, { { 0x01, 2, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 0E LD C,n */
+    { 58, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0F RRCA */
+    { 15, 2, 1, 0, { { 0x82, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 8, 13, 2, 3 } }, /* 10 DJNZ e */
+    { 29, 3, 2, 0, { { 0x01, 9, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* 11 LD DE,nn */
+    { 29, 1, 2, 0, { { 0x09, 9, 0x00 }, { 0x01, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* 12 LD (DE),A */
+    { 22, 1, 1, 0, { { 0x01, 9, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 13 INC DE */
+    { 22, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 14 INC D */
+    { 13, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 15 DEC D */
+    { 29, 2, 2, 0, { { 0x01, 3, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 16 LD D,n */
+    { 49, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 17 RLA */
+    { 28, 2, 1, 0, { { 0x82, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 12, 12, 3, 3 } }, /* 18 JR e */
+    { 1, 1, 2, 0, { { 0x01, 10, 0x00 }, { 0x01, 9, 0x00 } }, { 11, 11, 3, 3 } }, /* 19 ADD HL,DE */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x09, 9, 0x00 } }, { 7, 7, 2, 2 } }, /* 1A LD A,(DE) */
+    { 13, 1, 1, 0, { { 0x01, 9, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 1B DEC DE */
+    { 22, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1C INC E */
+    { 13, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1D DEC E */
+    { 29, 2, 2, 0, { { 0x01, 4, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 1E LD E,n */
+    { 55, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1F RRA */
+    { 28, 2, 2, 0, { { 0x20, 17, 0x00 }, { 0x82, 0, 0x11 } }, { 7, 12, 2, 3 } }, /* 20 JR NZ,e */
+    { 29, 3, 2, 0, { { 0x01, 10, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* 21 LD HL,nn */
+    { 29, 3, 2, 0, { { 0x0e, 0, 0x21 }, { 0x01, 10, 0x00 } }, { 16, 16, 5, 5 } }, /* 22 LD (nn),HL */
+    { 22, 1, 1, 0, { { 0x01, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 23 INC HL */
+    { 22, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 24 INC H */
+    { 13, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 25 DEC H */
+    { 29, 2, 2, 0, { { 0x01, 5, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 26 LD H,n */
+    { 12, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 27 DAA */
+    { 28, 2, 2, 0, { { 0x20, 18, 0x00 }, { 0x82, 0, 0x11 } }, { 7, 12, 2, 3 } }, /* 28 JR Z,e */
+    { 1, 1, 2, 0, { { 0x01, 10, 0x00 }, { 0x01, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* 29 ADD HL,HL */
+    { 29, 3, 2, 0, { { 0x01, 10, 0x00 }, { 0x0e, 0, 0x21 } }, { 16, 16, 5, 5 } }, /* 2A LD HL,(nn) */
+    { 13, 1, 1, 0, { { 0x01, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 2B DEC HL */
+    { 22, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2C INC L */
+    { 13, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2D DEC L */
+    { 29, 2, 2, 0, { { 0x01, 6, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 2E LD L,n */
+    { 11, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2F CPL */
+    { 28, 2, 2, 0, { { 0x20, 19, 0x00 }, { 0x82, 0, 0x11 } }, { 7, 12, 2, 3 } }, /* 30 JR NC,e */
+    { 29, 3, 2, 0, { { 0x01, 11, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* 31 LD SP,nn */
+    { 29, 3, 2, 0, { { 0x0e, 0, 0x21 }, { 0x01, 0, 0x00 } }, { 13, 13, 4, 4 } }, /* 32 LD (nn),A */
+    { 22, 1, 1, 0, { { 0x01, 11, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 33 INC SP */
+    { 22, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* 34 INC (HL) */
+    { 13, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* 35 DEC (HL) */
+    { 29, 2, 2, 0, { { 0x09, 10, 0x00 }, { 0x02, 0, 0x11 } }, { 10, 10, 3, 3 } }, /* 36 LD (HL),n */
+    { 60, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 37 SCF */
+    { 28, 2, 2, 0, { { 0x20, 20, 0x00 }, { 0x82, 0, 0x11 } }, { 7, 12, 2, 3 } }, /* 38 JR C,e */
+    { 1, 1, 2, 0, { { 0x01, 10, 0x00 }, { 0x01, 11, 0x00 } }, { 11, 11, 3, 3 } }, /* 39 ADD HL,SP */
+    { 29, 3, 2, 0, { { 0x01, 0, 0x00 }, { 0x0e, 0, 0x21 } }, { 13, 13, 4, 4 } }, /* 3A LD A,(nn) */
+    { 13, 1, 1, 0, { { 0x01, 11, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 3B DEC SP */
+    { 22, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3C INC A */
+    { 13, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3D DEC A */
+    { 29, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 3E LD A,n */
+    { 5, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3F CCF */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 40 LD B,B */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 41 LD B,C */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 42 LD B,D */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 43 LD B,E */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 44 LD B,H */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 45 LD B,L */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x09, 10, 0x00 } }, { 7, 7, 2, 2 } }, /* 46 LD B,(HL) */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 47 LD B,A */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 48 LD C,B */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 49 LD C,C */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 4A LD C,D */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 4B LD C,E */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 4C LD C,H */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 4D LD C,L */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x09, 10, 0x00 } }, { 7, 7, 2, 2 } }, /* 4E LD C,(HL) */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 4F LD C,A */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 50 LD D,B */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 51 LD D,C */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 52 LD D,D */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 53 LD D,E */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 54 LD D,H */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 55 LD D,L */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x09, 10, 0x00 } }, { 7, 7, 2, 2 } }, /* 56 LD D,(HL) */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 57 LD D,A */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 58 LD E,B */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 59 LD E,C */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 5A LD E,D */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 5B LD E,E */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 5C LD E,H */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 5D LD E,L */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x09, 10, 0x00 } }, { 7, 7, 2, 2 } }, /* 5E LD E,(HL) */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 5F LD E,A */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 60 LD H,B */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 61 LD H,C */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 62 LD H,D */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 63 LD H,E */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 64 LD H,H */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 65 LD H,L */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x09, 10, 0x00 } }, { 7, 7, 2, 2 } }, /* 66 LD H,(HL) */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 67 LD H,A */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 68 LD L,B */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 69 LD L,C */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 6A LD L,D */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 6B LD L,E */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 6C LD L,H */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 6D LD L,L */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x09, 10, 0x00 } }, { 7, 7, 2, 2 } }, /* 6E LD L,(HL) */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 6F LD L,A */
+    { 29, 1, 2, 0, { { 0x09, 10, 0x00 }, { 0x01, 1, 0x00 } }, { 7, 7, 2, 2 } }, /* 70 LD (HL),B */
+    { 29, 1, 2, 0, { { 0x09, 10, 0x00 }, { 0x01, 2, 0x00 } }, { 7, 7, 2, 2 } }, /* 71 LD (HL),C */
+    { 29, 1, 2, 0, { { 0x09, 10, 0x00 }, { 0x01, 3, 0x00 } }, { 7, 7, 2, 2 } }, /* 72 LD (HL),D */
+    { 29, 1, 2, 0, { { 0x09, 10, 0x00 }, { 0x01, 4, 0x00 } }, { 7, 7, 2, 2 } }, /* 73 LD (HL),E */
+    { 29, 1, 2, 0, { { 0x09, 10, 0x00 }, { 0x01, 5, 0x00 } }, { 7, 7, 2, 2 } }, /* 74 LD (HL),H */
+    { 29, 1, 2, 0, { { 0x09, 10, 0x00 }, { 0x01, 6, 0x00 } }, { 7, 7, 2, 2 } }, /* 75 LD (HL),L */
+    { 19, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 76 HALT */
+    { 29, 1, 2, 0, { { 0x09, 10, 0x00 }, { 0x01, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* 77 LD (HL),A */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 78 LD A,B */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 79 LD A,C */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 7A LD A,D */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 7B LD A,E */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 7C LD A,H */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 7D LD A,L */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x09, 10, 0x00 } }, { 7, 7, 2, 2 } }, /* 7E LD A,(HL) */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 7F LD A,A */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 80 ADD A,B */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 81 ADD A,C */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 82 ADD A,D */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 83 ADD A,E */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 84 ADD A,H */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 85 ADD A,L */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x09, 10, 0x00 } }, { 7, 7, 2, 2 } }, /* 86 ADD A,(HL) */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 87 ADD A,A */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 88 ADC A,B */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 89 ADC A,C */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 8A ADC A,D */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 8B ADC A,E */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 8C ADC A,H */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 8D ADC A,L */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x09, 10, 0x00 } }, { 7, 7, 2, 2 } }, /* 8E ADC A,(HL) */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 8F ADC A,A */
+    { 65, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 90 SUB B */
+    { 65, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 91 SUB C */
+    { 65, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 92 SUB D */
+    { 65, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 93 SUB E */
+    { 65, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 94 SUB H */
+    { 65, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 95 SUB L */
+    { 65, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* 96 SUB (HL) */
+    { 65, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 97 SUB A */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 98 SBC A,B */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 99 SBC A,C */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 9A SBC A,D */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 9B SBC A,E */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 9C SBC A,H */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 9D SBC A,L */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x09, 10, 0x00 } }, { 7, 7, 2, 2 } }, /* 9E SBC A,(HL) */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 9F SBC A,A */
+    { 2, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A0 AND B */
+    { 2, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A1 AND C */
+    { 2, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A2 AND D */
+    { 2, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A3 AND E */
+    { 2, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A4 AND H */
+    { 2, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A5 AND L */
+    { 2, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* A6 AND (HL) */
+    { 2, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A7 AND A */
+    { 66, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A8 XOR B */
+    { 66, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A9 XOR C */
+    { 66, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AA XOR D */
+    { 66, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AB XOR E */
+    { 66, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AC XOR H */
+    { 66, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AD XOR L */
+    { 66, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* AE XOR (HL) */
+    { 66, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AF XOR A */
+    { 36, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B0 OR B */
+    { 36, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B1 OR C */
+    { 36, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B2 OR D */
+    { 36, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B3 OR E */
+    { 36, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B4 OR H */
+    { 36, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B5 OR L */
+    { 36, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* B6 OR (HL) */
+    { 36, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B7 OR A */
+    { 6, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B8 CP B */
+    { 6, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B9 CP C */
+    { 6, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BA CP D */
+    { 6, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BB CP E */
+    { 6, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BC CP H */
+    { 6, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BD CP L */
+    { 6, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* BE CP (HL) */
+    { 6, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BF CP A */
+    { 45, 1, 1, 0, { { 0x20, 17, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* C0 RET NZ */
+    { 42, 1, 1, 0, { { 0x01, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* C1 POP BC */
+    { 27, 3, 2, 0, { { 0x20, 17, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* C2 JP NZ,nn */
+    { 27, 3, 1, 0, { { 0x06, 0, 0x21 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* C3 JP nn */
+    { 4, 3, 2, 0, { { 0x20, 17, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* C4 CALL NZ,nn */
+    { 43, 1, 1, 0, { { 0x01, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* C5 PUSH BC */
+    { 1, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* C6 ADD A,n */
+    { 53, 1, 1, 0, { { 0x60, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* C7 RST 0x0 */
+    { 45, 1, 1, 0, { { 0x20, 18, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* C8 RET Z */
+    { 45, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* C9 RET */
+    { 27, 3, 2, 0, { { 0x20, 18, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* CA JP Z,nn */
+    { 0, 0, 0, pg_CB, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* CB prefix */
+    { 4, 3, 2, 0, { { 0x20, 18, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* CC CALL Z,nn */
+    { 4, 3, 1, 0, { { 0x06, 0, 0x21 }, { 0x00, 0, 0x00 } }, { 17, 17, 5, 5 } }, /* CD CALL nn */
+    { 0, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* CE ADC A,n */
+    { 53, 1, 1, 0, { { 0x60, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* CF RST 0x8 */
+    { 45, 1, 1, 0, { { 0x20, 19, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* D0 RET NC */
+    { 42, 1, 1, 0, { { 0x01, 9, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* D1 POP DE */
+    { 27, 3, 2, 0, { { 0x20, 19, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* D2 JP NC,nn */
+    { 37, 2, 2, 0, { { 0x02, 0, 0x11 }, { 0x01, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* D3 OUT n,A */
+    { 4, 3, 2, 0, { { 0x20, 19, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* D4 CALL NC,nn */
+    { 43, 1, 1, 0, { { 0x01, 9, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* D5 PUSH DE */
+    { 65, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* D6 SUB n */
+    { 53, 1, 1, 0, { { 0x60, 16, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* D7 RST 0x10 */
+    { 45, 1, 1, 0, { { 0x20, 20, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* D8 RET C */
+    { 18, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* D9 EXX */
+    { 27, 3, 2, 0, { { 0x20, 20, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* DA JP C,nn */
+    { 21, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 11, 11, 3, 3 } }, /* DB IN A,n */
+    { 4, 3, 2, 0, { { 0x20, 20, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* DC CALL C,nn */
+    { 0, 0, 0, pg_DD, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* DD prefix */
+    { 59, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* DE SBC A,n */
+    { 53, 1, 1, 0, { { 0x60, 24, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* DF RST 0x18 */
+    { 45, 1, 1, 0, { { 0x20, 21, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* E0 RET PO */
+    { 42, 1, 1, 0, { { 0x01, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* E1 POP HL */
+    { 27, 3, 2, 0, { { 0x20, 21, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* E2 JP PO,nn */
+    { 17, 1, 2, 0, { { 0x09, 11, 0x00 }, { 0x01, 10, 0x00 } }, { 19, 19, 5, 5 } }, /* E3 EX (SP),HL */
+    { 4, 3, 2, 0, { { 0x20, 21, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* E4 CALL PO,nn */
+    { 43, 1, 1, 0, { { 0x01, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* E5 PUSH HL */
+    { 2, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* E6 AND n */
+    { 53, 1, 1, 0, { { 0x60, 32, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* E7 RST 0x20 */
+    { 45, 1, 1, 0, { { 0x20, 22, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* E8 RET PE */
+    { 27, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* E9 JP (HL) */
+    { 27, 3, 2, 0, { { 0x20, 22, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* EA JP PE,nn */
+    { 17, 1, 2, 0, { { 0x01, 9, 0x00 }, { 0x01, 10, 0x00 } }, { 4, 4, 1, 1 } }, /* EB EX DE,HL */
+    { 4, 3, 2, 0, { { 0x20, 22, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* EC CALL PE,nn */
+    { 0, 0, 0, pg_ED, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* ED prefix */
+    { 66, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* EE XOR n */
+    { 53, 1, 1, 0, { { 0x60, 40, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* EF RST 0x28 */
+    { 45, 1, 1, 0, { { 0x20, 23, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* F0 RET P */
+    { 42, 1, 1, 0, { { 0x01, 7, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* F1 POP AF */
+    { 27, 3, 2, 0, { { 0x20, 23, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* F2 JP P,nn */
+    { 14, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* F3 DI */
+    { 4, 3, 2, 0, { { 0x20, 23, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* F4 CALL P,nn */
+    { 43, 1, 1, 0, { { 0x01, 7, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* F5 PUSH AF */
+    { 36, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* F6 OR n */
+    { 53, 1, 1, 0, { { 0x60, 48, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* F7 RST 0x30 */
+    { 45, 1, 1, 0, { { 0x20, 24, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* F8 RET M */
+    { 29, 1, 2, 0, { { 0x01, 11, 0x00 }, { 0x01, 10, 0x00 } }, { 6, 6, 1, 1 } }, /* F9 LD SP,HL */
+    { 27, 3, 2, 0, { { 0x20, 24, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* FA JP M,nn */
+    { 16, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* FB EI */
+    { 4, 3, 2, 0, { { 0x20, 24, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* FC CALL M,nn */
+    { 0, 0, 0, pg_FD, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* FD prefix */
+    { 6, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* FE CP n */
+    { 53, 1, 1, 0, { { 0x60, 56, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* FF RST 0x38 */
+  },
+  { /* pg_CB */
+    { 50, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 00 RLC B */
+    { 50, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 01 RLC C */
+    { 50, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 02 RLC D */
+    { 50, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 03 RLC E */
+    { 50, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 04 RLC H */
+    { 50, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 05 RLC L */
+    { 50, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* 06 RLC (HL) */
+    { 50, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 07 RLC A */
+    { 56, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 08 RRC B */
+    { 56, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 09 RRC C */
+    { 56, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0A RRC D */
+    { 56, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0B RRC E */
+    { 56, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0C RRC H */
+    { 56, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0D RRC L */
+    { 56, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* 0E RRC (HL) */
+    { 56, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0F RRC A */
+    { 48, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 10 RL B */
+    { 48, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 11 RL C */
+    { 48, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 12 RL D */
+    { 48, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 13 RL E */
+    { 48, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 14 RL H */
+    { 48, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 15 RL L */
+    { 48, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* 16 RL (HL) */
+    { 48, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 17 RL A */
+    { 54, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 18 RR B */
+    { 54, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 19 RR C */
+    { 54, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1A RR D */
+    { 54, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1B RR E */
+    { 54, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1C RR H */
+    { 54, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1D RR L */
+    { 54, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* 1E RR (HL) */
+    { 54, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1F RR A */
+    { 62, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 20 SLA B */
+    { 62, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 21 SLA C */
+    { 62, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 22 SLA D */
+    { 62, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 23 SLA E */
+    { 62, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 24 SLA H */
+    { 62, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 25 SLA L */
+    { 62, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* 26 SLA (HL) */
+    { 62, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 27 SLA A */
+    { 63, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 28 SRA B */
+    { 63, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 29 SRA C */
+    { 63, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2A SRA D */
+    { 63, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2B SRA E */
+    { 63, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2C SRA H */
+    { 63, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2D SRA L */
+    { 63, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* 2E SRA (HL) */
+    { 63, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2F SRA A */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 30 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 31 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 32 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 33 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 34 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 35 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 36 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 37 invalid */
+    { 64, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 38 SRL B */
+    { 64, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 39 SRL C */
+    { 64, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3A SRL D */
+    { 64, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3B SRL E */
+    { 64, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3C SRL H */
+    { 64, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3D SRL L */
+    { 64, 1, 1, 0, { { 0x09, 10, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* 3E SRL (HL) */
+    { 64, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3F SRL A */
+    { 3, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 40 BIT 0,B */
+    { 3, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 41 BIT 0,C */
+    { 3, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 42 BIT 0,D */
+    { 3, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 43 BIT 0,E */
+    { 3, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 44 BIT 0,H */
+    { 3, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 45 BIT 0,L */
+    { 3, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x09, 10, 0x00 } }, { 8, 8, 2, 2 } }, /* 46 BIT 0,(HL) */
+    { 3, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 47 BIT 0,A */
+    { 3, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 48 BIT 1,B */
+    { 3, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 49 BIT 1,C */
+    { 3, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 4A BIT 1,D */
+    { 3, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 4B BIT 1,E */
+    { 3, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 4C BIT 1,H */
+    { 3, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 4D BIT 1,L */
+    { 3, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x09, 10, 0x00 } }, { 8, 8, 2, 2 } }, /* 4E BIT 1,(HL) */
+    { 3, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 4F BIT 1,A */
+    { 3, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 50 BIT 2,B */
+    { 3, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 51 BIT 2,C */
+    { 3, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 52 BIT 2,D */
+    { 3, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 53 BIT 2,E */
+    { 3, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 54 BIT 2,H */
+    { 3, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 55 BIT 2,L */
+    { 3, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x09, 10, 0x00 } }, { 8, 8, 2, 2 } }, /* 56 BIT 2,(HL) */
+    { 3, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 57 BIT 2,A */
+    { 3, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 58 BIT 3,B */
+    { 3, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 59 BIT 3,C */
+    { 3, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 5A BIT 3,D */
+    { 3, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 5B BIT 3,E */
+    { 3, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 5C BIT 3,H */
+    { 3, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 5D BIT 3,L */
+    { 3, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x09, 10, 0x00 } }, { 8, 8, 2, 2 } }, /* 5E BIT 3,(HL) */
+    { 3, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 5F BIT 3,A */
+    { 3, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 60 BIT 4,B */
+    { 3, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 61 BIT 4,C */
+    { 3, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 62 BIT 4,D */
+    { 3, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 63 BIT 4,E */
+    { 3, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 64 BIT 4,H */
+    { 3, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 65 BIT 4,L */
+    { 3, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x09, 10, 0x00 } }, { 8, 8, 2, 2 } }, /* 66 BIT 4,(HL) */
+    { 3, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 67 BIT 4,A */
+    { 3, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 68 BIT 5,B */
+    { 3, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 69 BIT 5,C */
+    { 3, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 6A BIT 5,D */
+    { 3, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 6B BIT 5,E */
+    { 3, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 6C BIT 5,H */
+    { 3, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 6D BIT 5,L */
+    { 3, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x09, 10, 0x00 } }, { 8, 8, 2, 2 } }, /* 6E BIT 5,(HL) */
+    { 3, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 6F BIT 5,A */
+    { 3, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 70 BIT 6,B */
+    { 3, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 71 BIT 6,C */
+    { 3, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 72 BIT 6,D */
+    { 3, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 73 BIT 6,E */
+    { 3, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 74 BIT 6,H */
+    { 3, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 75 BIT 6,L */
+    { 3, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x09, 10, 0x00 } }, { 8, 8, 2, 2 } }, /* 76 BIT 6,(HL) */
+    { 3, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 77 BIT 6,A */
+    { 3, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 78 BIT 7,B */
+    { 3, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 79 BIT 7,C */
+    { 3, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 7A BIT 7,D */
+    { 3, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 7B BIT 7,E */
+    { 3, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 7C BIT 7,H */
+    { 3, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 7D BIT 7,L */
+    { 3, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x09, 10, 0x00 } }, { 8, 8, 2, 2 } }, /* 7E BIT 7,(HL) */
+    { 3, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 7F BIT 7,A */
+    { 44, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 80 RES 0,B */
+    { 44, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 81 RES 0,C */
+    { 44, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 82 RES 0,D */
+    { 44, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 83 RES 0,E */
+    { 44, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 84 RES 0,H */
+    { 44, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 85 RES 0,L */
+    { 44, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* 86 RES 0,(HL) */
+    { 44, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 87 RES 0,A */
+    { 44, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 88 RES 1,B */
+    { 44, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 89 RES 1,C */
+    { 44, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 8A RES 1,D */
+    { 44, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 8B RES 1,E */
+    { 44, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 8C RES 1,H */
+    { 44, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 8D RES 1,L */
+    { 44, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* 8E RES 1,(HL) */
+    { 44, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 8F RES 1,A */
+    { 44, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 90 RES 2,B */
+    { 44, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 91 RES 2,C */
+    { 44, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 92 RES 2,D */
+    { 44, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 93 RES 2,E */
+    { 44, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 94 RES 2,H */
+    { 44, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 95 RES 2,L */
+    { 44, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* 96 RES 2,(HL) */
+    { 44, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 97 RES 2,A */
+    { 44, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 98 RES 3,B */
+    { 44, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 99 RES 3,C */
+    { 44, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 9A RES 3,D */
+    { 44, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 9B RES 3,E */
+    { 44, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 9C RES 3,H */
+    { 44, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 9D RES 3,L */
+    { 44, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* 9E RES 3,(HL) */
+    { 44, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 9F RES 3,A */
+    { 44, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* A0 RES 4,B */
+    { 44, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* A1 RES 4,C */
+    { 44, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* A2 RES 4,D */
+    { 44, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* A3 RES 4,E */
+    { 44, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* A4 RES 4,H */
+    { 44, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* A5 RES 4,L */
+    { 44, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* A6 RES 4,(HL) */
+    { 44, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A7 RES 4,A */
+    { 44, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* A8 RES 5,B */
+    { 44, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* A9 RES 5,C */
+    { 44, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* AA RES 5,D */
+    { 44, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* AB RES 5,E */
+    { 44, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* AC RES 5,H */
+    { 44, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* AD RES 5,L */
+    { 44, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* AE RES 5,(HL) */
+    { 44, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AF RES 5,A */
+    { 44, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* B0 RES 6,B */
+    { 44, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* B1 RES 6,C */
+    { 44, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* B2 RES 6,D */
+    { 44, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* B3 RES 6,E */
+    { 44, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* B4 RES 6,H */
+    { 44, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* B5 RES 6,L */
+    { 44, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* B6 RES 6,(HL) */
+    { 44, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B7 RES 6,A */
+    { 44, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* B8 RES 7,B */
+    { 44, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* B9 RES 7,C */
+    { 44, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* BA RES 7,D */
+    { 44, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* BB RES 7,E */
+    { 44, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* BC RES 7,H */
+    { 44, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* BD RES 7,L */
+    { 44, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* BE RES 7,(HL) */
+    { 44, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BF RES 7,A */
+    { 61, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* C0 SET 0,B */
+    { 61, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* C1 SET 0,C */
+    { 61, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* C2 SET 0,D */
+    { 61, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* C3 SET 0,E */
+    { 61, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* C4 SET 0,H */
+    { 61, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* C5 SET 0,L */
+    { 61, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* C6 SET 0,(HL) */
+    { 61, 1, 2, 0, { { 0x40, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* C7 SET 0,A */
+    { 61, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* C8 SET 1,B */
+    { 61, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* C9 SET 1,C */
+    { 61, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* CA SET 1,D */
+    { 61, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* CB SET 1,E */
+    { 61, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* CC SET 1,H */
+    { 61, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* CD SET 1,L */
+    { 61, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* CE SET 1,(HL) */
+    { 61, 1, 2, 0, { { 0x40, 1, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* CF SET 1,A */
+    { 61, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* D0 SET 2,B */
+    { 61, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* D1 SET 2,C */
+    { 61, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* D2 SET 2,D */
+    { 61, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* D3 SET 2,E */
+    { 61, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* D4 SET 2,H */
+    { 61, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* D5 SET 2,L */
+    { 61, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* D6 SET 2,(HL) */
+    { 61, 1, 2, 0, { { 0x40, 2, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* D7 SET 2,A */
+    { 61, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* D8 SET 3,B */
+    { 61, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* D9 SET 3,C */
+    { 61, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* DA SET 3,D */
+    { 61, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* DB SET 3,E */
+    { 61, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* DC SET 3,H */
+    { 61, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* DD SET 3,L */
+    { 61, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* DE SET 3,(HL) */
+    { 61, 1, 2, 0, { { 0x40, 3, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* DF SET 3,A */
+    { 61, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* E0 SET 4,B */
+    { 61, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* E1 SET 4,C */
+    { 61, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* E2 SET 4,D */
+    { 61, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* E3 SET 4,E */
+    { 61, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* E4 SET 4,H */
+    { 61, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* E5 SET 4,L */
+    { 61, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* E6 SET 4,(HL) */
+    { 61, 1, 2, 0, { { 0x40, 4, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* E7 SET 4,A */
+    { 61, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* E8 SET 5,B */
+    { 61, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* E9 SET 5,C */
+    { 61, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* EA SET 5,D */
+    { 61, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* EB SET 5,E */
+    { 61, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* EC SET 5,H */
+    { 61, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* ED SET 5,L */
+    { 61, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* EE SET 5,(HL) */
+    { 61, 1, 2, 0, { { 0x40, 5, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* EF SET 5,A */
+    { 61, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* F0 SET 6,B */
+    { 61, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* F1 SET 6,C */
+    { 61, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* F2 SET 6,D */
+    { 61, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* F3 SET 6,E */
+    { 61, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* F4 SET 6,H */
+    { 61, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* F5 SET 6,L */
+    { 61, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* F6 SET 6,(HL) */
+    { 61, 1, 2, 0, { { 0x40, 6, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* F7 SET 6,A */
+    { 61, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* F8 SET 7,B */
+    { 61, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* F9 SET 7,C */
+    { 61, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* FA SET 7,D */
+    { 61, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* FB SET 7,E */
+    { 61, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* FC SET 7,H */
+    { 61, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* FD SET 7,L */
+    { 61, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x09, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* FE SET 7,(HL) */
+    { 61, 1, 2, 0, { { 0x40, 7, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* FF SET 7,A */
+  },
+  { /* pg_ED */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 00 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 01 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 02 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 03 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 04 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 05 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 06 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 07 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 08 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 09 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 0A invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 0B invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 0C invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 0D invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 0E invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 0F invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 10 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 11 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 12 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 13 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 14 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 15 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 16 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 17 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 18 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 19 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 1A invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 1B invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 1C invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 1D invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 1E invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 1F invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 20 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 21 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 22 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 23 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 24 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 25 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 26 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 27 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 28 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 29 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 2A invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 2B invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 2C invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 2D invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 2E invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 2F invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 30 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 31 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 32 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 33 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 34 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 35 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 36 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 37 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 38 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 39 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 3A invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 3B invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 3C invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 3D invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 3E invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 3F invalid */
+    { 21, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x09, 2, 0x00 } }, { 8, 8, 2, 2 } }, /* 40 IN B,(C) */
+    { 37, 1, 2, 0, { { 0x09, 2, 0x00 }, { 0x01, 1, 0x00 } }, { 8, 8, 2, 2 } }, /* 41 OUT (C),B */
+    { 59, 1, 2, 0, { { 0x01, 10, 0x00 }, { 0x01, 8, 0x00 } }, { 11, 11, 3, 3 } }, /* 42 SBC HL,BC */
+    { 29, 3, 2, 0, { { 0x0e, 0, 0x21 }, { 0x01, 8, 0x00 } }, { 16, 16, 5, 5 } }, /* 43 LD (nn),BC */
+    { 34, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 44 NEG */
+    { 47, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* 45 RETN */
+    { 20, 1, 1, 0, { { 0x40, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 46 IM 0 */
+    { 29, 1, 2, 0, { { 0x01, 15, 0x00 }, { 0x01, 0, 0x00 } }, { 5, 5, 1, 1 } }, /* 47 LD I,A */
+    { 21, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x09, 2, 0x00 } }, { 8, 8, 2, 2 } }, /* 48 IN C,(C) */
+    { 37, 1, 2, 0, { { 0x09, 2, 0x00 }, { 0x01, 2, 0x00 } }, { 8, 8, 2, 2 } }, /* 49 OUT (C),C */
+    { 0, 1, 2, 0, { { 0x01, 10, 0x00 }, { 0x01, 8, 0x00 } }, { 11, 11, 3, 3 } }, /* 4A ADC HL,BC */
+    { 29, 3, 2, 0, { { 0x01, 8, 0x00 }, { 0x0e, 0, 0x21 } }, { 16, 16, 5, 5 } }, /* 4B LD BC,(nn) */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 4C invalid */
+    { 46, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* 4D RETI */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 4E invalid */
+    { 29, 1, 2, 0, { { 0x01, 16, 0x00 }, { 0x01, 0, 0x00 } }, { 5, 5, 1, 1 } }, /* 4F LD R,A */
+    { 21, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x09, 2, 0x00 } }, { 8, 8, 2, 2 } }, /* 50 IN D,(C) */
+    { 37, 1, 2, 0, { { 0x09, 2, 0x00 }, { 0x01, 3, 0x00 } }, { 8, 8, 2, 2 } }, /* 51 OUT (C),D */
+    { 59, 1, 2, 0, { { 0x01, 10, 0x00 }, { 0x01, 9, 0x00 } }, { 11, 11, 3, 3 } }, /* 52 SBC HL,DE */
+    { 29, 3, 2, 0, { { 0x0e, 0, 0x21 }, { 0x01, 9, 0x00 } }, { 16, 16, 5, 5 } }, /* 53 LD (nn),DE */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 54 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 55 invalid */
+    { 20, 1, 1, 0, { { 0x40, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 56 IM 1 */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 15, 0x00 } }, { 5, 5, 1, 1 } }, /* 57 LD A,I */
+    { 21, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x09, 2, 0x00 } }, { 8, 8, 2, 2 } }, /* 58 IN E,(C) */
+    { 37, 1, 2, 0, { { 0x09, 2, 0x00 }, { 0x01, 4, 0x00 } }, { 8, 8, 2, 2 } }, /* 59 OUT (C),E */
+    { 0, 1, 2, 0, { { 0x01, 10, 0x00 }, { 0x01, 9, 0x00 } }, { 11, 11, 3, 3 } }, /* 5A ADC HL,DE */
+    { 29, 3, 2, 0, { { 0x01, 9, 0x00 }, { 0x0e, 0, 0x21 } }, { 16, 16, 5, 5 } }, /* 5B LD DE,(nn) */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 5C invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 5D invalid */
+    { 20, 1, 1, 0, { { 0x40, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 5E IM 2 */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 16, 0x00 } }, { 5, 5, 1, 1 } }, /* 5F LD A,R */
+    { 21, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x09, 2, 0x00 } }, { 8, 8, 2, 2 } }, /* 60 IN H,(C) */
+    { 37, 1, 2, 0, { { 0x09, 2, 0x00 }, { 0x01, 5, 0x00 } }, { 8, 8, 2, 2 } }, /* 61 OUT (C),H */
+    { 59, 1, 2, 0, { { 0x01, 10, 0x00 }, { 0x01, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* 62 SBC HL,HL */
+    { 29, 3, 2, 0, { { 0x0e, 0, 0x21 }, { 0x01, 10, 0x00 } }, { 16, 16, 5, 5 } }, /* 63 LD (nn),HL */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 64 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 65 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 66 invalid */
+    { 57, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 14, 14, 4, 4 } }, /* 67 RRD */
+    { 21, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x09, 2, 0x00 } }, { 8, 8, 2, 2 } }, /* 68 IN L,(C) */
+    { 37, 1, 2, 0, { { 0x09, 2, 0x00 }, { 0x01, 6, 0x00 } }, { 8, 8, 2, 2 } }, /* 69 OUT (C),L */
+    { 0, 1, 2, 0, { { 0x01, 10, 0x00 }, { 0x01, 10, 0x00 } }, { 11, 11, 3, 3 } }, /* 6A ADC HL,HL */
+    { 29, 3, 2, 0, { { 0x01, 10, 0x00 }, { 0x0e, 0, 0x21 } }, { 16, 16, 5, 5 } }, /* 6B LD HL,(nn) */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 6C invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 6D invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 6E invalid */
+    { 51, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 14, 14, 4, 4 } }, /* 6F RLD */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 70 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 71 invalid */
+    { 59, 1, 2, 0, { { 0x01, 10, 0x00 }, { 0x01, 11, 0x00 } }, { 11, 11, 3, 3 } }, /* 72 SBC HL,SP */
+    { 29, 3, 2, 0, { { 0x0e, 0, 0x21 }, { 0x01, 11, 0x00 } }, { 16, 16, 5, 5 } }, /* 73 LD (nn),SP */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 74 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 75 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 76 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 77 invalid */
+    { 21, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x09, 2, 0x00 } }, { 8, 8, 2, 2 } }, /* 78 IN A,(C) */
+    { 37, 1, 2, 0, { { 0x09, 2, 0x00 }, { 0x01, 0, 0x00 } }, { 8, 8, 2, 2 } }, /* 79 OUT (C),A */
+    { 0, 1, 2, 0, { { 0x01, 10, 0x00 }, { 0x01, 11, 0x00 } }, { 11, 11, 3, 3 } }, /* 7A ADC HL,SP */
+    { 29, 3, 2, 0, { { 0x01, 11, 0x00 }, { 0x0e, 0, 0x21 } }, { 16, 16, 5, 5 } }, /* 7B LD SP,(nn) */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 7C invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 7D invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 7E invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 7F invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 80 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 81 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 82 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 83 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 84 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 85 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 86 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 87 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 88 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 89 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 8A invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 8B invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 8C invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 8D invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 8E invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 8F invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 90 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 91 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 92 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 93 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 94 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 95 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 96 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 97 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 98 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 99 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 9A invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 9B invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 9C invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 9D invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 9E invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 9F invalid */
+    { 32, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 12, 3, 3 } }, /* A0 LDI */
+    { 9, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 12, 3, 3 } }, /* A1 CPI */
+    { 25, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 12, 3, 3 } }, /* A2 INI */
+    { 40, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 12, 3, 3 } }, /* A3 OUTI */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* A4 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* A5 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* A6 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* A7 invalid */
+    { 30, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 12, 3, 3 } }, /* A8 LDD */
+    { 7, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 12, 3, 3 } }, /* A9 CPD */
+    { 23, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 12, 3, 3 } }, /* AA IND */
+    { 38, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 12, 3, 3 } }, /* AB OUTD */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* AC invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* AD invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* AE invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* AF invalid */
+    { 33, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 17, 3, 4 } }, /* B0 LDIR */
+    { 10, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 17, 3, 4 } }, /* B1 CPIR */
+    { 26, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 17, 3, 4 } }, /* B2 INIR */
+    { 41, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 17, 3, 4 } }, /* B3 OTIR */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* B4 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* B5 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* B6 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* B7 invalid */
+    { 31, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 17, 3, 4 } }, /* B8 LDDR */
+    { 8, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 17, 3, 4 } }, /* B9 CPDR */
+    { 24, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 17, 3, 4 } }, /* BA INDR */
+    { 39, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 12, 17, 3, 4 } }, /* BB OTDR */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* BC invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* BD invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* BE invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* BF invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* C0 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* C1 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* C2 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* C3 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* C4 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* C5 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* C6 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* C7 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* C8 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* C9 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* CA invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* CB invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* CC invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* CD invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* CE invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* CF invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* D0 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* D1 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* D2 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* D3 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* D4 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* D5 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* D6 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* D7 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* D8 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* D9 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* DA invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* DB invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* DC invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* DD invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* DE invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* DF invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* E0 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* E1 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* E2 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* E3 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* E4 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* E5 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* E6 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* E7 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* E8 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* E9 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* EA invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* EB invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* EC invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* ED invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* EE invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* EF invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* F0 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* F1 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* F2 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* F3 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* F4 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* F5 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* F6 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* F7 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* F8 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* F9 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* FA invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* FB invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* FC invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* FD invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* FE invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* FF invalid */
+  },
+  { /* pg_DD */
+    { 35, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 00 NOP */
+    { 29, 3, 2, 0, { { 0x01, 8, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* 01 LD BC,nn */
+    { 29, 1, 2, 0, { { 0x09, 8, 0x00 }, { 0x01, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* 02 LD (BC),A */
+    { 22, 1, 1, 0, { { 0x01, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 03 INC BC */
+    { 22, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 04 INC B */
+    { 13, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 05 DEC B */
+    { 29, 2, 2, 0, { { 0x01, 1, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 06 LD B,n */
+    { 52, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 07 RLCA */
+    { 17, 1, 2, 0, { { 0x01, 7, 0x00 }, { 0x01, 14, 0x00 } }, { 4, 4, 1, 1 } }, /* 08 EX AF,AF' */
+    { 1, 1, 2, 0, { { 0x01, 12, 0x00 }, { 0x01, 8, 0x00 } }, { 11, 11, 3, 3 } }, /* 09 ADD IX,BC */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x09, 8, 0x00 } }, { 7, 7, 2, 2 } }, /* 0A LD A,(BC) */
+    { 13, 1, 1, 0, { { 0x01, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 0B DEC BC */
+    { 22, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0C INC C */
+    { 13, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0D DEC C */
+    { 29, 2, 2, 0, { { 0x01, 2, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 0E LD C,n */
+    { 58, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0F RRCA */
+    { 15, 2, 1, 0, { { 0x82, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 8, 13, 2, 3 } }, /* 10 DJNZ e */
+    { 29, 3, 2, 0, { { 0x01, 9, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* 11 LD DE,nn */
+    { 29, 1, 2, 0, { { 0x09, 9, 0x00 }, { 0x01, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* 12 LD (DE),A */
+    { 22, 1, 1, 0, { { 0x01, 9, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 13 INC DE */
+    { 22, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 14 INC D */
+    { 13, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 15 DEC D */
+    { 29, 2, 2, 0, { { 0x01, 3, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 16 LD D,n */
+    { 49, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 17 RLA */
+    { 28, 2, 1, 0, { { 0x82, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 12, 12, 3, 3 } }, /* 18 JR e */
+    { 1, 1, 2, 0, { { 0x01, 12, 0x00 }, { 0x01, 9, 0x00 } }, { 11, 11, 3, 3 } }, /* 19 ADD IX,DE */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x09, 9, 0x00 } }, { 7, 7, 2, 2 } }, /* 1A LD A,(DE) */
+    { 13, 1, 1, 0, { { 0x01, 9, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 1B DEC DE */
+    { 22, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1C INC E */
+    { 13, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1D DEC E */
+    { 29, 2, 2, 0, { { 0x01, 4, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 1E LD E,n */
+    { 55, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1F RRA */
+    { 28, 2, 2, 0, { { 0x20, 17, 0x00 }, { 0x82, 0, 0x11 } }, { 7, 12, 2, 3 } }, /* 20 JR NZ,e */
+    { 29, 3, 2, 0, { { 0x01, 12, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* 21 LD IX,nn */
+    { 29, 3, 2, 0, { { 0x0e, 0, 0x21 }, { 0x01, 12, 0x00 } }, { 16, 16, 5, 5 } }, /* 22 LD (nn),IX */
+    { 22, 1, 1, 0, { { 0x01, 12, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 23 INC IX */
+    { 22, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 24 INC H */
+    { 13, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 25 DEC H */
+    { 29, 2, 2, 0, { { 0x01, 5, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 26 LD H,n */
+    { 12, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 27 DAA */
+    { 28, 2, 2, 0, { { 0x20, 18, 0x00 }, { 0x82, 0, 0x11 } }, { 7, 12, 2, 3 } }, /* 28 JR Z,e */
+    { 1, 1, 2, 0, { { 0x01, 12, 0x00 }, { 0x01, 12, 0x00 } }, { 11, 11, 3, 3 } }, /* 29 ADD IX,IX */
+    { 29, 3, 2, 0, { { 0x01, 12, 0x00 }, { 0x0e, 0, 0x21 } }, { 16, 16, 5, 5 } }, /* 2A LD IX,(nn) */
+    { 13, 1, 1, 0, { { 0x01, 12, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 2B DEC IX */
+    { 22, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2C INC L */
+    { 13, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2D DEC L */
+    { 29, 2, 2, 0, { { 0x01, 6, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 2E LD L,n */
+    { 11, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2F CPL */
+    { 28, 2, 2, 0, { { 0x20, 19, 0x00 }, { 0x82, 0, 0x11 } }, { 7, 12, 2, 3 } }, /* 30 JR NC,e */
+    { 29, 3, 2, 0, { { 0x01, 11, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* 31 LD SP,nn */
+    { 29, 3, 2, 0, { { 0x0e, 0, 0x21 }, { 0x01, 0, 0x00 } }, { 13, 13, 4, 4 } }, /* 32 LD (nn),A */
+    { 22, 1, 1, 0, { { 0x01, 11, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 33 INC SP */
+    { 22, 2, 1, 0, { { 0x19, 12, 0x31 }, { 0x00, 0, 0x00 } }, { 19, 19, 5, 5 } }, /* 34 INC (IX+d) */
+    { 13, 2, 1, 0, { { 0x19, 12, 0x31 }, { 0x00, 0, 0x00 } }, { 19, 19, 5, 5 } }, /* 35 DEC (IX+d) */
+    { 29, 3, 2, 0, { { 0x19, 12, 0x31 }, { 0x02, 0, 0x12 } }, { 15, 15, 4, 4 } }, /* 36 LD (IX+d),n */
+    { 60, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 37 SCF */
+    { 28, 2, 2, 0, { { 0x20, 20, 0x00 }, { 0x82, 0, 0x11 } }, { 7, 12, 2, 3 } }, /* 38 JR C,e */
+    { 1, 1, 2, 0, { { 0x01, 12, 0x00 }, { 0x01, 11, 0x00 } }, { 11, 11, 3, 3 } }, /* 39 ADD IX,SP */
+    { 29, 3, 2, 0, { { 0x01, 0, 0x00 }, { 0x0e, 0, 0x21 } }, { 13, 13, 4, 4 } }, /* 3A LD A,(nn) */
+    { 13, 1, 1, 0, { { 0x01, 11, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 3B DEC SP */
+    { 22, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3C INC A */
+    { 13, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3D DEC A */
+    { 29, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 3E LD A,n */
+    { 5, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3F CCF */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 40 LD B,B */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 41 LD B,C */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 42 LD B,D */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 43 LD B,E */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 44 LD B,H */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 45 LD B,L */
+    { 29, 2, 2, 0, { { 0x01, 1, 0x00 }, { 0x19, 12, 0x31 } }, { 15, 15, 4, 4 } }, /* 46 LD B,(IX+d) */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 47 LD B,A */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 48 LD C,B */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 49 LD C,C */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 4A LD C,D */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 4B LD C,E */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 4C LD C,H */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 4D LD C,L */
+    { 29, 2, 2, 0, { { 0x01, 2, 0x00 }, { 0x19, 12, 0x31 } }, { 15, 15, 4, 4 } }, /* 4E LD C,(IX+d) */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 4F LD C,A */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 50 LD D,B */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 51 LD D,C */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 52 LD D,D */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 53 LD D,E */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 54 LD D,H */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 55 LD D,L */
+    { 29, 2, 2, 0, { { 0x01, 3, 0x00 }, { 0x19, 12, 0x31 } }, { 15, 15, 4, 4 } }, /* 56 LD D,(IX+d) */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 57 LD D,A */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 58 LD E,B */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 59 LD E,C */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 5A LD E,D */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 5B LD E,E */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 5C LD E,H */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 5D LD E,L */
+    { 29, 2, 2, 0, { { 0x01, 4, 0x00 }, { 0x19, 12, 0x31 } }, { 15, 15, 4, 4 } }, /* 5E LD E,(IX+d) */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 5F LD E,A */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 60 LD H,B */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 61 LD H,C */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 62 LD H,D */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 63 LD H,E */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 64 LD H,H */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 65 LD H,L */
+    { 29, 2, 2, 0, { { 0x01, 5, 0x00 }, { 0x19, 12, 0x31 } }, { 15, 15, 4, 4 } }, /* 66 LD H,(IX+d) */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 67 LD H,A */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 68 LD L,B */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 69 LD L,C */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 6A LD L,D */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 6B LD L,E */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 6C LD L,H */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 6D LD L,L */
+    { 29, 2, 2, 0, { { 0x01, 6, 0x00 }, { 0x19, 12, 0x31 } }, { 15, 15, 4, 4 } }, /* 6E LD L,(IX+d) */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 6F LD L,A */
+    { 29, 2, 2, 0, { { 0x19, 12, 0x31 }, { 0x01, 1, 0x00 } }, { 15, 15, 4, 4 } }, /* 70 LD (IX+d),B */
+    { 29, 2, 2, 0, { { 0x19, 12, 0x31 }, { 0x01, 2, 0x00 } }, { 15, 15, 4, 4 } }, /* 71 LD (IX+d),C */
+    { 29, 2, 2, 0, { { 0x19, 12, 0x31 }, { 0x01, 3, 0x00 } }, { 15, 15, 4, 4 } }, /* 72 LD (IX+d),D */
+    { 29, 2, 2, 0, { { 0x19, 12, 0x31 }, { 0x01, 4, 0x00 } }, { 15, 15, 4, 4 } }, /* 73 LD (IX+d),E */
+    { 29, 2, 2, 0, { { 0x19, 12, 0x31 }, { 0x01, 5, 0x00 } }, { 15, 15, 4, 4 } }, /* 74 LD (IX+d),H */
+    { 29, 2, 2, 0, { { 0x19, 12, 0x31 }, { 0x01, 6, 0x00 } }, { 15, 15, 4, 4 } }, /* 75 LD (IX+d),L */
+    { 19, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 76 HALT */
+    { 29, 2, 2, 0, { { 0x19, 12, 0x31 }, { 0x01, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 77 LD (IX+d),A */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 78 LD A,B */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 79 LD A,C */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 7A LD A,D */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 7B LD A,E */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 7C LD A,H */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 7D LD A,L */
+    { 29, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x19, 12, 0x31 } }, { 15, 15, 4, 4 } }, /* 7E LD A,(IX+d) */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 7F LD A,A */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 80 ADD A,B */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 81 ADD A,C */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 82 ADD A,D */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 83 ADD A,E */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 84 ADD A,H */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 85 ADD A,L */
+    { 1, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x19, 12, 0x31 } }, { 15, 15, 4, 4 } }, /* 86 ADD A,(IX+d) */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 87 ADD A,A */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 88 ADC A,B */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 89 ADC A,C */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 8A ADC A,D */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 8B ADC A,E */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 8C ADC A,H */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 8D ADC A,L */
+    { 0, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x19, 12, 0x31 } }, { 15, 15, 4, 4 } }, /* 8E ADC A,(IX+d) */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 8F ADC A,A */
+    { 65, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 90 SUB B */
+    { 65, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 91 SUB C */
+    { 65, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 92 SUB D */
+    { 65, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 93 SUB E */
+    { 65, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 94 SUB H */
+    { 65, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 95 SUB L */
+    { 65, 2, 1, 0, { { 0x19, 12, 0x31 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 96 SUB (IX+d) */
+    { 65, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 97 SUB A */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 98 SBC A,B */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 99 SBC A,C */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 9A SBC A,D */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 9B SBC A,E */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 9C SBC A,H */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 9D SBC A,L */
+    { 59, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x19, 12, 0x31 } }, { 15, 15, 4, 4 } }, /* 9E SBC A,(IX+d) */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 9F SBC A,A */
+    { 2, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A0 AND B */
+    { 2, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A1 AND C */
+    { 2, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A2 AND D */
+    { 2, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A3 AND E */
+    { 2, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A4 AND H */
+    { 2, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A5 AND L */
+    { 2, 2, 1, 0, { { 0x19, 12, 0x31 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* A6 AND (IX+d) */
+    { 2, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A7 AND A */
+    { 66, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A8 XOR B */
+    { 66, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A9 XOR C */
+    { 66, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AA XOR D */
+    { 66, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AB XOR E */
+    { 66, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AC XOR H */
+    { 66, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AD XOR L */
+    { 66, 2, 1, 0, { { 0x19, 12, 0x31 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* AE XOR (IX+d) */
+    { 66, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AF XOR A */
+    { 36, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B0 OR B */
+    { 36, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B1 OR C */
+    { 36, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B2 OR D */
+    { 36, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B3 OR E */
+    { 36, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B4 OR H */
+    { 36, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B5 OR L */
+    { 36, 2, 1, 0, { { 0x19, 12, 0x31 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* B6 OR (IX+d) */
+    { 36, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B7 OR A */
+    { 6, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B8 CP B */
+    { 6, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B9 CP C */
+    { 6, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BA CP D */
+    { 6, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BB CP E */
+    { 6, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BC CP H */
+    { 6, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BD CP L */
+    { 6, 2, 1, 0, { { 0x19, 12, 0x31 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* BE CP (IX+d) */
+    { 6, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BF CP A */
+    { 45, 1, 1, 0, { { 0x20, 17, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* C0 RET NZ */
+    { 42, 1, 1, 0, { { 0x01, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* C1 POP BC */
+    { 27, 3, 2, 0, { { 0x20, 17, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* C2 JP NZ,nn */
+    { 27, 3, 1, 0, { { 0x06, 0, 0x21 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* C3 JP nn */
+    { 4, 3, 2, 0, { { 0x20, 17, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* C4 CALL NZ,nn */
+    { 43, 1, 1, 0, { { 0x01, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* C5 PUSH BC */
+    { 1, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* C6 ADD A,n */
+    { 53, 1, 1, 0, { { 0x60, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* C7 RST 0x0 */
+    { 45, 1, 1, 0, { { 0x20, 18, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* C8 RET Z */
+    { 45, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* C9 RET */
+    { 27, 3, 2, 0, { { 0x20, 18, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* CA JP Z,nn */
+    { 0, 0, 0, pg_DDCB, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* CB prefix */
+    { 4, 3, 2, 0, { { 0x20, 18, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* CC CALL Z,nn */
+    { 4, 3, 1, 0, { { 0x06, 0, 0x21 }, { 0x00, 0, 0x00 } }, { 17, 17, 5, 5 } }, /* CD CALL nn */
+    { 0, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* CE ADC A,n */
+    { 53, 1, 1, 0, { { 0x60, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* CF RST 0x8 */
+    { 45, 1, 1, 0, { { 0x20, 19, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* D0 RET NC */
+    { 42, 1, 1, 0, { { 0x01, 9, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* D1 POP DE */
+    { 27, 3, 2, 0, { { 0x20, 19, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* D2 JP NC,nn */
+    { 37, 2, 2, 0, { { 0x02, 0, 0x11 }, { 0x01, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* D3 OUT n,A */
+    { 4, 3, 2, 0, { { 0x20, 19, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* D4 CALL NC,nn */
+    { 43, 1, 1, 0, { { 0x01, 9, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* D5 PUSH DE */
+    { 65, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* D6 SUB n */
+    { 53, 1, 1, 0, { { 0x60, 16, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* D7 RST 0x10 */
+    { 45, 1, 1, 0, { { 0x20, 20, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* D8 RET C */
+    { 18, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* D9 EXX */
+    { 27, 3, 2, 0, { { 0x20, 20, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* DA JP C,nn */
+    { 21, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 11, 11, 3, 3 } }, /* DB IN A,n */
+    { 4, 3, 2, 0, { { 0x20, 20, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* DC CALL C,nn */
+    { 0, 0, 0, pg_DD, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* DD prefix */
+    { 59, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* DE SBC A,n */
+    { 53, 1, 1, 0, { { 0x60, 24, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* DF RST 0x18 */
+    { 45, 1, 1, 0, { { 0x20, 21, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* E0 RET PO */
+    { 42, 1, 1, 0, { { 0x01, 12, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* E1 POP IX */
+    { 27, 3, 2, 0, { { 0x20, 21, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* E2 JP PO,nn */
+    { 17, 1, 2, 0, { { 0x09, 11, 0x00 }, { 0x01, 12, 0x00 } }, { 19, 19, 5, 5 } }, /* E3 EX (SP),IX */
+    { 4, 3, 2, 0, { { 0x20, 21, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* E4 CALL PO,nn */
+    { 43, 1, 1, 0, { { 0x01, 12, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* E5 PUSH IX */
+    { 2, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* E6 AND n */
+    { 53, 1, 1, 0, { { 0x60, 32, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* E7 RST 0x20 */
+    { 45, 1, 1, 0, { { 0x20, 22, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* E8 RET PE */
+    { 27, 1, 1, 0, { { 0x09, 12, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* E9 JP (IX) */
+    { 27, 3, 2, 0, { { 0x20, 22, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* EA JP PE,nn */
+    { 17, 1, 2, 0, { { 0x01, 9, 0x00 }, { 0x01, 10, 0x00 } }, { 4, 4, 1, 1 } }, /* EB EX DE,HL */
+    { 4, 3, 2, 0, { { 0x20, 22, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* EC CALL PE,nn */
+    { 0, 0, 0, pg_ED, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* ED prefix */
+    { 66, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* EE XOR n */
+    { 53, 1, 1, 0, { { 0x60, 40, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* EF RST 0x28 */
+    { 45, 1, 1, 0, { { 0x20, 23, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* F0 RET P */
+    { 42, 1, 1, 0, { { 0x01, 7, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* F1 POP AF */
+    { 27, 3, 2, 0, { { 0x20, 23, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* F2 JP P,nn */
+    { 14, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* F3 DI */
+    { 4, 3, 2, 0, { { 0x20, 23, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* F4 CALL P,nn */
+    { 43, 1, 1, 0, { { 0x01, 7, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* F5 PUSH AF */
+    { 36, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* F6 OR n */
+    { 53, 1, 1, 0, { { 0x60, 48, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* F7 RST 0x30 */
+    { 45, 1, 1, 0, { { 0x20, 24, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* F8 RET M */
+    { 29, 1, 2, 0, { { 0x01, 11, 0x00 }, { 0x01, 12, 0x00 } }, { 6, 6, 1, 1 } }, /* F9 LD SP,IX */
+    { 27, 3, 2, 0, { { 0x20, 24, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* FA JP M,nn */
+    { 16, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* FB EI */
+    { 4, 3, 2, 0, { { 0x20, 24, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* FC CALL M,nn */
+    { 0, 0, 0, pg_FD, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* FD prefix */
+    { 6, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* FE CP n */
+    { 53, 1, 1, 0, { { 0x60, 56, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* FF RST 0x38 */
+  },
+  { /* pg_FD */
+    { 35, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 00 NOP */
+    { 29, 3, 2, 0, { { 0x01, 8, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* 01 LD BC,nn */
+    { 29, 1, 2, 0, { { 0x09, 8, 0x00 }, { 0x01, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* 02 LD (BC),A */
+    { 22, 1, 1, 0, { { 0x01, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 03 INC BC */
+    { 22, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 04 INC B */
+    { 13, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 05 DEC B */
+    { 29, 2, 2, 0, { { 0x01, 1, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 06 LD B,n */
+    { 52, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 07 RLCA */
+    { 17, 1, 2, 0, { { 0x01, 7, 0x00 }, { 0x01, 14, 0x00 } }, { 4, 4, 1, 1 } }, /* 08 EX AF,AF' */
+    { 1, 1, 2, 0, { { 0x01, 13, 0x00 }, { 0x01, 8, 0x00 } }, { 11, 11, 3, 3 } }, /* 09 ADD IY,BC */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x09, 8, 0x00 } }, { 7, 7, 2, 2 } }, /* 0A LD A,(BC) */
+    { 13, 1, 1, 0, { { 0x01, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 0B DEC BC */
+    { 22, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0C INC C */
+    { 13, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0D DEC C */
+    { 29, 2, 2, 0, { { 0x01, 2, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 0E LD C,n */
+    { 58, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 0F RRCA */
+    { 15, 2, 1, 0, { { 0x82, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 8, 13, 2, 3 } }, /* 10 DJNZ e */
+    { 29, 3, 2, 0, { { 0x01, 9, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* 11 LD DE,nn */
+    { 29, 1, 2, 0, { { 0x09, 9, 0x00 }, { 0x01, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* 12 LD (DE),A */
+    { 22, 1, 1, 0, { { 0x01, 9, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 13 INC DE */
+    { 22, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 14 INC D */
+    { 13, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 15 DEC D */
+    { 29, 2, 2, 0, { { 0x01, 3, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 16 LD D,n */
+    { 49, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 17 RLA */
+    { 28, 2, 1, 0, { { 0x82, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 12, 12, 3, 3 } }, /* 18 JR e */
+    { 1, 1, 2, 0, { { 0x01, 13, 0x00 }, { 0x01, 9, 0x00 } }, { 11, 11, 3, 3 } }, /* 19 ADD IY,DE */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x09, 9, 0x00 } }, { 7, 7, 2, 2 } }, /* 1A LD A,(DE) */
+    { 13, 1, 1, 0, { { 0x01, 9, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 1B DEC DE */
+    { 22, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1C INC E */
+    { 13, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1D DEC E */
+    { 29, 2, 2, 0, { { 0x01, 4, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 1E LD E,n */
+    { 55, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 1F RRA */
+    { 28, 2, 2, 0, { { 0x20, 17, 0x00 }, { 0x82, 0, 0x11 } }, { 7, 12, 2, 3 } }, /* 20 JR NZ,e */
+    { 29, 3, 2, 0, { { 0x01, 13, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* 21 LD IY,nn */
+    { 29, 3, 2, 0, { { 0x0e, 0, 0x21 }, { 0x01, 13, 0x00 } }, { 16, 16, 5, 5 } }, /* 22 LD (nn),IY */
+    { 22, 1, 1, 0, { { 0x01, 13, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 23 INC IY */
+    { 22, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 24 INC H */
+    { 13, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 25 DEC H */
+    { 29, 2, 2, 0, { { 0x01, 5, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 26 LD H,n */
+    { 12, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 27 DAA */
+    { 28, 2, 2, 0, { { 0x20, 18, 0x00 }, { 0x82, 0, 0x11 } }, { 7, 12, 2, 3 } }, /* 28 JR Z,e */
+    { 1, 1, 2, 0, { { 0x01, 13, 0x00 }, { 0x01, 13, 0x00 } }, { 11, 11, 3, 3 } }, /* 29 ADD IY,IY */
+    { 29, 3, 2, 0, { { 0x01, 13, 0x00 }, { 0x0e, 0, 0x21 } }, { 16, 16, 5, 5 } }, /* 2A LD IY,(nn) */
+    { 13, 1, 1, 0, { { 0x01, 13, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 2B DEC IY */
+    { 22, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2C INC L */
+    { 13, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2D DEC L */
+    { 29, 2, 2, 0, { { 0x01, 6, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 2E LD L,n */
+    { 11, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 2F CPL */
+    { 28, 2, 2, 0, { { 0x20, 19, 0x00 }, { 0x82, 0, 0x11 } }, { 7, 12, 2, 3 } }, /* 30 JR NC,e */
+    { 29, 3, 2, 0, { { 0x01, 11, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* 31 LD SP,nn */
+    { 29, 3, 2, 0, { { 0x0e, 0, 0x21 }, { 0x01, 0, 0x00 } }, { 13, 13, 4, 4 } }, /* 32 LD (nn),A */
+    { 22, 1, 1, 0, { { 0x01, 11, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 33 INC SP */
+    { 22, 2, 1, 0, { { 0x19, 13, 0x31 }, { 0x00, 0, 0x00 } }, { 19, 19, 5, 5 } }, /* 34 INC (IY+d) */
+    { 13, 2, 1, 0, { { 0x19, 13, 0x31 }, { 0x00, 0, 0x00 } }, { 19, 19, 5, 5 } }, /* 35 DEC (IY+d) */
+    { 29, 3, 2, 0, { { 0x19, 13, 0x31 }, { 0x02, 0, 0x12 } }, { 15, 15, 4, 4 } }, /* 36 LD (IY+d),n */
+    { 60, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 37 SCF */
+    { 28, 2, 2, 0, { { 0x20, 20, 0x00 }, { 0x82, 0, 0x11 } }, { 7, 12, 2, 3 } }, /* 38 JR C,e */
+    { 1, 1, 2, 0, { { 0x01, 13, 0x00 }, { 0x01, 11, 0x00 } }, { 11, 11, 3, 3 } }, /* 39 ADD IY,SP */
+    { 29, 3, 2, 0, { { 0x01, 0, 0x00 }, { 0x0e, 0, 0x21 } }, { 13, 13, 4, 4 } }, /* 3A LD A,(nn) */
+    { 13, 1, 1, 0, { { 0x01, 11, 0x00 }, { 0x00, 0, 0x00 } }, { 6, 6, 1, 1 } }, /* 3B DEC SP */
+    { 22, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3C INC A */
+    { 13, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3D DEC A */
+    { 29, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* 3E LD A,n */
+    { 5, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 3F CCF */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 40 LD B,B */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 41 LD B,C */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 42 LD B,D */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 43 LD B,E */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 44 LD B,H */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 45 LD B,L */
+    { 29, 2, 2, 0, { { 0x01, 1, 0x00 }, { 0x19, 13, 0x31 } }, { 15, 15, 4, 4 } }, /* 46 LD B,(IY+d) */
+    { 29, 1, 2, 0, { { 0x01, 1, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 47 LD B,A */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 48 LD C,B */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 49 LD C,C */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 4A LD C,D */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 4B LD C,E */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 4C LD C,H */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 4D LD C,L */
+    { 29, 2, 2, 0, { { 0x01, 2, 0x00 }, { 0x19, 13, 0x31 } }, { 15, 15, 4, 4 } }, /* 4E LD C,(IY+d) */
+    { 29, 1, 2, 0, { { 0x01, 2, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 4F LD C,A */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 50 LD D,B */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 51 LD D,C */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 52 LD D,D */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 53 LD D,E */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 54 LD D,H */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 55 LD D,L */
+    { 29, 2, 2, 0, { { 0x01, 3, 0x00 }, { 0x19, 13, 0x31 } }, { 15, 15, 4, 4 } }, /* 56 LD D,(IY+d) */
+    { 29, 1, 2, 0, { { 0x01, 3, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 57 LD D,A */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 58 LD E,B */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 59 LD E,C */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 5A LD E,D */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 5B LD E,E */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 5C LD E,H */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 5D LD E,L */
+    { 29, 2, 2, 0, { { 0x01, 4, 0x00 }, { 0x19, 13, 0x31 } }, { 15, 15, 4, 4 } }, /* 5E LD E,(IY+d) */
+    { 29, 1, 2, 0, { { 0x01, 4, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 5F LD E,A */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 60 LD H,B */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 61 LD H,C */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 62 LD H,D */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 63 LD H,E */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 64 LD H,H */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 65 LD H,L */
+    { 29, 2, 2, 0, { { 0x01, 5, 0x00 }, { 0x19, 13, 0x31 } }, { 15, 15, 4, 4 } }, /* 66 LD H,(IY+d) */
+    { 29, 1, 2, 0, { { 0x01, 5, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 67 LD H,A */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 68 LD L,B */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 69 LD L,C */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 6A LD L,D */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 6B LD L,E */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 6C LD L,H */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 6D LD L,L */
+    { 29, 2, 2, 0, { { 0x01, 6, 0x00 }, { 0x19, 13, 0x31 } }, { 15, 15, 4, 4 } }, /* 6E LD L,(IY+d) */
+    { 29, 1, 2, 0, { { 0x01, 6, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 6F LD L,A */
+    { 29, 2, 2, 0, { { 0x19, 13, 0x31 }, { 0x01, 1, 0x00 } }, { 15, 15, 4, 4 } }, /* 70 LD (IY+d),B */
+    { 29, 2, 2, 0, { { 0x19, 13, 0x31 }, { 0x01, 2, 0x00 } }, { 15, 15, 4, 4 } }, /* 71 LD (IY+d),C */
+    { 29, 2, 2, 0, { { 0x19, 13, 0x31 }, { 0x01, 3, 0x00 } }, { 15, 15, 4, 4 } }, /* 72 LD (IY+d),D */
+    { 29, 2, 2, 0, { { 0x19, 13, 0x31 }, { 0x01, 4, 0x00 } }, { 15, 15, 4, 4 } }, /* 73 LD (IY+d),E */
+    { 29, 2, 2, 0, { { 0x19, 13, 0x31 }, { 0x01, 5, 0x00 } }, { 15, 15, 4, 4 } }, /* 74 LD (IY+d),H */
+    { 29, 2, 2, 0, { { 0x19, 13, 0x31 }, { 0x01, 6, 0x00 } }, { 15, 15, 4, 4 } }, /* 75 LD (IY+d),L */
+    { 19, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 76 HALT */
+    { 29, 2, 2, 0, { { 0x19, 13, 0x31 }, { 0x01, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 77 LD (IY+d),A */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 78 LD A,B */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 79 LD A,C */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 7A LD A,D */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 7B LD A,E */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 7C LD A,H */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 7D LD A,L */
+    { 29, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x19, 13, 0x31 } }, { 15, 15, 4, 4 } }, /* 7E LD A,(IY+d) */
+    { 29, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 7F LD A,A */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 80 ADD A,B */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 81 ADD A,C */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 82 ADD A,D */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 83 ADD A,E */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 84 ADD A,H */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 85 ADD A,L */
+    { 1, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x19, 13, 0x31 } }, { 15, 15, 4, 4 } }, /* 86 ADD A,(IY+d) */
+    { 1, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 87 ADD A,A */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 88 ADC A,B */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 89 ADC A,C */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 8A ADC A,D */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 8B ADC A,E */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 8C ADC A,H */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 8D ADC A,L */
+    { 0, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x19, 13, 0x31 } }, { 15, 15, 4, 4 } }, /* 8E ADC A,(IY+d) */
+    { 0, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 8F ADC A,A */
+    { 65, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 90 SUB B */
+    { 65, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 91 SUB C */
+    { 65, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 92 SUB D */
+    { 65, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 93 SUB E */
+    { 65, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 94 SUB H */
+    { 65, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 95 SUB L */
+    { 65, 2, 1, 0, { { 0x19, 13, 0x31 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 96 SUB (IY+d) */
+    { 65, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 97 SUB A */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 1, 0x00 } }, { 4, 4, 1, 1 } }, /* 98 SBC A,B */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 2, 0x00 } }, { 4, 4, 1, 1 } }, /* 99 SBC A,C */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 3, 0x00 } }, { 4, 4, 1, 1 } }, /* 9A SBC A,D */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 4, 0x00 } }, { 4, 4, 1, 1 } }, /* 9B SBC A,E */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 5, 0x00 } }, { 4, 4, 1, 1 } }, /* 9C SBC A,H */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 6, 0x00 } }, { 4, 4, 1, 1 } }, /* 9D SBC A,L */
+    { 59, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x19, 13, 0x31 } }, { 15, 15, 4, 4 } }, /* 9E SBC A,(IY+d) */
+    { 59, 1, 2, 0, { { 0x01, 0, 0x00 }, { 0x01, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* 9F SBC A,A */
+    { 2, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A0 AND B */
+    { 2, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A1 AND C */
+    { 2, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A2 AND D */
+    { 2, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A3 AND E */
+    { 2, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A4 AND H */
+    { 2, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A5 AND L */
+    { 2, 2, 1, 0, { { 0x19, 13, 0x31 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* A6 AND (IY+d) */
+    { 2, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A7 AND A */
+    { 66, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A8 XOR B */
+    { 66, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* A9 XOR C */
+    { 66, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AA XOR D */
+    { 66, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AB XOR E */
+    { 66, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AC XOR H */
+    { 66, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AD XOR L */
+    { 66, 2, 1, 0, { { 0x19, 13, 0x31 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* AE XOR (IY+d) */
+    { 66, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* AF XOR A */
+    { 36, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B0 OR B */
+    { 36, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B1 OR C */
+    { 36, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B2 OR D */
+    { 36, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B3 OR E */
+    { 36, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B4 OR H */
+    { 36, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B5 OR L */
+    { 36, 2, 1, 0, { { 0x19, 13, 0x31 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* B6 OR (IY+d) */
+    { 36, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B7 OR A */
+    { 6, 1, 1, 0, { { 0x01, 1, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B8 CP B */
+    { 6, 1, 1, 0, { { 0x01, 2, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* B9 CP C */
+    { 6, 1, 1, 0, { { 0x01, 3, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BA CP D */
+    { 6, 1, 1, 0, { { 0x01, 4, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BB CP E */
+    { 6, 1, 1, 0, { { 0x01, 5, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BC CP H */
+    { 6, 1, 1, 0, { { 0x01, 6, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BD CP L */
+    { 6, 2, 1, 0, { { 0x19, 13, 0x31 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* BE CP (IY+d) */
+    { 6, 1, 1, 0, { { 0x01, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* BF CP A */
+    { 45, 1, 1, 0, { { 0x20, 17, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* C0 RET NZ */
+    { 42, 1, 1, 0, { { 0x01, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* C1 POP BC */
+    { 27, 3, 2, 0, { { 0x20, 17, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* C2 JP NZ,nn */
+    { 27, 3, 1, 0, { { 0x06, 0, 0x21 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* C3 JP nn */
+    { 4, 3, 2, 0, { { 0x20, 17, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* C4 CALL NZ,nn */
+    { 43, 1, 1, 0, { { 0x01, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* C5 PUSH BC */
+    { 1, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* C6 ADD A,n */
+    { 53, 1, 1, 0, { { 0x60, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* C7 RST 0x0 */
+    { 45, 1, 1, 0, { { 0x20, 18, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* C8 RET Z */
+    { 45, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* C9 RET */
+    { 27, 3, 2, 0, { { 0x20, 18, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* CA JP Z,nn */
+    { 0, 0, 0, pg_FDCB, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* CB prefix */
+    { 4, 3, 2, 0, { { 0x20, 18, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* CC CALL Z,nn */
+    { 4, 3, 1, 0, { { 0x06, 0, 0x21 }, { 0x00, 0, 0x00 } }, { 17, 17, 5, 5 } }, /* CD CALL nn */
+    { 0, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* CE ADC A,n */
+    { 53, 1, 1, 0, { { 0x60, 8, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* CF RST 0x8 */
+    { 45, 1, 1, 0, { { 0x20, 19, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* D0 RET NC */
+    { 42, 1, 1, 0, { { 0x01, 9, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* D1 POP DE */
+    { 27, 3, 2, 0, { { 0x20, 19, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* D2 JP NC,nn */
+    { 37, 2, 2, 0, { { 0x02, 0, 0x11 }, { 0x01, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* D3 OUT n,A */
+    { 4, 3, 2, 0, { { 0x20, 19, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* D4 CALL NC,nn */
+    { 43, 1, 1, 0, { { 0x01, 9, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* D5 PUSH DE */
+    { 65, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* D6 SUB n */
+    { 53, 1, 1, 0, { { 0x60, 16, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* D7 RST 0x10 */
+    { 45, 1, 1, 0, { { 0x20, 20, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* D8 RET C */
+    { 18, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* D9 EXX */
+    { 27, 3, 2, 0, { { 0x20, 20, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* DA JP C,nn */
+    { 21, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 11, 11, 3, 3 } }, /* DB IN A,n */
+    { 4, 3, 2, 0, { { 0x20, 20, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* DC CALL C,nn */
+    { 0, 0, 0, pg_DD, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* DD prefix */
+    { 59, 2, 2, 0, { { 0x01, 0, 0x00 }, { 0x02, 0, 0x11 } }, { 7, 7, 2, 2 } }, /* DE SBC A,n */
+    { 53, 1, 1, 0, { { 0x60, 24, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* DF RST 0x18 */
+    { 45, 1, 1, 0, { { 0x20, 21, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* E0 RET PO */
+    { 42, 1, 1, 0, { { 0x01, 13, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* E1 POP IY */
+    { 27, 3, 2, 0, { { 0x20, 21, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* E2 JP PO,nn */
+    { 17, 1, 2, 0, { { 0x09, 11, 0x00 }, { 0x01, 13, 0x00 } }, { 19, 19, 5, 5 } }, /* E3 EX (SP),IY */
+    { 4, 3, 2, 0, { { 0x20, 21, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* E4 CALL PO,nn */
+    { 43, 1, 1, 0, { { 0x01, 13, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* E5 PUSH IY */
+    { 2, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* E6 AND n */
+    { 53, 1, 1, 0, { { 0x60, 32, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* E7 RST 0x20 */
+    { 45, 1, 1, 0, { { 0x20, 22, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* E8 RET PE */
+    { 27, 1, 1, 0, { { 0x09, 13, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* E9 JP (IY) */
+    { 27, 3, 2, 0, { { 0x20, 22, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* EA JP PE,nn */
+    { 17, 1, 2, 0, { { 0x01, 9, 0x00 }, { 0x01, 10, 0x00 } }, { 4, 4, 1, 1 } }, /* EB EX DE,HL */
+    { 4, 3, 2, 0, { { 0x20, 22, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* EC CALL PE,nn */
+    { 0, 0, 0, pg_ED, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* ED prefix */
+    { 66, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* EE XOR n */
+    { 53, 1, 1, 0, { { 0x60, 40, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* EF RST 0x28 */
+    { 45, 1, 1, 0, { { 0x20, 23, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* F0 RET P */
+    { 42, 1, 1, 0, { { 0x01, 7, 0x00 }, { 0x00, 0, 0x00 } }, { 10, 10, 3, 3 } }, /* F1 POP AF */
+    { 27, 3, 2, 0, { { 0x20, 23, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* F2 JP P,nn */
+    { 14, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* F3 DI */
+    { 4, 3, 2, 0, { { 0x20, 23, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* F4 CALL P,nn */
+    { 43, 1, 1, 0, { { 0x01, 7, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* F5 PUSH AF */
+    { 36, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* F6 OR n */
+    { 53, 1, 1, 0, { { 0x60, 48, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* F7 RST 0x30 */
+    { 45, 1, 1, 0, { { 0x20, 24, 0x00 }, { 0x00, 0, 0x00 } }, { 5, 11, 1, 3 } }, /* F8 RET M */
+    { 29, 1, 2, 0, { { 0x01, 11, 0x00 }, { 0x01, 13, 0x00 } }, { 6, 6, 1, 1 } }, /* F9 LD SP,IY */
+    { 27, 3, 2, 0, { { 0x20, 24, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 10, 3, 3 } }, /* FA JP M,nn */
+    { 16, 1, 0, 0, { { 0x00, 0, 0x00 }, { 0x00, 0, 0x00 } }, { 4, 4, 1, 1 } }, /* FB EI */
+    { 4, 3, 2, 0, { { 0x20, 24, 0x00 }, { 0x06, 0, 0x21 } }, { 10, 17, 3, 5 } }, /* FC CALL M,nn */
+    { 0, 0, 0, pg_FD, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* FD prefix */
+    { 6, 2, 1, 0, { { 0x02, 0, 0x11 }, { 0x00, 0, 0x00 } }, { 7, 7, 2, 2 } }, /* FE CP n */
+    { 53, 1, 1, 0, { { 0x60, 56, 0x00 }, { 0x00, 0, 0x00 } }, { 11, 11, 3, 3 } }, /* FF RST 0x38 */
+  },
+  { /* pg_DDCB */
+    { 50, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 00 RLC (IX+d) */
+    { 50, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 01 RLC (IX+d) */
+    { 50, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 02 RLC (IX+d) */
+    { 50, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 03 RLC (IX+d) */
+    { 50, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 04 RLC (IX+d) */
+    { 50, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 05 RLC (IX+d) */
+    { 50, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 06 RLC (IX+d) */
+    { 50, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 07 RLC (IX+d) */
+    { 56, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 08 RRC (IX+d) */
+    { 56, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 09 RRC (IX+d) */
+    { 56, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 0A RRC (IX+d) */
+    { 56, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 0B RRC (IX+d) */
+    { 56, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 0C RRC (IX+d) */
+    { 56, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 0D RRC (IX+d) */
+    { 56, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 0E RRC (IX+d) */
+    { 56, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 0F RRC (IX+d) */
+    { 48, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 10 RL (IX+d) */
+    { 48, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 11 RL (IX+d) */
+    { 48, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 12 RL (IX+d) */
+    { 48, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 13 RL (IX+d) */
+    { 48, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 14 RL (IX+d) */
+    { 48, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 15 RL (IX+d) */
+    { 48, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 16 RL (IX+d) */
+    { 48, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 17 RL (IX+d) */
+    { 54, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 18 RR (IX+d) */
+    { 54, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 19 RR (IX+d) */
+    { 54, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 1A RR (IX+d) */
+    { 54, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 1B RR (IX+d) */
+    { 54, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 1C RR (IX+d) */
+    { 54, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 1D RR (IX+d) */
+    { 54, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 1E RR (IX+d) */
+    { 54, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 1F RR (IX+d) */
+    { 62, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 20 SLA (IX+d) */
+    { 62, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 21 SLA (IX+d) */
+    { 62, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 22 SLA (IX+d) */
+    { 62, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 23 SLA (IX+d) */
+    { 62, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 24 SLA (IX+d) */
+    { 62, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 25 SLA (IX+d) */
+    { 62, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 26 SLA (IX+d) */
+    { 62, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 27 SLA (IX+d) */
+    { 63, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 28 SRA (IX+d) */
+    { 63, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 29 SRA (IX+d) */
+    { 63, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 2A SRA (IX+d) */
+    { 63, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 2B SRA (IX+d) */
+    { 63, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 2C SRA (IX+d) */
+    { 63, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 2D SRA (IX+d) */
+    { 63, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 2E SRA (IX+d) */
+    { 63, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 2F SRA (IX+d) */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 30 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 31 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 32 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 33 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 34 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 35 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 36 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 37 invalid */
+    { 64, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 38 SRL (IX+d) */
+    { 64, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 39 SRL (IX+d) */
+    { 64, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 3A SRL (IX+d) */
+    { 64, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 3B SRL (IX+d) */
+    { 64, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 3C SRL (IX+d) */
+    { 64, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 3D SRL (IX+d) */
+    { 64, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 3E SRL (IX+d) */
+    { 64, 2, 1, 0, { { 0x19, 12, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 3F SRL (IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 40 BIT 0,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 41 BIT 0,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 42 BIT 0,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 43 BIT 0,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 44 BIT 0,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 45 BIT 0,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 46 BIT 0,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 47 BIT 0,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 48 BIT 1,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 49 BIT 1,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 4A BIT 1,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 4B BIT 1,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 4C BIT 1,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 4D BIT 1,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 4E BIT 1,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 4F BIT 1,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 50 BIT 2,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 51 BIT 2,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 52 BIT 2,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 53 BIT 2,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 54 BIT 2,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 55 BIT 2,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 56 BIT 2,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 57 BIT 2,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 58 BIT 3,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 59 BIT 3,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 5A BIT 3,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 5B BIT 3,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 5C BIT 3,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 5D BIT 3,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 5E BIT 3,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 5F BIT 3,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 60 BIT 4,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 61 BIT 4,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 62 BIT 4,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 63 BIT 4,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 64 BIT 4,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 65 BIT 4,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 66 BIT 4,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 67 BIT 4,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 68 BIT 5,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 69 BIT 5,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 6A BIT 5,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 6B BIT 5,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 6C BIT 5,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 6D BIT 5,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 6E BIT 5,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 6F BIT 5,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 70 BIT 6,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 71 BIT 6,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 72 BIT 6,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 73 BIT 6,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 74 BIT 6,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 75 BIT 6,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 76 BIT 6,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 77 BIT 6,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 78 BIT 7,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 79 BIT 7,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 7A BIT 7,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 7B BIT 7,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 7C BIT 7,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 7D BIT 7,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 7E BIT 7,(IX+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 12, 12, 3, 3 } }, /* 7F BIT 7,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 80 RES 0,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 81 RES 0,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 82 RES 0,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 83 RES 0,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 84 RES 0,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 85 RES 0,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 86 RES 0,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 87 RES 0,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 88 RES 1,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 89 RES 1,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 8A RES 1,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 8B RES 1,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 8C RES 1,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 8D RES 1,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 8E RES 1,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 8F RES 1,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 90 RES 2,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 91 RES 2,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 92 RES 2,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 93 RES 2,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 94 RES 2,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 95 RES 2,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 96 RES 2,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 97 RES 2,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 98 RES 3,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 99 RES 3,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 9A RES 3,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 9B RES 3,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 9C RES 3,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 9D RES 3,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 9E RES 3,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* 9F RES 3,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* A0 RES 4,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* A1 RES 4,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* A2 RES 4,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* A3 RES 4,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* A4 RES 4,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* A5 RES 4,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* A6 RES 4,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* A7 RES 4,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* A8 RES 5,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* A9 RES 5,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* AA RES 5,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* AB RES 5,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* AC RES 5,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* AD RES 5,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* AE RES 5,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* AF RES 5,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* B0 RES 6,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* B1 RES 6,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* B2 RES 6,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* B3 RES 6,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* B4 RES 6,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* B5 RES 6,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* B6 RES 6,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* B7 RES 6,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* B8 RES 7,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* B9 RES 7,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* BA RES 7,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* BB RES 7,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* BC RES 7,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* BD RES 7,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* BE RES 7,(IX+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* BF RES 7,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* C0 SET 0,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* C1 SET 0,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* C2 SET 0,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* C3 SET 0,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* C4 SET 0,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* C5 SET 0,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* C6 SET 0,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* C7 SET 0,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* C8 SET 1,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* C9 SET 1,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* CA SET 1,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* CB SET 1,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* CC SET 1,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* CD SET 1,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* CE SET 1,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* CF SET 1,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* D0 SET 2,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* D1 SET 2,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* D2 SET 2,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* D3 SET 2,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* D4 SET 2,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* D5 SET 2,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* D6 SET 2,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* D7 SET 2,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* D8 SET 3,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* D9 SET 3,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* DA SET 3,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* DB SET 3,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* DC SET 3,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* DD SET 3,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* DE SET 3,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* DF SET 3,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* E0 SET 4,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* E1 SET 4,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* E2 SET 4,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* E3 SET 4,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* E4 SET 4,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* E5 SET 4,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* E6 SET 4,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* E7 SET 4,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* E8 SET 5,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* E9 SET 5,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* EA SET 5,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* EB SET 5,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* EC SET 5,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* ED SET 5,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* EE SET 5,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* EF SET 5,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* F0 SET 6,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* F1 SET 6,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* F2 SET 6,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* F3 SET 6,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* F4 SET 6,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* F5 SET 6,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* F6 SET 6,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* F7 SET 6,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* F8 SET 7,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* F9 SET 7,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* FA SET 7,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* FB SET 7,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* FC SET 7,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* FD SET 7,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* FE SET 7,(IX+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 12, 0x30 } }, { 15, 15, 4, 4 } }, /* FF SET 7,(IX+d) */
+  },
+  { /* pg_FDCB */
+    { 50, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 00 RLC (IY+d) */
+    { 50, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 01 RLC (IY+d) */
+    { 50, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 02 RLC (IY+d) */
+    { 50, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 03 RLC (IY+d) */
+    { 50, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 04 RLC (IY+d) */
+    { 50, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 05 RLC (IY+d) */
+    { 50, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 06 RLC (IY+d) */
+    { 50, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 07 RLC (IY+d) */
+    { 56, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 08 RRC (IY+d) */
+    { 56, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 09 RRC (IY+d) */
+    { 56, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 0A RRC (IY+d) */
+    { 56, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 0B RRC (IY+d) */
+    { 56, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 0C RRC (IY+d) */
+    { 56, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 0D RRC (IY+d) */
+    { 56, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 0E RRC (IY+d) */
+    { 56, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 0F RRC (IY+d) */
+    { 48, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 10 RL (IY+d) */
+    { 48, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 11 RL (IY+d) */
+    { 48, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 12 RL (IY+d) */
+    { 48, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 13 RL (IY+d) */
+    { 48, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 14 RL (IY+d) */
+    { 48, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 15 RL (IY+d) */
+    { 48, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 16 RL (IY+d) */
+    { 48, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 17 RL (IY+d) */
+    { 54, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 18 RR (IY+d) */
+    { 54, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 19 RR (IY+d) */
+    { 54, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 1A RR (IY+d) */
+    { 54, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 1B RR (IY+d) */
+    { 54, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 1C RR (IY+d) */
+    { 54, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 1D RR (IY+d) */
+    { 54, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 1E RR (IY+d) */
+    { 54, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 1F RR (IY+d) */
+    { 62, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 20 SLA (IY+d) */
+    { 62, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 21 SLA (IY+d) */
+    { 62, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 22 SLA (IY+d) */
+    { 62, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 23 SLA (IY+d) */
+    { 62, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 24 SLA (IY+d) */
+    { 62, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 25 SLA (IY+d) */
+    { 62, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 26 SLA (IY+d) */
+    { 62, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 27 SLA (IY+d) */
+    { 63, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 28 SRA (IY+d) */
+    { 63, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 29 SRA (IY+d) */
+    { 63, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 2A SRA (IY+d) */
+    { 63, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 2B SRA (IY+d) */
+    { 63, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 2C SRA (IY+d) */
+    { 63, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 2D SRA (IY+d) */
+    { 63, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 2E SRA (IY+d) */
+    { 63, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 2F SRA (IY+d) */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 30 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 31 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 32 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 33 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 34 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 35 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 36 invalid */
+    { 0, 0, 0, 0, { { 0, 0, 0 }, { 0, 0, 0 } }, { 0, 0, 0, 0 } }, /* 37 invalid */
+    { 64, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 38 SRL (IY+d) */
+    { 64, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 39 SRL (IY+d) */
+    { 64, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 3A SRL (IY+d) */
+    { 64, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 3B SRL (IY+d) */
+    { 64, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 3C SRL (IY+d) */
+    { 64, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 3D SRL (IY+d) */
+    { 64, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 3E SRL (IY+d) */
+    { 64, 2, 1, 0, { { 0x19, 13, 0x30 }, { 0x00, 0, 0x00 } }, { 15, 15, 4, 4 } }, /* 3F SRL (IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 40 BIT 0,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 41 BIT 0,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 42 BIT 0,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 43 BIT 0,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 44 BIT 0,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 45 BIT 0,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 46 BIT 0,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 47 BIT 0,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 48 BIT 1,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 49 BIT 1,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 4A BIT 1,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 4B BIT 1,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 4C BIT 1,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 4D BIT 1,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 4E BIT 1,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 4F BIT 1,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 50 BIT 2,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 51 BIT 2,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 52 BIT 2,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 53 BIT 2,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 54 BIT 2,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 55 BIT 2,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 56 BIT 2,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 57 BIT 2,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 58 BIT 3,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 59 BIT 3,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 5A BIT 3,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 5B BIT 3,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 5C BIT 3,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 5D BIT 3,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 5E BIT 3,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 5F BIT 3,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 60 BIT 4,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 61 BIT 4,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 62 BIT 4,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 63 BIT 4,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 64 BIT 4,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 65 BIT 4,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 66 BIT 4,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 67 BIT 4,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 68 BIT 5,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 69 BIT 5,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 6A BIT 5,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 6B BIT 5,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 6C BIT 5,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 6D BIT 5,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 6E BIT 5,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 6F BIT 5,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 70 BIT 6,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 71 BIT 6,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 72 BIT 6,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 73 BIT 6,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 74 BIT 6,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 75 BIT 6,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 76 BIT 6,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 77 BIT 6,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 78 BIT 7,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 79 BIT 7,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 7A BIT 7,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 7B BIT 7,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 7C BIT 7,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 7D BIT 7,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 7E BIT 7,(IY+d) */
+    { 3, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 12, 12, 3, 3 } }, /* 7F BIT 7,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 80 RES 0,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 81 RES 0,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 82 RES 0,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 83 RES 0,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 84 RES 0,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 85 RES 0,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 86 RES 0,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 87 RES 0,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 88 RES 1,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 89 RES 1,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 8A RES 1,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 8B RES 1,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 8C RES 1,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 8D RES 1,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 8E RES 1,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 8F RES 1,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 90 RES 2,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 91 RES 2,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 92 RES 2,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 93 RES 2,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 94 RES 2,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 95 RES 2,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 96 RES 2,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 97 RES 2,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 98 RES 3,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 99 RES 3,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 9A RES 3,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 9B RES 3,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 9C RES 3,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 9D RES 3,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 9E RES 3,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* 9F RES 3,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* A0 RES 4,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* A1 RES 4,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* A2 RES 4,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* A3 RES 4,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* A4 RES 4,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* A5 RES 4,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* A6 RES 4,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* A7 RES 4,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* A8 RES 5,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* A9 RES 5,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* AA RES 5,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* AB RES 5,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* AC RES 5,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* AD RES 5,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* AE RES 5,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* AF RES 5,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* B0 RES 6,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* B1 RES 6,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* B2 RES 6,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* B3 RES 6,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* B4 RES 6,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* B5 RES 6,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* B6 RES 6,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* B7 RES 6,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* B8 RES 7,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* B9 RES 7,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* BA RES 7,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* BB RES 7,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* BC RES 7,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* BD RES 7,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* BE RES 7,(IY+d) */
+    { 44, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* BF RES 7,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* C0 SET 0,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* C1 SET 0,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* C2 SET 0,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* C3 SET 0,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* C4 SET 0,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* C5 SET 0,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* C6 SET 0,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 0, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* C7 SET 0,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* C8 SET 1,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* C9 SET 1,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* CA SET 1,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* CB SET 1,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* CC SET 1,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* CD SET 1,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* CE SET 1,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 1, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* CF SET 1,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* D0 SET 2,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* D1 SET 2,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* D2 SET 2,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* D3 SET 2,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* D4 SET 2,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* D5 SET 2,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* D6 SET 2,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 2, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* D7 SET 2,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* D8 SET 3,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* D9 SET 3,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* DA SET 3,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* DB SET 3,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* DC SET 3,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* DD SET 3,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* DE SET 3,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 3, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* DF SET 3,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* E0 SET 4,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* E1 SET 4,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* E2 SET 4,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* E3 SET 4,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* E4 SET 4,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* E5 SET 4,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* E6 SET 4,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 4, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* E7 SET 4,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* E8 SET 5,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* E9 SET 5,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* EA SET 5,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* EB SET 5,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* EC SET 5,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* ED SET 5,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* EE SET 5,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 5, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* EF SET 5,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* F0 SET 6,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* F1 SET 6,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* F2 SET 6,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* F3 SET 6,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* F4 SET 6,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* F5 SET 6,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* F6 SET 6,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 6, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* F7 SET 6,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* F8 SET 7,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* F9 SET 7,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* FA SET 7,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* FB SET 7,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* FC SET 7,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* FD SET 7,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* FE SET 7,(IY+d) */
+    { 61, 2, 2, 0, { { 0x40, 7, 0x00 }, { 0x19, 13, 0x30 } }, { 15, 15, 4, 4 } }, /* FF SET 7,(IY+d) */
+  }
+};
+
+static const uint8_t s_length[pg_Count][128] = {
+  { /* pg_Main */
+    0x31, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x32, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11, 0x12,
+    0x32, 0x13, 0x11, 0x12, 0x12, 0x13, 0x11, 0x12, 0x32, 0x13, 0x11, 0x12, 0x12, 0x13, 0x11, 0x12,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x33, 0x13, 0x12, 0x11, 0x93, 0x33, 0x12, 0x11, 0x23, 0x13, 0x12, 0x11, 0x23, 0xb3, 0x12,
+    0x11, 0x13, 0x13, 0x12, 0x11, 0x13, 0xa3, 0x12, 0x11, 0x13, 0x13, 0x12, 0x11, 0x13, 0xc3, 0x12
+  },
+  { /* pg_CB */
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+    0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11
+  },
+  { /* pg_ED */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x31, 0x11, 0x11, 0x11, 0x31, 0x10, 0x10, 0x11, 0x31, 0x00, 0x11, 0x11, 0x31, 0x00, 0x11,
+    0x11, 0x31, 0x00, 0x10, 0x11, 0x31, 0x00, 0x10, 0x00, 0x31, 0x00, 0x00, 0x11, 0x31, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+  },
+  { /* pg_DD */
+    0x31, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x32, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11, 0x12,
+    0x32, 0x13, 0x11, 0x12, 0x12, 0x13, 0x11, 0x12, 0x32, 0x13, 0x22, 0x13, 0x12, 0x13, 0x11, 0x12,
+    0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12,
+    0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x12,
+    0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12,
+    0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12,
+    0x11, 0x33, 0x13, 0x12, 0x11, 0xd3, 0x33, 0x12, 0x11, 0x23, 0x13, 0x12, 0x11, 0x23, 0xb3, 0x12,
+    0x11, 0x13, 0x13, 0x12, 0x11, 0x13, 0xa3, 0x12, 0x11, 0x13, 0x13, 0x12, 0x11, 0x13, 0xc3, 0x12
+  },
+  { /* pg_FD */
+    0x31, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x32, 0x11, 0x11, 0x12, 0x12, 0x11, 0x11, 0x12,
+    0x32, 0x13, 0x11, 0x12, 0x12, 0x13, 0x11, 0x12, 0x32, 0x13, 0x22, 0x13, 0x12, 0x13, 0x11, 0x12,
+    0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12,
+    0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x22, 0x22, 0x22, 0x21, 0x11, 0x11, 0x11, 0x12,
+    0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12,
+    0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12, 0x11, 0x11, 0x11, 0x12,
+    0x11, 0x33, 0x13, 0x12, 0x11, 0xe3, 0x33, 0x12, 0x11, 0x23, 0x13, 0x12, 0x11, 0x23, 0xb3, 0x12,
+    0x11, 0x13, 0x13, 0x12, 0x11, 0x13, 0xa3, 0x12, 0x11, 0x13, 0x13, 0x12, 0x11, 0x13, 0xc3, 0x12
+  },
+  { /* pg_DDCB */
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22
+  },
+  { /* pg_FDCB */
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22,
+    0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22
+  }
+};
+
+#endif /* z80tables_h */